@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+#          Copyright Pele Constam 2022.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          https://www.boost.org/LICENSE_1_0.txt)
+#
+# Compile time benchmark for large menus. For every item count, a translation unit with a menu of
+# that many items is generated and compiled, and the wall time and peak memory of the compiler are
+# recorded.
+#
+# usage: compile_time.py [--items 10 100 1000] [--items-per-page 50] [--output result.csv]
+#                        [--keep DIR] -- <compiler command and flags>
+#
+# example: compile_time.py -- g++ -std=c++17 -O2 -Iinclude -Isubprojects/gcem/include
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+HEADER = """#include "sgl/boolean.hpp"
+#include "sgl/button.hpp"
+#include "sgl/menu.hpp"
+#include "sgl/numeric.hpp"
+#include "sgl/page.hpp"
+#include "sgl/page_link.hpp"
+
+using namespace sgl::string_view_literals;
+
+"""
+
+
+def item(page, index):
+    name = 'NAME("p{}i{}")'.format(page, index)
+    kind = index % 3
+    if kind == 0:
+        return "{} <<= sgl::Boolean(true)".format(name)
+    if kind == 1:
+        return "{} <<= sgl::numeric<20, char>({}, 1)".format(name, index)
+    return '{} <<= sgl::Button<20, char>("button {}"_sv)'.format(name, index)
+
+
+def generate(num_items, items_per_page):
+    """source of a translation unit with a menu of num_items items"""
+    pages = []
+    remaining = num_items
+    while remaining > 0:
+        pages.append(min(remaining, items_per_page))
+        remaining -= pages[-1]
+
+    src = [HEADER]
+    for p, size in enumerate(pages):
+        items = [item(p, i) for i in range(size)]
+        if len(pages) > 1:
+            # each page links to the next one, the last one back to the first
+            items[-1] = 'NAME("p{}i{}") <<= sgl::PageLink(NAME("page {}"))'.format(
+                p, size - 1, (p + 1) % len(pages))
+        src.append("constexpr auto page_{}() {{\n  return sgl::Page(\n      {});\n}}\n\n".format(
+            p, ",\n      ".join(items)))
+
+    src.append("int main(int argc, char**) {\n")
+    src.append("  auto menu = sgl::Menu({});\n".format(", ".join(
+        'NAME("page {}") <<= page_{}()'.format(p, p) for p in range(len(pages)))))
+    # exercise the dispatch paths of Menu and Page
+    src.append("""  for (int i = 0; i < argc; ++i) {
+    static_cast<void>(menu.handle_input(sgl::input::down));
+    static_cast<void>(menu.handle_input(sgl::input::enter));
+  }
+  menu.tick();
+  menu.for_current_page([](auto& page) { static_cast<void>(page.item_name(0)); });
+  static_cast<void>(menu.set_current_page(menu.page_name()));
+  return static_cast<int>(menu.item_text(0).size() + menu.item_name(1).size());
+}
+""")
+    return "".join(src)
+
+
+def compile_once(command, source):
+    """compiles source with command, returns (seconds, peak memory in MiB)"""
+    start = time.perf_counter()
+    process = subprocess.Popen(command + ["-c", source, "-o", os.devnull])
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.perf_counter() - start
+    if os.waitstatus_to_exitcode(status) != 0:
+        sys.exit("compilation of {} failed".format(source))
+    # ru_maxrss is in KiB on Linux and in bytes on macOS
+    scale = 1024 * 1024 if sys.platform == "darwin" else 1024
+    return elapsed, usage.ru_maxrss / scale
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--items", type=int, nargs="+", default=[10, 100, 1000])
+    parser.add_argument("--items-per-page", type=int, default=50)
+    parser.add_argument("--output", help="also write the results as csv to this file")
+    parser.add_argument("--keep", help="write the generated sources to this directory")
+    parser.add_argument("command", nargs=argparse.REMAINDER)
+    args = parser.parse_args()
+
+    command = args.command[1:] if args.command[:1] == ["--"] else args.command
+    if not command:
+        parser.error("no compiler command given")
+
+    directory = args.keep or tempfile.mkdtemp(prefix="sgl_compile_time_")
+    os.makedirs(directory, exist_ok=True)
+
+    rows = []
+    print("{:>8} {:>8} {:>10} {:>12}".format("items", "pages", "seconds", "peak MiB"))
+    for n in args.items:
+        source = os.path.join(directory, "menu_{}.cpp".format(n))
+        with open(source, "w") as f:
+            f.write(generate(n, args.items_per_page))
+        seconds, mib = compile_once(command, source)
+        pages = (n + args.items_per_page - 1) // args.items_per_page
+        rows.append((n, pages, seconds, mib))
+        print("{:>8} {:>8} {:>10.2f} {:>12.1f}".format(n, pages, seconds, mib), flush=True)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write("items,pages,seconds,peak_mib\n")
+            for row in rows:
+                f.write("{},{},{:.3f},{:.1f}\n".format(*row))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,76 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Headless benchmark of the qt visualizer. Sends key presses to a sgl::qt::MainWindow with a menu
+// of 200 items, processes the resulting layout and paint events after every key press like the
+// event loop would during key repeat, and prints the average time per input.
+//
+// usage: qt_visualizer_benchmark [number of inputs]
+//
+// The offscreen platform plugin is used unless QT_QPA_PLATFORM is set.
+#include "sgl/qt/mainwindow.hpp"
+
+#include <QApplication>
+#include <QKeyEvent>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#define SGL_BENCH_ITEM(p, i) NAME("page " #p " item " #i) <<= sgl::numeric<20, char>(0, 1)
+#define SGL_BENCH_ITEMS(p, d)                                                                   \
+  SGL_BENCH_ITEM(p, d##0), SGL_BENCH_ITEM(p, d##1), SGL_BENCH_ITEM(p, d##2),                    \
+      SGL_BENCH_ITEM(p, d##3), SGL_BENCH_ITEM(p, d##4), SGL_BENCH_ITEM(p, d##5),                \
+      SGL_BENCH_ITEM(p, d##6), SGL_BENCH_ITEM(p, d##7), SGL_BENCH_ITEM(p, d##8),                \
+      SGL_BENCH_ITEM(p, d##9)
+#define SGL_BENCH_PAGE(p)                                                                       \
+  NAME("page " #p) <<= sgl::Page(SGL_BENCH_ITEMS(p, 1),                                        \
+                                 SGL_BENCH_ITEMS(p, 2),                                        \
+                                 SGL_BENCH_ITEMS(p, 3),                                        \
+                                 SGL_BENCH_ITEMS(p, 4),                                        \
+                                 SGL_BENCH_ITEMS(p, 5))
+
+auto make_menu() {
+  return sgl::Menu(SGL_BENCH_PAGE(0), SGL_BENCH_PAGE(1), SGL_BENCH_PAGE(2), SGL_BENCH_PAGE(3));
+}
+
+namespace {
+  void press(QWidget& window, Qt::Key key) {
+    QKeyEvent event(QEvent::KeyPress, key, Qt::NoModifier);
+    QCoreApplication::sendEvent(&window, &event);
+    QCoreApplication::processEvents();
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+  const long inputs = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 5000;
+
+  QApplication        app(argc, argv);
+  sgl::qt::MainWindow window(make_menu(), 8);
+  QCoreApplication::processEvents();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < inputs; ++i) {
+    if (i % 1000 == 999) {
+      // switch pages now and then
+      window.set_current_page(static_cast<size_t>(i / 1000 + 1) % 4);
+    } else if (i % 16 == 15) {
+      // edit the current item: enter edit mode, increment, leave edit mode
+      press(window, Qt::Key_Return);
+      press(window, Qt::Key_Up);
+      press(window, Qt::Key_Return);
+    } else {
+      // key repeat of the down key
+      press(window, Qt::Key_Down);
+    }
+  }
+  const auto stop = std::chrono::steady_clock::now();
+
+  const double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+  std::printf("%ld inputs in %.1f ms, %.1f us per input\n", inputs, ms, 1000.0 * ms / inputs);
+  return 0;
+}
@@ -0,0 +1,49 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#include "sgl/c_api.h"
+
+#include <stdio.h>
+
+static void print_page(const sgl_menu* menu) {
+  sgl_page page;
+  sgl_line lines[8];
+  sgl_current_page(menu, &page);
+  printf("%.*s\n", (int)page.name_size, page.name);
+  const size_t n = sgl_render(menu, lines, 0, 8);
+  for (size_t i = 0; i < n; ++i) {
+    printf("%c %.*s: %.*s\n",
+           (lines[i].flags & SGL_LINE_CURRENT) ? ((lines[i].flags & SGL_LINE_EDIT) ? '*' : '>')
+                                               : ' ',
+           (int)lines[i].name_size,
+           lines[i].name,
+           (int)lines[i].text_size,
+           lines[i].text);
+  }
+}
+
+int main(void) {
+  sgl_menu* menu = sgl_menu_create();
+  if (menu == NULL) {
+    return 1;
+  }
+  print_page(menu);
+
+  // all inputs of a frame are handled in one call
+  const sgl_input inputs[] = {
+      SGL_INPUT_ENTER, SGL_INPUT_UP, SGL_INPUT_UP, SGL_INPUT_ENTER, SGL_INPUT_DOWN};
+  if (sgl_handle_inputs(menu, inputs, sizeof(inputs) / sizeof(inputs[0]), NULL) != 0) {
+    printf("some inputs failed\n");
+  }
+  print_page(menu);
+
+  char buffer[16];
+  if (sgl_set(menu, "settings/mute", "TRUE") == SGL_ERROR_NO_ERROR &&
+      sgl_get(menu, "settings/mute", buffer, sizeof(buffer), NULL) == SGL_ERROR_NO_ERROR) {
+    printf("mute: %s\n", buffer);
+  }
+  sgl_menu_destroy(menu);
+  return 0;
+}
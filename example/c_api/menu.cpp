@@ -0,0 +1,16 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Exports the C interface of sgl/c_api.h for the menu below. See main.c for a C program using it.
+#include "sgl.hpp"
+#include "sgl/c_api.hpp"
+
+constexpr auto make_menu() noexcept {
+  return sgl::Menu(NAME("settings") <<= sgl::Page(NAME("volume") <<= sgl::numeric<12, char>(5, 1),
+                                                  NAME("mute") <<= sgl::Boolean(false)),
+                   NAME("info") <<= sgl::Page(NAME("online") <<= sgl::Boolean(true)));
+}
+
+SGL_DEFINE_C_API(make_menu())
@@ -5,6 +5,8 @@
 #include "sgl/menu_tester.hpp"
 
 
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -69,7 +71,10 @@ constexpr auto MainMenu() {
                    other_settings_page <<= OtherSettingsPage());
 }
 
-int main() {
+// usage: menu_tester                                    interactive mode
+//        menu_tester script [trace [text|binary]]       replay mode
+//        menu_tester script golden compare              compare with a golden text trace
+int main(int argc, char** argv) {
   // making a menu tester with the menu and supplying a mapping of sgl::input values to
   // sgl::string_view. The tester will check if a command line input matches any of the strings in
   // the input map and forward the corresponding sgl::input value. If the command line input is not
@@ -80,6 +85,41 @@ int main() {
                             {sgl::input::left, "left"_sv},
                             {sgl::input::right, "right"_sv},
                             {sgl::input::enter, "enter"_sv}});
+  if (argc > 1) {
+    // replay mode: the script is resolved once and then handled without any printing. If a trace
+    // file is given, every frame is recorded to it.
+    std::ifstream script(argv[1]);
+    if (not script) {
+      std::cerr << "could not open " << argv[1] << '\n';
+      return 1;
+    }
+    const auto inputs = tester.load_script(script);
+    if (argc > 3 and std::strcmp(argv[3], "compare") == 0) {
+      // regression test against a golden trace recorded in text format
+      std::ifstream golden(argv[2]);
+      const auto    diff = tester.compare(inputs, golden);
+      if (not diff.equal) {
+        std::cout << "step " << diff.step << ", line " << diff.line << ":\n"
+                  << "  expected: " << (diff.expected_end ? "<end>" : diff.expected) << '\n'
+                  << "  actual:   " << (diff.actual_end ? "<end>" : diff.actual) << '\n';
+        return 1;
+      }
+      std::cout << diff.step << " frames equal\n";
+      return 0;
+    }
+    std::ofstream trace;
+    const auto    format = argc > 3 and std::strcmp(argv[3], "binary") == 0
+                               ? TraceFormat::binary
+                               : TraceFormat::text;
+    if (argc > 2) {
+      trace.open(argv[2], format == TraceFormat::binary ? std::ios::binary : std::ios::out);
+    }
+    const auto result = tester.replay(inputs, argc > 2 ? &trace : nullptr, format);
+    std::cout << result.inputs << " inputs, " << result.errors << " errors, " << result.frames
+              << " frames\n";
+    return 0;
+  }
+
   // print just shows the current page with all items
   tester.print();
 
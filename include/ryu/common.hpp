@@ -16,6 +16,27 @@
 #if defined(_M_IX86) || defined(_M_ARM)
   #define RYU_32_BIT_PLATFORM
 #endif
+
+// RYU_HAS_CONSTEXPR_BIT_CAST is defined if the bits of a floating point value can be read in a
+// constant expression, either with C++20 std::bit_cast or with the __builtin_bit_cast of gcc >= 11,
+// clang >= 9 and msvc >= 19.27. The builtin is available in C++17 mode as well. Without it,
+// ryu::cx::to_bits() falls back to extracting the bits with floating point arithmetic.
+#if defined(__has_include)
+  #if __has_include(<version>)
+    #include <version>
+  #endif
+#endif
+#if defined(__cpp_lib_bit_cast) && __cpp_lib_bit_cast >= 201806L
+  #include <bit>
+  #define RYU_HAS_CONSTEXPR_BIT_CAST
+  #define RYU_STD_BIT_CAST
+#elif defined(__has_builtin)
+  #if __has_builtin(__builtin_bit_cast)
+    #define RYU_HAS_CONSTEXPR_BIT_CAST
+  #endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1927
+  #define RYU_HAS_CONSTEXPR_BIT_CAST
+#endif
 namespace ryu {
 
   enum class status { success, input_too_short, input_too_long, malformed_input };
@@ -63,6 +84,12 @@ namespace ryu {
     inline uint32_t floor_log2(const uint32_t value) noexcept;
     inline uint32_t floor_log2(const uint64_t value) noexcept;
     constexpr int32_t      max32(int32_t a, int32_t b) noexcept;
+
+#if defined(RYU_HAS_CONSTEXPR_BIT_CAST)
+    /// reinterprets the bits of from as To, usable in constant expressions.
+    template <typename To, typename From>
+    constexpr To bit_cast(const From& from) noexcept;
+#endif
   } // namespace detail
 
   namespace cx {
@@ -83,16 +110,20 @@ namespace ryu {
   namespace cx {
     /// @brief get the bits of f in a constexpr friendly way. Use this function if and only if
     /// compile time formatting.
-    /// @note Do not use at runtime, as the code is very inefficient
-    /// compared to a memcpy! Use ryu::to_bits() at runtime.
+    /// @note If RYU_HAS_CONSTEXPR_BIT_CAST is defined, this is a bit_cast and as cheap as
+    /// ryu::to_bits(). Otherwise, the bits are extracted with floating point arithmetic, which is
+    /// slow to evaluate at compile time, very inefficient at runtime compared to a memcpy and maps
+    /// -0 to 0. Use ryu::to_bits() at runtime.
     /// @param f float to convert
     /// @return bit representation of f
     constexpr uint32_t to_bits(const float f) noexcept;
 
     /// @brief get the bits of f in a constexpr friendly way. Use this function if and only if
     /// compile time formatting.
-    /// @note Do not use at runtime, as the code is very inefficient
-    /// compared to a memcpy! Use ryu::to_bits() at runtime.
+    /// @note If RYU_HAS_CONSTEXPR_BIT_CAST is defined, this is a bit_cast and as cheap as
+    /// ryu::to_bits(). Otherwise, the bits are extracted with floating point arithmetic, which is
+    /// slow to evaluate at compile time, very inefficient at runtime compared to a memcpy and maps
+    /// -0 to 0. Use ryu::to_bits() at runtime.
     /// @param f float to convert
     /// @return bit representation of f
     constexpr uint64_t to_bits(const double f) noexcept;
@@ -14,52 +14,26 @@
 //     depending on your compiler.
 //
 // -DRYU_AVOID_UINT128 Avoid using uint128_t. Slower, depending on your compiler.
+//
+// -DRYU_OPTIMIZE_SIZE Don't store the POW10_SPLIT tables (about 100KB). The 9 digit blocks are
+//     computed exactly with a small fixed size big integer instead. The output is identical, at
+//     the cost of roughly half the speed.
 
 #ifndef RYU_D2FIXED_HPP
 #define RYU_D2FIXED_HPP
 
 #include "ryu/d2s.hpp"
+#include "ryu/fixed_common.hpp"
 
 #include <cstdint>
 
 namespace ryu::detail {
-  // Convert `digits` to a sequence of decimal digits. Append the digits to the result.
-  // The caller has to guarantee that:
-  //   10^(olength-1) <= digits < 10^olength
-  // e.g., by passing `olength` as `decimalLength9(digits)`.
-  template <typename CharT>
-  constexpr void
-      append_n_digits(const uint32_t olength, uint32_t digits, CharT* const result) noexcept;
-
-  // Convert `digits` to a sequence of decimal digits. Print the first digit, followed by a decimal
-  // dot '.' followed by the remaining digits. The caller has to guarantee that:
-  //   10^(olength-1) <= digits < 10^olength
-  // e.g., by passing `olength` as `decimalLength9(digits)`.
-  template <typename CharT>
-  constexpr void
-      append_d_digits(const uint32_t olength, uint32_t digits, CharT* const result) noexcept;
-
-  // Convert `digits` to decimal and write the last `count` decimal digits to result.
-  // If `digits` contains additional digits, then those are silently ignored.
-  template <typename CharT>
-  constexpr void
-      append_c_digits(const uint32_t count, uint32_t digits, CharT* const result) noexcept;
-
-  // Convert `digits` to decimal and write the last 9 decimal digits to result.
-  // If `digits` contains additional digits, then those are silently ignored.
-  template <typename CharT>
-  constexpr void append_nine_digits(uint32_t digits, char* const result) noexcept;
-
   constexpr uint32_t indexForExponent(const uint32_t e) noexcept;
 
   constexpr uint32_t pow10BitsForIndex(const uint32_t idx) noexcept;
 
   constexpr uint32_t lengthForIndex(const uint32_t idx) noexcept;
 
-  template <typename CharT>
-  constexpr unsigned copy_special_str_printf(CharT* const   result,
-                                             const bool     sign,
-                                             const uint64_t mantissa) noexcept;
   template <typename CharT>
   constexpr unsigned d2fixed_buffered_n(double             d,
                                         uint32_t           precision,
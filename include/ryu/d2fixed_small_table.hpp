@@ -0,0 +1,31 @@
+// The contents of this file originate from the ryu project by Ulf Adams (specifically the c version
+// of ryu), available at https://github.com/ulfjack/ryu.git. Changes made were merely to make the
+// ryu algorithm c++17 constexpr compliant, the core of the original algorithm remains unchanged.
+//
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Table used by d2fixed and d2exp if RYU_OPTIMIZE_SIZE is defined. The POW10_SPLIT tables of
+// d2fixed_full_table.hpp are not needed in this mode, the blocks of nine digits are computed with
+// the big integer arithmetic in impl/d2fixed_impl.hpp instead. Only the number of leading zero
+// blocks of the fractional part for each exponent index remains.
+
+#ifndef RYU_D2FIXED_SMALL_TABLE_HPP
+#define RYU_D2FIXED_SMALL_TABLE_HPP
+
+#include <cstdint>
+
+namespace ryu::detail {
+
+#define TABLE_SIZE_2 69
+
+  static constexpr uint8_t MIN_BLOCK_2[TABLE_SIZE_2] = {
+      0,  0,  0,  0,  0,  0,  1,  1,  2,  3,  3,  4,  4,  5,  5,  6,  6,  7,  7,  8,  8,  9,  9,
+      10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16, 17, 17, 18, 19, 19, 20, 20, 21, 21, 22,
+      22, 23, 23, 24, 24, 25, 26, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 31, 32, 32, 33, 34, 0};
+
+} // namespace ryu::detail
+
+#endif /* RYU_D2FIXED_SMALL_TABLE_HPP */
@@ -31,7 +31,7 @@ namespace ryu::detail {
       {10313493231639821582u, 1313665730009899186u},
       {12701016819766672773u, 2032799256770390445u}};
 
-  static constexpr uint32_t POW5_INV_OFFSETS[19] = {0x54544554,
+  static constexpr uint32_t POW5_INV_OFFSETS[22] = {0x54544554,
                                                     0x04055545,
                                                     0x10041000,
                                                     0x00400414,
@@ -49,6 +49,9 @@ namespace ryu::detail {
                                                     0x00010500,
                                                     0x51515411,
                                                     0x05555554,
+                                                    0x50411500,
+                                                    0x40040000,
+                                                    0x05040110,
                                                     0x00000000};
 
   static constexpr uint64_t DOUBLE_POW5_SPLIT2[13][2] = {
@@ -104,7 +107,7 @@ namespace ryu::detail {
 #if defined(HAS_UINT128)
 
   // Computes 5^i in the form required by Ryu, and stores it in the given pointer.
-  static inline void double_computePow5(const uint32_t i, uint64_t* const result) {
+  static constexpr void double_computePow5(const uint32_t i, uint64_t* const result) {
     const uint32_t        base = i / pow5_table_size;
     const uint32_t        base2 = base * pow5_table_size;
     const uint32_t        offset = i - base2;
@@ -125,7 +128,7 @@ namespace ryu::detail {
   }
 
   // Computes 5^-i in the form required by Ryu, and stores it in the given pointer.
-  static inline void double_computeInvPow5(const uint32_t i, uint64_t* const result) {
+  static constexpr void double_computeInvPow5(const uint32_t i, uint64_t* const result) {
     const uint32_t        base = (i + pow5_table_size - 1) / pow5_table_size;
     const uint32_t        base2 = base * pow5_table_size;
     const uint32_t        offset = base2 - i;
@@ -149,7 +152,7 @@ namespace ryu::detail {
 #else // defined(HAS_UINT128)
 
   // Computes 5^i in the form required by Ryu, and stores it in the given pointer.
-  static inline void double_computePow5(const uint32_t i, uint64_t* const result) {
+  static constexpr void double_computePow5(const uint32_t i, uint64_t* const result) {
     const uint32_t        base = i / pow5_table_size;
     const uint32_t        base2 = base * pow5_table_size;
     const uint32_t        offset = i - base2;
@@ -160,9 +163,9 @@ namespace ryu::detail {
       return;
     }
     const uint64_t m = DOUBLE_POW5_TABLE[offset];
-    uint64_t       high1;
+    uint64_t       high1{0};
     const uint64_t low1 = umul128(m, mul[1], &high1);
-    uint64_t       high0;
+    uint64_t       high0{0};
     const uint64_t low0 = umul128(m, mul[0], &high0);
     const uint64_t sum = high0 + low1;
     if (sum < high0) {
@@ -175,7 +178,7 @@ namespace ryu::detail {
   }
 
   // Computes 5^-i in the form required by Ryu, and stores it in the given pointer.
-  static inline void double_computeInvPow5(const uint32_t i, uint64_t* const result) {
+  static constexpr void double_computeInvPow5(const uint32_t i, uint64_t* const result) {
     const uint32_t        base = (i + pow5_table_size - 1) / pow5_table_size;
     const uint32_t        base2 = base * pow5_table_size;
     const uint32_t        offset = base2 - i;
@@ -186,9 +189,9 @@ namespace ryu::detail {
       return;
     }
     const uint64_t m = DOUBLE_POW5_TABLE[offset];
-    uint64_t       high1;
+    uint64_t       high1{0};
     const uint64_t low1 = umul128(m, mul[1], &high1);
-    uint64_t       high0;
+    uint64_t       high0{0};
     const uint64_t low0 = umul128(m, mul[0] - 1, &high0);
     const uint64_t sum = high0 + low1;
     if (sum < high0) {
@@ -0,0 +1,39 @@
+// The contents of this file originate from the ryu project by Ulf Adams (specifically the c version
+// of ryu), available at https://github.com/ulfjack/ryu.git. Changes made were merely to make the
+// ryu algorithm c++17 constexpr compliant, the core of the original algorithm remains unchanged.
+//
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Fixed and exponential formatting of floats. The output is identical to d2fixed and d2exp of the
+// float converted to double, but only uses 32 and 64 bit arithmetic and no lookup tables: the
+// nine digit blocks are computed exactly from the 24 bit mantissa with integer_blocks and
+// fraction_blocks of at most six 32 bit limbs.
+
+#ifndef RYU_F2FIXED_HPP
+#define RYU_F2FIXED_HPP
+
+#include "ryu/f2s.hpp"
+#include "ryu/fixed_common.hpp"
+
+#include <cstdint>
+
+namespace ryu::detail {
+  template <typename CharT>
+  constexpr unsigned f2fixed_buffered_n(float             f,
+                                        uint32_t          precision,
+                                        CharT*            result,
+                                        FloatCastFunction bit_cast) noexcept;
+
+  template <typename CharT>
+  constexpr unsigned f2exp_buffered_n(float             f,
+                                      uint32_t          precision,
+                                      CharT*            result,
+                                      FloatCastFunction bit_cast) noexcept;
+
+} // namespace ryu::detail
+
+#include "impl/f2fixed_impl.hpp"
+#endif /* RYU_F2FIXED_HPP */
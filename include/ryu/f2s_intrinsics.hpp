@@ -102,7 +102,7 @@ namespace ryu::detail {
     // lookup table are the correct bits for [2^x / 5^y], so we have to add 1 here. Note that we
     // rely on the fact that the added 1 that's already stored in the table never overflows into the
     // upper 64 bits.
-    uint64_t pow5[2];
+    uint64_t pow5[2]{};
     double_computeInvPow5(q, pow5);
     return mulShift32(m, pow5[1] + 1, j);
 #else
@@ -114,7 +114,7 @@ namespace ryu::detail {
 #if defined(RYU_FLOAT_FULL_TABLE)
     return mulShift32(m, detail::FLOAT_POW5_SPLIT[i], j);
 #elif defined(RYU_OPTIMIZE_SIZE)
-    uint64_t pow5[2];
+    uint64_t pow5[2]{};
     double_computePow5(i, pow5);
     return mulShift32(m, pow5[1], j);
 #else
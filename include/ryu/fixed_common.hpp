@@ -0,0 +1,353 @@
+// The contents of this file originate from the ryu project by Ulf Adams (specifically the c version
+// of ryu), available at https://github.com/ulfjack/ryu.git. Changes made were merely to make the
+// ryu algorithm c++17 constexpr compliant, the core of the original algorithm remains unchanged.
+//
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Helpers shared by d2fixed/d2exp and f2fixed/f2exp.
+#ifndef RYU_FIXED_COMMON_HPP
+#define RYU_FIXED_COMMON_HPP
+#include "ryu/common.hpp"
+#include "ryu/digit_table.hpp"
+
+#include <cstdint>
+
+namespace ryu::detail {
+  // Convert `digits` to a sequence of decimal digits. Append the digits to the result.
+  // The caller has to guarantee that:
+  //   10^(olength-1) <= digits < 10^olength
+  // e.g., by passing `olength` as `decimalLength9(digits)`.
+  template <typename CharT>
+  constexpr void
+      append_n_digits(const uint32_t olength, uint32_t digits, CharT* const result) noexcept {
+
+    uint32_t i = 0;
+    while (digits >= 10000) {
+#ifdef __clang__ // https://bugs.llvm.org/show_bug.cgi?id=38217
+      const uint32_t c = digits - 10000 * (digits / 10000);
+#else
+      const uint32_t c = digits % 10000;
+#endif
+      digits /= 10000;
+      const uint32_t c0 = (c % 100) << 1;
+      const uint32_t c1 = (c / 100) << 1;
+      // memcpy(result + olength - i - 2, DIGIT_TABLE + c0, 2);
+      result[olength - i - 2] = static_cast<CharT>(DIGIT_TABLE[c0]);
+      result[olength - i - 1] = static_cast<CharT>(DIGIT_TABLE[c0 + 1]);
+      // memcpy(result + olength - i - 4, DIGIT_TABLE + c1, 2);
+      result[olength - i - 4] = static_cast<CharT>(DIGIT_TABLE[c1]);
+      result[olength - i - 3] = static_cast<CharT>(DIGIT_TABLE[c1 + 1]);
+
+      i += 4;
+    }
+    if (digits >= 100) {
+      const uint32_t c = (digits % 100) << 1;
+      digits /= 100;
+      // memcpy(result + olength - i - 2, DIGIT_TABLE + c, 2);
+      result[olength - i - 2] = static_cast<CharT>(DIGIT_TABLE[c]);
+      result[olength - i - 1] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
+
+      i += 2;
+    }
+    if (digits >= 10) {
+      const uint32_t c = digits << 1;
+      // memcpy(result + olength - i - 2, DIGIT_TABLE + c, 2);
+      result[olength - i - 2] = static_cast<CharT>(DIGIT_TABLE[c]);
+      result[olength - i - 1] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
+    } else {
+      result[0] = static_cast<CharT>('0' + digits);
+    }
+  }
+
+  // Convert `digits` to a sequence of decimal digits. Print the first digit, followed by a decimal
+  // dot '.' followed by the remaining digits. The caller has to guarantee that:
+  //   10^(olength-1) <= digits < 10^olength
+  // e.g., by passing `olength` as `decimalLength9(digits)`.
+  template <typename CharT>
+  constexpr void
+      append_d_digits(const uint32_t olength, uint32_t digits, CharT* const result) noexcept {
+
+    uint32_t i = 0;
+    while (digits >= 10000) {
+#ifdef __clang__ // https://bugs.llvm.org/show_bug.cgi?id=38217
+      const uint32_t c = digits - 10000 * (digits / 10000);
+#else
+      const uint32_t c = digits % 10000;
+#endif
+      digits /= 10000;
+      const uint32_t c0 = (c % 100) << 1;
+      const uint32_t c1 = (c / 100) << 1;
+      // memcpy(result + olength + 1 - i - 2, DIGIT_TABLE + c0, 2);
+      result[olength + 1 - i - 2] = static_cast<CharT>(DIGIT_TABLE[c0]);
+      result[olength + 1 - i - 1] = static_cast<CharT>(DIGIT_TABLE[c0 + 1]);
+      // memcpy(result + olength + 1 - i - 4, DIGIT_TABLE + c1, 2);
+      result[olength + 1 - i - 4] = static_cast<CharT>(DIGIT_TABLE[c1]);
+      result[olength + 1 - i - 3] = static_cast<CharT>(DIGIT_TABLE[c1 + 1]);
+      i += 4;
+    }
+    if (digits >= 100) {
+      const uint32_t c = (digits % 100) << 1;
+      digits /= 100;
+      // memcpy(result + olength + 1 - i - 2, DIGIT_TABLE + c, 2);
+      result[olength + 1 - i - 2] = static_cast<CharT>(DIGIT_TABLE[c]);
+      result[olength + 1 - i - 1] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
+      i += 2;
+    }
+    if (digits >= 10) {
+      const uint32_t c = digits << 1;
+      result[2] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
+      result[1] = static_cast<CharT>('.');
+      result[0] = static_cast<CharT>(DIGIT_TABLE[c]);
+    } else {
+      result[1] = static_cast<CharT>('.');
+      result[0] = static_cast<CharT>('0' + digits);
+    }
+  }
+
+  // Convert `digits` to decimal and write the last `count` decimal digits to result.
+  // If `digits` contains additional digits, then those are silently ignored.
+  template <typename CharT>
+  constexpr void
+      append_c_digits(const uint32_t count, uint32_t digits, CharT* const result) noexcept {
+    // Copy pairs of digits from DIGIT_TABLE.
+    uint32_t i = 0;
+    for (; i < count - 1; i += 2) {
+      const uint32_t c = (digits % 100) << 1;
+      digits /= 100;
+      // memcpy(result + count - i - 2, DIGIT_TABLE + c, 2);
+      result[count - i - 2] = static_cast<CharT>(DIGIT_TABLE[c]);
+      result[count - i - 1] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
+    }
+    // Generate the last digit if count is odd.
+    if (i < count) {
+      const char c = static_cast<CharT>('0' + (digits % 10));
+      result[count - i - 1] = c;
+    }
+  }
+
+  // Convert `digits` to decimal and write the last 9 decimal digits to result.
+  // If `digits` contains additional digits, then those are silently ignored.
+  template <typename CharT>
+  constexpr void append_nine_digits(uint32_t digits, CharT* const result) noexcept {
+
+    if (digits == 0) {
+      // memset(result, '0', 9);
+      result[0] = static_cast<CharT>('0');
+      result[1] = static_cast<CharT>('0');
+      result[2] = static_cast<CharT>('0');
+      result[3] = static_cast<CharT>('0');
+      result[4] = static_cast<CharT>('0');
+      result[5] = static_cast<CharT>('0');
+      result[6] = static_cast<CharT>('0');
+      result[7] = static_cast<CharT>('0');
+      result[8] = static_cast<CharT>('0');
+      return;
+    }
+
+    for (uint32_t i = 0; i < 5; i += 4) {
+#ifdef __clang__ // https://bugs.llvm.org/show_bug.cgi?id=38217
+      const uint32_t c = digits - 10000 * (digits / 10000);
+#else
+      const uint32_t c = digits % 10000;
+#endif
+      digits /= 10000;
+      const uint32_t c0 = (c % 100) << 1;
+      const uint32_t c1 = (c / 100) << 1;
+      // memcpy(result + 7 - i, DIGIT_TABLE + c0, 2);
+      result[7 - i] = static_cast<CharT>(DIGIT_TABLE[c0]);
+      result[8 - i] = static_cast<CharT>(DIGIT_TABLE[c0 + 1]);
+      // memcpy(result + 5 - i, DIGIT_TABLE + c1, 2);
+      result[5 - i] = static_cast<CharT>(DIGIT_TABLE[c1]);
+      result[6 - i] = static_cast<CharT>(DIGIT_TABLE[c1 + 1]);
+    }
+    result[0] = static_cast<CharT>('0' + digits);
+  }
+
+  template <typename CharT>
+  constexpr unsigned copy_special_str_printf(CharT* const   result,
+                                             const bool     sign,
+                                             const uint64_t mantissa) noexcept {
+#if defined(_MSC_VER)
+    // TODO: Check that -nan is expected output on Windows.
+    if (sign) {
+      result[0] = static_cast<CharT>('-');
+    }
+    if (mantissa) {
+      if (mantissa < (1ull << (double_mantissa_bits - 1))) {
+        // memcpy(result + sign, "nan(snan)", 9);
+        result[sign + 0] = static_cast<CharT>('n');
+        result[sign + 1] = static_cast<CharT>('a');
+        result[sign + 2] = static_cast<CharT>('n');
+        result[sign + 3] = static_cast<CharT>('(');
+        result[sign + 4] = static_cast<CharT>('s');
+        result[sign + 5] = static_cast<CharT>('n');
+        result[sign + 6] = static_cast<CharT>('a');
+        result[sign + 7] = static_cast<CharT>('n');
+        result[sign + 8] = static_cast<CharT>(')');
+        return sign + 9;
+      }
+      // memcpy(result + sign, "nan", 3);
+      result[sign + 0] = static_cast<CharT>('n');
+      result[sign + 1] = static_cast<CharT>('a');
+      result[sign + 2] = static_cast<CharT>('n');
+      return sign + 3;
+    }
+#else
+    if (mantissa) {
+      // memcpy(result, "nan", 3);
+      result[sign + 0] = static_cast<CharT>('n');
+      result[sign + 1] = static_cast<CharT>('a');
+      result[sign + 2] = static_cast<CharT>('n');
+      return 3;
+    }
+    if (sign) {
+      result[0] = '-';
+    }
+#endif
+    // memcpy(result + sign, "Infinity", 8);
+    result[sign + 0] = static_cast<CharT>('I');
+    result[sign + 1] = static_cast<CharT>('n');
+    result[sign + 2] = static_cast<CharT>('f');
+    result[sign + 3] = static_cast<CharT>('i');
+    result[sign + 4] = static_cast<CharT>('n');
+    result[sign + 5] = static_cast<CharT>('i');
+    result[sign + 6] = static_cast<CharT>('t');
+    result[sign + 7] = static_cast<CharT>('y');
+    return sign + 8;
+  }
+
+  // The blocks of nine decimal digits of m2 * 2^e2, computed exactly with a small fixed size
+  // integer of 32 bit limbs, least significant limb first. They are used by f2fixed and f2exp, and
+  // by d2fixed and d2exp instead of the POW10_SPLIT tables if RYU_OPTIMIZE_SIZE is defined. Limbs
+  // must hold the integer part shifted into place plus three limbs, and the fractional part plus
+  // 30 bits of headroom for the multiplication by 10^9.
+
+  // The integer part of a double has at most 1024 bits and at most 35 blocks, the fractional part
+  // at most 1074 bits.
+  inline constexpr uint32_t DOUBLE_BIG_LIMBS = 35;
+
+  // The integer part of a float has at most 128 bits and at most 5 blocks, the fractional part at
+  // most 149 bits.
+  inline constexpr uint32_t FLOAT_BIG_LIMBS = 6;
+
+  // The blocks of nine digits of the integer part floor(m2 * 2^e2).
+  template <uint32_t Limbs>
+  class integer_blocks {
+  public:
+    constexpr integer_blocks(const uint64_t m2, const int32_t e2) noexcept {
+      uint32_t limbs[Limbs]{};
+      int32_t  size = 0;
+      if (e2 < 0) {
+        const uint64_t v = e2 <= -64 ? 0 : m2 >> -e2;
+        limbs[0] = static_cast<uint32_t>(v);
+        limbs[1] = static_cast<uint32_t>(v >> 32);
+        size = 2;
+      } else {
+        const uint32_t q = static_cast<uint32_t>(e2) / 32;
+        const uint32_t r = static_cast<uint32_t>(e2) % 32;
+        // m2 < 2^53, i.e. (m2 << r) fits into three limbs.
+        const uint64_t lo = m2 << r;
+        const uint64_t hi = r == 0 ? 0 : m2 >> (64 - r);
+        limbs[q] = static_cast<uint32_t>(lo);
+        limbs[q + 1] = static_cast<uint32_t>(lo >> 32);
+        limbs[q + 2] = static_cast<uint32_t>(hi);
+        size = static_cast<int32_t>(q) + 3;
+      }
+      while (size > 0 && limbs[size - 1] == 0) {
+        --size;
+      }
+      // repeated division by 10^9 yields the blocks from the least significant one upwards.
+      while (size > 0) {
+        uint64_t rem = 0;
+        for (int32_t k = size - 1; k >= 0; --k) {
+          const uint64_t cur = (rem << 32) | limbs[k];
+          limbs[k] = static_cast<uint32_t>(cur / 1000000000);
+          rem = cur % 1000000000;
+        }
+        blocks_[count_++] = static_cast<uint32_t>(rem);
+        while (size > 0 && limbs[size - 1] == 0) {
+          --size;
+        }
+      }
+    }
+
+    // Returns the i-th block, counted from the least significant one, i.e. the same value as
+    // mulShift_mod1e9(m2 << 8, POW10_SPLIT[POW10_OFFSET[idx] + i], j + 8).
+    constexpr uint32_t operator[](const int32_t i) const noexcept {
+      return i < count_ ? blocks_[i] : 0;
+    }
+
+    // Returns the number of blocks up to the most significant nonzero one.
+    constexpr int32_t size() const noexcept { return count_; }
+
+  private:
+    uint32_t blocks_[Limbs]{};
+    int32_t  count_{0};
+  };
+
+  // The blocks of nine digits after the decimal point of m2 * 2^e2, for e2 < 0. The fraction is
+  // stored as an integer f with the value f / 2^-e2. Every block multiplies it by 10^9 and takes
+  // the bits above the binary point as the digits.
+  template <uint32_t Limbs>
+  class fraction_blocks {
+  public:
+    constexpr fraction_blocks(const uint64_t m2, const int32_t e2) noexcept
+        : bits_(static_cast<uint32_t>(-e2)) {
+      const uint64_t f = bits_ >= 64 ? m2 : m2 & ((1ull << bits_) - 1);
+      limbs_[0] = static_cast<uint32_t>(f);
+      limbs_[1] = static_cast<uint32_t>(f >> 32);
+      size_ = bits_ / 32 + 2;
+      skipZeroLimbs();
+    }
+
+    // Returns true if all remaining blocks are zero.
+    constexpr bool isZero() const noexcept { return low_ >= size_; }
+
+    // Returns the next block, i.e. the same value as
+    // mulShift_mod1e9(m2 << 8, POW10_SPLIT_2[p], j + 8) for consecutive blocks.
+    constexpr uint32_t next() noexcept {
+      if (isZero()) {
+        return 0;
+      }
+      uint64_t carry = 0;
+      for (uint32_t k = low_; k < size_; ++k) {
+        const uint64_t cur = static_cast<uint64_t>(limbs_[k]) * 1000000000 + carry;
+        limbs_[k] = static_cast<uint32_t>(cur);
+        carry = cur >> 32;
+      }
+      // f < 2^bits_ before the multiplication, so the digits are the 30 bits starting at bits_.
+      const uint32_t q = bits_ / 32;
+      const uint32_t r = bits_ % 32;
+      const uint64_t window = (static_cast<uint64_t>(limbs_[q + 1]) << 32) | limbs_[q];
+      limbs_[q] &= r == 0 ? 0 : (1u << r) - 1;
+      limbs_[q + 1] = 0;
+      skipZeroLimbs();
+      return static_cast<uint32_t>(window >> r);
+    }
+
+    // Skips the next n blocks.
+    constexpr void skip(const uint32_t n) noexcept {
+      for (uint32_t k = 0; k < n && !isZero(); ++k) {
+        next();
+      }
+    }
+
+  private:
+    constexpr void skipZeroLimbs() noexcept {
+      // multiplying by 10^9 shifts in 9 zero bits per block, the lowest limbs become zero.
+      while (low_ < size_ && limbs_[low_] == 0) {
+        ++low_;
+      }
+    }
+
+    uint32_t limbs_[Limbs]{};
+    uint32_t bits_{0};
+    uint32_t size_{0};
+    uint32_t low_{0};
+  };
+} // namespace ryu::detail
+
+#endif /* RYU_FIXED_COMMON_HPP */
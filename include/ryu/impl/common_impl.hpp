@@ -42,6 +42,18 @@ namespace ryu {
   namespace detail {
     constexpr int32_t max32(int32_t a, int32_t b) noexcept { return a < b ? b : a; }
 
+#if defined(RYU_HAS_CONSTEXPR_BIT_CAST)
+    template <typename To, typename From>
+    constexpr To bit_cast(const From& from) noexcept {
+      static_assert(sizeof(To) == sizeof(From), "bit_cast requires types of the same size");
+  #if defined(RYU_STD_BIT_CAST)
+      return std::bit_cast<To>(from);
+  #else
+      return __builtin_bit_cast(To, from);
+  #endif
+    }
+#endif
+
     // Returns the number of decimal digits in v, which must not contain more than 9 digits.
     constexpr uint32_t decimalLength9(const uint32_t v) noexcept {
       // Function precondition: v is not a 10-digit number.
@@ -182,6 +194,9 @@ namespace ryu {
     }
 
     constexpr uint32_t to_bits(const float f) noexcept {
+#if defined(RYU_HAS_CONSTEXPR_BIT_CAST)
+      return ryu::detail::bit_cast<uint32_t>(f);
+#else
       if (f == 0.0f)
         return 0; // also matches -0.0f and gives wrong result
       if (f == ryu::f_infinity)
@@ -212,9 +227,13 @@ namespace ryu {
 
       uint32_t significand = (a << (lz + 1)) >> (64 - 23); // [3]
       return (sign << 31) | (exponent << 23) | significand;
+#endif
     }
 
     constexpr uint64_t to_bits(const double f) noexcept {
+#if defined(RYU_HAS_CONSTEXPR_BIT_CAST)
+      return ryu::detail::bit_cast<uint64_t>(f);
+#else
       if (f == 0.0)
         return 0; // also matches -0.0f and gives wrong result
       if (f == ryu::d_infinity)
@@ -253,6 +272,7 @@ namespace ryu {
       uint64_t significand = (a << (lz + 1)) >> (64 - 52); // [3]
       return (static_cast<uint64_t>(sign) << 63) | (static_cast<uint64_t>(exponent) << 52) |
              significand;
+#endif
     }
 
     constexpr uint32_t floor_log2(const uint32_t value) noexcept {
@@ -11,9 +11,16 @@
 #define RYU_IMPL_D2FIXED_IMPL_HPP
 #include "ryu/common.hpp"
 #include "ryu/d2fixed.hpp"
-#include "ryu/d2fixed_full_table.hpp"
 #include "ryu/d2s_intrinsics.hpp"
 #include "ryu/digit_table.hpp"
+#include "ryu/fixed_common.hpp"
+
+// Include either the small or the full lookup tables depending on the mode.
+#if defined(RYU_OPTIMIZE_SIZE)
+  #include "ryu/d2fixed_small_table.hpp"
+#else
+  #include "ryu/d2fixed_full_table.hpp"
+#endif
 
 namespace ryu::detail {
 
@@ -162,149 +169,6 @@ namespace ryu::detail {
   #endif // HAS_64_BIT_INTRINSICS
   }
 #endif   // HAS_UINT128
-  template <typename CharT>
-  constexpr void
-      append_n_digits(const uint32_t olength, uint32_t digits, CharT* const result) noexcept {
-
-    uint32_t i = 0;
-    while (digits >= 10000) {
-#ifdef __clang__ // https://bugs.llvm.org/show_bug.cgi?id=38217
-      const uint32_t c = digits - 10000 * (digits / 10000);
-#else
-      const uint32_t c = digits % 10000;
-#endif
-      digits /= 10000;
-      const uint32_t c0 = (c % 100) << 1;
-      const uint32_t c1 = (c / 100) << 1;
-      // memcpy(result + olength - i - 2, DIGIT_TABLE + c0, 2);
-      result[olength - i - 2] = static_cast<CharT>(DIGIT_TABLE[c0]);
-      result[olength - i - 1] = static_cast<CharT>(DIGIT_TABLE[c0 + 1]);
-      // memcpy(result + olength - i - 4, DIGIT_TABLE + c1, 2);
-      result[olength - i - 4] = static_cast<CharT>(DIGIT_TABLE[c1]);
-      result[olength - i - 3] = static_cast<CharT>(DIGIT_TABLE[c1 + 1]);
-
-      i += 4;
-    }
-    if (digits >= 100) {
-      const uint32_t c = (digits % 100) << 1;
-      digits /= 100;
-      // memcpy(result + olength - i - 2, DIGIT_TABLE + c, 2);
-      result[olength - i - 2] = static_cast<CharT>(DIGIT_TABLE[c]);
-      result[olength - i - 1] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
-
-      i += 2;
-    }
-    if (digits >= 10) {
-      const uint32_t c = digits << 1;
-      // memcpy(result + olength - i - 2, DIGIT_TABLE + c, 2);
-      result[olength - i - 2] = static_cast<CharT>(DIGIT_TABLE[c]);
-      result[olength - i - 1] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
-    } else {
-      result[0] = static_cast<CharT>('0' + digits);
-    }
-  }
-
-  // Convert `digits` to a sequence of decimal digits. Print the first digit, followed by a decimal
-  // dot '.' followed by the remaining digits. The caller has to guarantee that:
-  //   10^(olength-1) <= digits < 10^olength
-  // e.g., by passing `olength` as `decimalLength9(digits)`.
-  template <typename CharT>
-  constexpr void
-      append_d_digits(const uint32_t olength, uint32_t digits, CharT* const result) noexcept {
-
-    uint32_t i = 0;
-    while (digits >= 10000) {
-#ifdef __clang__ // https://bugs.llvm.org/show_bug.cgi?id=38217
-      const uint32_t c = digits - 10000 * (digits / 10000);
-#else
-      const uint32_t c = digits % 10000;
-#endif
-      digits /= 10000;
-      const uint32_t c0 = (c % 100) << 1;
-      const uint32_t c1 = (c / 100) << 1;
-      // memcpy(result + olength + 1 - i - 2, DIGIT_TABLE + c0, 2);
-      result[olength + 1 - i - 2] = static_cast<CharT>(DIGIT_TABLE[c0]);
-      result[olength + 1 - i - 1] = static_cast<CharT>(DIGIT_TABLE[c0 + 1]);
-      // memcpy(result + olength + 1 - i - 4, DIGIT_TABLE + c1, 2);
-      result[olength + 1 - i - 4] = static_cast<CharT>(DIGIT_TABLE[c1]);
-      result[olength + 1 - i - 3] = static_cast<CharT>(DIGIT_TABLE[c1 + 1]);
-      i += 4;
-    }
-    if (digits >= 100) {
-      const uint32_t c = (digits % 100) << 1;
-      digits /= 100;
-      // memcpy(result + olength + 1 - i - 2, DIGIT_TABLE + c, 2);
-      result[olength + 1 - i - 2] = static_cast<CharT>(DIGIT_TABLE[c]);
-      result[olength + 1 - i - 1] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
-      i += 2;
-    }
-    if (digits >= 10) {
-      const uint32_t c = digits << 1;
-      result[2] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
-      result[1] = static_cast<CharT>('.');
-      result[0] = static_cast<CharT>(DIGIT_TABLE[c]);
-    } else {
-      result[1] = static_cast<CharT>('.');
-      result[0] = static_cast<CharT>('0' + digits);
-    }
-  }
-
-  // Convert `digits` to decimal and write the last `count` decimal digits to result.
-  // If `digits` contains additional digits, then those are silently ignored.
-  template <typename CharT>
-  constexpr void
-      append_c_digits(const uint32_t count, uint32_t digits, CharT* const result) noexcept {
-    // Copy pairs of digits from DIGIT_TABLE.
-    uint32_t i = 0;
-    for (; i < count - 1; i += 2) {
-      const uint32_t c = (digits % 100) << 1;
-      digits /= 100;
-      // memcpy(result + count - i - 2, DIGIT_TABLE + c, 2);
-      result[count - i - 2] = static_cast<CharT>(DIGIT_TABLE[c]);
-      result[count - i - 1] = static_cast<CharT>(DIGIT_TABLE[c + 1]);
-    }
-    // Generate the last digit if count is odd.
-    if (i < count) {
-      const char c = static_cast<CharT>('0' + (digits % 10));
-      result[count - i - 1] = c;
-    }
-  }
-
-  template <typename CharT>
-  constexpr void append_nine_digits(uint32_t digits, CharT* const result) noexcept {
-
-    if (digits == 0) {
-      // memset(result, '0', 9);
-      result[0] = static_cast<CharT>('0');
-      result[1] = static_cast<CharT>('0');
-      result[2] = static_cast<CharT>('0');
-      result[3] = static_cast<CharT>('0');
-      result[4] = static_cast<CharT>('0');
-      result[5] = static_cast<CharT>('0');
-      result[6] = static_cast<CharT>('0');
-      result[7] = static_cast<CharT>('0');
-      result[8] = static_cast<CharT>('0');
-      return;
-    }
-
-    for (uint32_t i = 0; i < 5; i += 4) {
-#ifdef __clang__ // https://bugs.llvm.org/show_bug.cgi?id=38217
-      const uint32_t c = digits - 10000 * (digits / 10000);
-#else
-      const uint32_t c = digits % 10000;
-#endif
-      digits /= 10000;
-      const uint32_t c0 = (c % 100) << 1;
-      const uint32_t c1 = (c / 100) << 1;
-      // memcpy(result + 7 - i, DIGIT_TABLE + c0, 2);
-      result[7 - i] = static_cast<CharT>(DIGIT_TABLE[c0]);
-      result[8 - i] = static_cast<CharT>(DIGIT_TABLE[c0 + 1]);
-      // memcpy(result + 5 - i, DIGIT_TABLE + c1, 2);
-      result[5 - i] = static_cast<CharT>(DIGIT_TABLE[c1]);
-      result[6 - i] = static_cast<CharT>(DIGIT_TABLE[c1 + 1]);
-    }
-    result[0] = static_cast<CharT>('0' + digits);
-  }
 
   constexpr uint32_t indexForExponent(const uint32_t e) noexcept { return (e + 15) / 16; }
 
@@ -317,59 +181,6 @@ namespace ryu::detail {
     return (log10Pow2(16 * (int32_t)idx) + 1 + 16 + 8) / 9;
   }
 
-  template <typename CharT>
-  constexpr unsigned copy_special_str_printf(CharT* const   result,
-                                             const bool     sign,
-                                             const uint64_t mantissa) noexcept {
-#if defined(_MSC_VER)
-    // TODO: Check that -nan is expected output on Windows.
-    if (sign) {
-      result[0] = static_cast<CharT>('-');
-    }
-    if (mantissa) {
-      if (mantissa < (1ull << (double_mantissa_bits - 1))) {
-        // memcpy(result + sign, "nan(snan)", 9);
-        result[sign + 0] = static_cast<CharT>('n');
-        result[sign + 1] = static_cast<CharT>('a');
-        result[sign + 2] = static_cast<CharT>('n');
-        result[sign + 3] = static_cast<CharT>('(');
-        result[sign + 4] = static_cast<CharT>('s');
-        result[sign + 5] = static_cast<CharT>('n');
-        result[sign + 6] = static_cast<CharT>('a');
-        result[sign + 7] = static_cast<CharT>('n');
-        result[sign + 8] = static_cast<CharT>(')');
-        return sign + 9;
-      }
-      // memcpy(result + sign, "nan", 3);
-      result[sign + 0] = static_cast<CharT>('n');
-      result[sign + 1] = static_cast<CharT>('a');
-      result[sign + 2] = static_cast<CharT>('n');
-      return sign + 3;
-    }
-#else
-    if (mantissa) {
-      // memcpy(result, "nan", 3);
-      result[sign + 0] = static_cast<CharT>('n');
-      result[sign + 1] = static_cast<CharT>('a');
-      result[sign + 2] = static_cast<CharT>('n');
-      return 3;
-    }
-    if (sign) {
-      result[0] = '-';
-    }
-#endif
-    // memcpy(result + sign, "Infinity", 8);
-    result[sign + 0] = static_cast<CharT>('I');
-    result[sign + 1] = static_cast<CharT>('n');
-    result[sign + 2] = static_cast<CharT>('f');
-    result[sign + 3] = static_cast<CharT>('i');
-    result[sign + 4] = static_cast<CharT>('n');
-    result[sign + 5] = static_cast<CharT>('i');
-    result[sign + 6] = static_cast<CharT>('t');
-    result[sign + 7] = static_cast<CharT>('y');
-    return sign + 8;
-  }
-
   template <typename CharT>
   constexpr unsigned d2fixed_buffered_n(double             d,
                                         uint32_t           precision,
@@ -421,16 +232,24 @@ namespace ryu::detail {
     }
     if (e2 >= -52) {
       const uint32_t idx = e2 < 0 ? 0 : indexForExponent((uint32_t)e2);
-      const uint32_t p10bits = pow10BitsForIndex(idx);
       const int32_t  len = static_cast<int32_t>(lengthForIndex(idx));
+#if defined(RYU_OPTIMIZE_SIZE)
+      const integer_blocks<DOUBLE_BIG_LIMBS> integer(m2, e2);
+#else
+      const uint32_t p10bits = pow10BitsForIndex(idx);
+#endif
 
       for (int32_t i = len - 1; i >= 0; --i) {
+#if defined(RYU_OPTIMIZE_SIZE)
+        const uint32_t digits = integer[i];
+#else
         const uint32_t j = p10bits - e2;
         // Temporary: j is usually around 128, and by shifting a bit, we push it to 128 or above,
         // which is a slightly faster code path in mulShift_mod1e9. Instead, we can just increase
         // the multipliers.
         const uint32_t digits =
             mulShift_mod1e9(m2 << 8, POW10_SPLIT[POW10_OFFSET[idx] + i], (int32_t)(j + 8));
+#endif
         if (nonzero) {
           append_nine_digits(digits, result + index);
           index += 9;
@@ -471,10 +290,20 @@ namespace ryu::detail {
         }
         index += static_cast<int>(9 * i);
       }
+#if defined(RYU_OPTIMIZE_SIZE)
+      fraction_blocks<DOUBLE_BIG_LIMBS> fraction(m2, e2);
+      if (i < blocks) {
+        fraction.skip(i);
+      }
+#endif
       for (; i < blocks; ++i) {
+#if defined(RYU_OPTIMIZE_SIZE)
+        if (fraction.isZero()) {
+#else
         const int32_t  j = ADDITIONAL_BITS_2 + (-e2 - 16 * idx);
         const uint32_t p = POW10_OFFSET_2[idx] + i - MIN_BLOCK_2[idx];
         if (p >= POW10_OFFSET_2[idx + 1]) {
+#endif
           // If the remaining digits are all 0, then we might as well use memset.
           // No rounding required in this case.
           const uint32_t fill = precision - 9 * i;
@@ -485,10 +314,14 @@ namespace ryu::detail {
           index += static_cast<int>(fill);
           break;
         }
+#if defined(RYU_OPTIMIZE_SIZE)
+        uint32_t digits = fraction.next();
+#else
         // Temporary: j is usually around 128, and by shifting a bit, we push it to 128 or above,
         // which is a slightly faster code path in mulShift_mod1e9. Instead, we can just increase
         // the multipliers.
         uint32_t digits = mulShift_mod1e9(m2 << 8, POW10_SPLIT_2[p], j + 8);
+#endif
 
         if (i < blocks - 1) {
           append_nine_digits(digits, result + index);
@@ -621,15 +454,23 @@ namespace ryu::detail {
     int32_t  exp = 0;
     if (e2 >= -52) {
       const uint32_t idx = e2 < 0 ? 0 : indexForExponent((uint32_t)e2);
-      const uint32_t p10bits = pow10BitsForIndex(idx);
       const int32_t  len = (int32_t)lengthForIndex(idx);
+#if defined(RYU_OPTIMIZE_SIZE)
+      const integer_blocks<DOUBLE_BIG_LIMBS> integer(m2, e2);
+#else
+      const uint32_t p10bits = pow10BitsForIndex(idx);
+#endif
 
       for (int32_t i = len - 1; i >= 0; --i) {
+#if defined(RYU_OPTIMIZE_SIZE)
+        digits = integer[i];
+#else
         const uint32_t j = p10bits - e2;
         // Temporary: j is usually around 128, and by shifting a bit, we push it to 128 or above,
         // which is a slightly faster code path in mulShift_mod1e9. Instead, we can just increase
         // the multipliers.
         digits = mulShift_mod1e9(m2 << 8, POW10_SPLIT[POW10_OFFSET[idx] + i], (int32_t)(j + 8));
+#endif
         if (printedDigits != 0) {
           if (printedDigits + 9 > precision) {
             availableDigits = 9;
@@ -658,8 +499,15 @@ namespace ryu::detail {
 
     if (e2 < 0 && availableDigits == 0) {
       const int32_t idx = -e2 / 16;
+#if defined(RYU_OPTIMIZE_SIZE)
+      fraction_blocks<DOUBLE_BIG_LIMBS> fraction(m2, e2);
+      fraction.skip(MIN_BLOCK_2[idx]);
+#endif
 
       for (int32_t i = MIN_BLOCK_2[idx]; i < 200; ++i) {
+#if defined(RYU_OPTIMIZE_SIZE)
+        digits = fraction.next();
+#else
         const int32_t  j = ADDITIONAL_BITS_2 + (-e2 - 16 * idx);
         const uint32_t p = POW10_OFFSET_2[idx] + (uint32_t)i - MIN_BLOCK_2[idx];
         // Temporary: j is usually around 128, and by shifting a bit, we push it to 128 or above,
@@ -667,6 +515,7 @@ namespace ryu::detail {
         // the multipliers.
         digits =
             (p >= POW10_OFFSET_2[idx + 1]) ? 0 : mulShift_mod1e9(m2 << 8, POW10_SPLIT_2[p], j + 8);
+#endif
 
         if (printedDigits != 0) {
           if (printedDigits + 9 > precision) {
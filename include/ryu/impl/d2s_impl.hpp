@@ -117,7 +117,7 @@ namespace ryu::detail {
       const int32_t k = ryu::config::DOUBLE_POW5_INV_BITCOUNT + pow5bits((int32_t)q) - 1;
       const int32_t i = -e2 + (int32_t)q + k;
 #if defined(RYU_OPTIMIZE_SIZE)
-      uint64_t pow5[2];
+      uint64_t pow5[2]{};
       double_computeInvPow5(q, pow5);
       vr = mulShiftAll64(m2, pow5, i, &vp, &vm, mmShift);
 #else
@@ -149,7 +149,7 @@ namespace ryu::detail {
       const int32_t k = pow5bits(i) - ryu::config::DOUBLE_POW5_BITCOUNT;
       const int32_t j = (int32_t)q - k;
 #if defined(RYU_OPTIMIZE_SIZE)
-      uint64_t pow5[2];
+      uint64_t pow5[2]{};
       double_computePow5(i, pow5);
       vr = mulShiftAll64(m2, pow5, j, &vp, &vm, mmShift);
 #else
@@ -0,0 +1,414 @@
+// The contents of this file originate from the ryu project by Ulf Adams (specifically the c version
+// of ryu), available at https://github.com/ulfjack/ryu.git. Changes made were merely to make the
+// ryu algorithm c++17 constexpr compliant, the core of the original algorithm remains unchanged.
+//
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef RYU_IMPL_F2FIXED_IMPL_HPP
+#define RYU_IMPL_F2FIXED_IMPL_HPP
+#include "ryu/common.hpp"
+#include "ryu/f2fixed.hpp"
+#include "ryu/f2s_intrinsics.hpp"
+#include "ryu/fixed_common.hpp"
+
+namespace ryu::detail {
+
+  template <typename CharT>
+  constexpr unsigned f2fixed_buffered_n(float             f,
+                                        uint32_t          precision,
+                                        CharT*            result,
+                                        FloatCastFunction bit_cast) noexcept {
+    const uint32_t bits = bit_cast(f);
+
+    // Decode bits into sign, mantissa, and exponent.
+    const bool     ieeeSign = ((bits >> (float_mantissa_bits + float_exponent_bits)) & 1) != 0;
+    const uint32_t ieeeMantissa = bits & ((1u << float_mantissa_bits) - 1);
+    const uint32_t ieeeExponent = (bits >> float_mantissa_bits) & ((1u << float_exponent_bits) - 1);
+
+    // Case distinction; exit early for the easy cases.
+    if (ieeeExponent == ((1u << float_exponent_bits) - 1u)) {
+      // the mantissa is shifted to the position of a double mantissa, so that the quiet NaN bit is
+      // where copy_special_str_printf() expects it.
+      return copy_special_str_printf(
+          result,
+          ieeeSign,
+          static_cast<uint64_t>(ieeeMantissa) << (double_mantissa_bits - float_mantissa_bits));
+    }
+    if (ieeeExponent == 0 && ieeeMantissa == 0) {
+      int index = 0;
+      if (ieeeSign) {
+        result[index++] = '-';
+      }
+      result[index++] = '0';
+      if (precision > 0) {
+        result[index++] = '.';
+        for (int i = 0; i < static_cast<int>(precision); ++i) {
+          result[index + i] = static_cast<CharT>('0');
+        }
+        index += static_cast<int>(precision);
+      }
+      return index;
+    }
+
+    int32_t  e2{0};
+    uint32_t m2{0};
+    if (ieeeExponent == 0) {
+      e2 = 1 - float_bias - float_mantissa_bits;
+      m2 = ieeeMantissa;
+    } else {
+      e2 = (int32_t)ieeeExponent - float_bias - float_mantissa_bits;
+      m2 = (1u << float_mantissa_bits) | ieeeMantissa;
+    }
+
+    int  index = 0;
+    bool nonzero = false;
+    if (ieeeSign) {
+      result[index++] = '-';
+    }
+    if (e2 >= -float_mantissa_bits) {
+      const integer_blocks<FLOAT_BIG_LIMBS> integer(m2, e2);
+      for (int32_t i = integer.size() - 1; i >= 0; --i) {
+        const uint32_t digits = integer[i];
+        if (nonzero) {
+          append_nine_digits(digits, result + index);
+          index += 9;
+        } else if (digits != 0) {
+          const uint32_t olength = decimalLength9(digits);
+          append_n_digits(olength, digits, result + index);
+          index += static_cast<int>(olength);
+          nonzero = true;
+        }
+      }
+    }
+    if (!nonzero) {
+      result[index++] = '0';
+    }
+    if (precision > 0) {
+      result[index++] = '.';
+    }
+
+    if (e2 < 0) {
+      const uint32_t blocks = precision / 9 + 1;
+      // 0 = don't round up; 1 = round up unconditionally; 2 = round up if odd.
+      int                              roundUp = 0;
+      fraction_blocks<FLOAT_BIG_LIMBS> fraction(m2, e2);
+      for (uint32_t i = 0; i < blocks; ++i) {
+        if (fraction.isZero()) {
+          // If the remaining digits are all 0, then we might as well use memset.
+          // No rounding required in this case.
+          const uint32_t fill = precision - 9 * i;
+          for (int k = 0; k < static_cast<int>(fill); ++k) {
+            result[index + k] = static_cast<CharT>('0');
+          }
+          index += static_cast<int>(fill);
+          break;
+        }
+        uint32_t digits = fraction.next();
+
+        if (i < blocks - 1) {
+          append_nine_digits(digits, result + index);
+          index += 9;
+        } else {
+          const uint32_t maximum = precision - 9 * i;
+          uint32_t       lastDigit = 0;
+          for (uint32_t k = 0; k < 9 - maximum; ++k) {
+            lastDigit = digits % 10;
+            digits /= 10;
+          }
+
+          if (lastDigit != 5) {
+            roundUp = lastDigit > 5;
+          } else {
+            // Is m * 10^(additionalDigits + 1) / 2^(-e2) integer?
+            const int32_t requiredTwos = -e2 - (int32_t)precision - 1;
+            const bool    trailingZeros =
+                requiredTwos <= 0 ||
+                (requiredTwos < 32 && multipleOfPowerOf2_32(m2, (uint32_t)requiredTwos));
+            roundUp = trailingZeros ? 2 : 1;
+          }
+          if (maximum > 0) {
+            append_c_digits(maximum, digits, result + index);
+            index += static_cast<int>(maximum);
+          }
+          break;
+        }
+      }
+
+      if (roundUp != 0) {
+        int roundIndex = index;
+        int dotIndex = 0; // '.' can't be located at index 0
+        while (true) {
+          --roundIndex;
+          char c{0};
+          if (roundIndex == -1 || (c = result[roundIndex], c == '-')) {
+            result[roundIndex + 1] = '1';
+            if (dotIndex > 0) {
+              result[dotIndex] = '0';
+              result[dotIndex + 1] = '.';
+            }
+            result[index++] = '0';
+            break;
+          }
+          if (c == '.') {
+            dotIndex = roundIndex;
+            continue;
+          } else if (c == '9') {
+            result[roundIndex] = '0';
+            roundUp = 1;
+            continue;
+          } else {
+            if (roundUp == 2 && c % 2 == 0) {
+              break;
+            }
+            result[roundIndex] = c + 1;
+            break;
+          }
+        }
+      }
+    } else {
+      for (uint32_t i = 0; i < precision; ++i) {
+        result[index + i] = static_cast<CharT>('0');
+      }
+      index += static_cast<int>(precision);
+    }
+    return index;
+  }
+
+  template <typename CharT>
+  constexpr unsigned f2exp_buffered_n(float             f,
+                                      uint32_t          precision,
+                                      CharT*            result,
+                                      FloatCastFunction bit_cast) noexcept {
+    const uint32_t bits = bit_cast(f);
+
+    // Decode bits into sign, mantissa, and exponent.
+    const bool     ieeeSign = ((bits >> (float_mantissa_bits + float_exponent_bits)) & 1) != 0;
+    const uint32_t ieeeMantissa = bits & ((1u << float_mantissa_bits) - 1);
+    const uint32_t ieeeExponent = (bits >> float_mantissa_bits) & ((1u << float_exponent_bits) - 1);
+
+    // Case distinction; exit early for the easy cases.
+    if (ieeeExponent == ((1u << float_exponent_bits) - 1u)) {
+      return copy_special_str_printf(
+          result,
+          ieeeSign,
+          static_cast<uint64_t>(ieeeMantissa) << (double_mantissa_bits - float_mantissa_bits));
+    }
+    if (ieeeExponent == 0 && ieeeMantissa == 0) {
+      int index = 0;
+      if (ieeeSign) {
+        result[index++] = '-';
+      }
+      result[index++] = '0';
+      if (precision > 0) {
+        result[index++] = '.';
+        for (uint32_t i = 0; i < precision; ++i) {
+          result[index + i] = static_cast<CharT>('0');
+        }
+        index += precision;
+      }
+      result[index] = 'e';
+      result[index + 1] = '+';
+      result[index + 2] = '0';
+      result[index + 3] = '0';
+      index += 4;
+      return index;
+    }
+
+    int32_t  e2{0};
+    uint32_t m2{0};
+    if (ieeeExponent == 0) {
+      e2 = 1 - float_bias - float_mantissa_bits;
+      m2 = ieeeMantissa;
+    } else {
+      e2 = (int32_t)ieeeExponent - float_bias - float_mantissa_bits;
+      m2 = (1u << float_mantissa_bits) | ieeeMantissa;
+    }
+
+    const bool printDecimalPoint = precision > 0;
+    ++precision;
+    int index = 0;
+    if (ieeeSign) {
+      result[index++] = '-';
+    }
+    uint32_t digits = 0;
+    uint32_t printedDigits = 0;
+    uint32_t availableDigits = 0;
+    int32_t  exp = 0;
+    if (e2 >= -float_mantissa_bits) {
+      const integer_blocks<FLOAT_BIG_LIMBS> integer(m2, e2);
+      for (int32_t i = integer.size() - 1; i >= 0; --i) {
+        digits = integer[i];
+        if (printedDigits != 0) {
+          if (printedDigits + 9 > precision) {
+            availableDigits = 9;
+            break;
+          }
+          append_nine_digits(digits, result + index);
+          index += 9;
+          printedDigits += 9;
+        } else if (digits != 0) {
+          availableDigits = decimalLength9(digits);
+          exp = i * 9 + (int32_t)availableDigits - 1;
+          if (availableDigits > precision) {
+            break;
+          }
+          if (printDecimalPoint) {
+            append_d_digits(availableDigits, digits, result + index);
+            index += availableDigits + 1; // +1 for decimal point
+          } else {
+            result[index++] = static_cast<CharT>('0' + digits);
+          }
+          printedDigits = availableDigits;
+          availableDigits = 0;
+        }
+      }
+    }
+
+    if (e2 < 0 && availableDigits == 0) {
+      fraction_blocks<FLOAT_BIG_LIMBS> fraction(m2, e2);
+      for (int32_t i = 0; i < 200; ++i) {
+        digits = fraction.next();
+        if (printedDigits != 0) {
+          if (printedDigits + 9 > precision) {
+            availableDigits = 9;
+            break;
+          }
+          append_nine_digits(digits, result + index);
+          index += 9;
+          printedDigits += 9;
+        } else if (digits != 0) {
+          availableDigits = decimalLength9(digits);
+          exp = -(i + 1) * 9 + (int32_t)availableDigits - 1;
+          if (availableDigits > precision) {
+            break;
+          }
+          if (printDecimalPoint) {
+            append_d_digits(availableDigits, digits, result + index);
+            index += availableDigits + 1; // +1 for decimal point
+          } else {
+            result[index++] = static_cast<CharT>('0' + digits);
+          }
+          printedDigits = availableDigits;
+          availableDigits = 0;
+        }
+      }
+    }
+
+    const uint32_t maximum = precision - printedDigits;
+    if (availableDigits == 0) {
+      digits = 0;
+    }
+    uint32_t lastDigit = 0;
+    if (availableDigits > maximum) {
+      for (uint32_t k = 0; k < availableDigits - maximum; ++k) {
+        lastDigit = digits % 10;
+        digits /= 10;
+      }
+    }
+
+    // 0 = don't round up; 1 = round up unconditionally; 2 = round up if odd.
+    int roundUp = 0;
+    if (lastDigit != 5) {
+      roundUp = lastDigit > 5;
+    } else {
+      // Is m * 2^e2 * 10^(precision + 1 - exp) integer?
+      // precision was already increased by 1, so we don't need to write + 1 here.
+      const int32_t rexp = (int32_t)precision - exp;
+      const int32_t requiredTwos = -e2 - rexp;
+      bool          trailingZeros = requiredTwos <= 0 || (requiredTwos < 32 &&
+                                                 multipleOfPowerOf2_32(m2, (uint32_t)requiredTwos));
+      if (rexp < 0) {
+        const int32_t requiredFives = -rexp;
+        trailingZeros = trailingZeros && multipleOfPowerOf5_32(m2, (uint32_t)requiredFives);
+      }
+      roundUp = trailingZeros ? 2 : 1;
+    }
+    if (printedDigits != 0) {
+      if (digits == 0) {
+        for (uint32_t i = 0; i < maximum; ++i) {
+          result[index + i] = '0';
+        }
+      } else {
+        append_c_digits(maximum, digits, result + index);
+      }
+      index += static_cast<int>(maximum);
+    } else {
+      if (printDecimalPoint) {
+        append_d_digits(maximum, digits, result + index);
+        index += static_cast<int>(maximum + 1); // +1 for decimal point
+      } else {
+        result[index++] = static_cast<CharT>('0' + digits);
+      }
+    }
+
+    if (roundUp != 0) {
+      int roundIndex = index;
+      while (true) {
+        --roundIndex;
+        char c{0};
+        if (roundIndex == -1 || (c = result[roundIndex], c == '-')) {
+          result[roundIndex + 1] = static_cast<CharT>('1');
+          ++exp;
+          break;
+        }
+        if (c == '.') {
+          continue;
+        } else if (c == '9') {
+          result[roundIndex] = static_cast<CharT>('0');
+          roundUp = 1;
+          continue;
+        } else {
+          if (roundUp == 2 && c % 2 == 0) {
+            break;
+          }
+          result[roundIndex] = c + 1;
+          break;
+        }
+      }
+    }
+    result[index++] = static_cast<CharT>('e');
+    if (exp < 0) {
+      result[index++] = static_cast<CharT>('-');
+      exp = -exp;
+    } else {
+      result[index++] = static_cast<CharT>('+');
+    }
+
+    // the decimal exponent of a float has at most two digits.
+    result[index + 0] = static_cast<CharT>(DIGIT_TABLE[2 * exp]);
+    result[index + 1] = static_cast<CharT>(DIGIT_TABLE[2 * exp + 1]);
+    index += 2;
+
+    return index;
+  }
+
+} // namespace ryu::detail
+
+namespace ryu {
+  template <typename CharT>
+  inline unsigned f2fixed_buffered_n(float f, uint32_t precision, CharT* result) noexcept {
+    return detail::f2fixed_buffered_n(f, precision, result, &to_bits);
+  }
+
+  template <typename CharT>
+  inline unsigned f2exp_buffered_n(float f, uint32_t precision, CharT* result) noexcept {
+    return detail::f2exp_buffered_n(f, precision, result, &to_bits);
+  }
+
+  namespace cx {
+    template <typename CharT>
+    constexpr unsigned f2fixed_buffered_n(float f, uint32_t precision, CharT* result) noexcept {
+      return ryu::detail::f2fixed_buffered_n(f, precision, result, &cx::to_bits);
+    }
+
+    template <typename CharT>
+    constexpr unsigned f2exp_buffered_n(float f, uint32_t precision, CharT* result) noexcept {
+      return ryu::detail::f2exp_buffered_n(f, precision, result, &cx::to_bits);
+    }
+  } // namespace cx
+} // namespace ryu
+
+#endif /* RYU_IMPL_F2FIXED_IMPL_HPP */
@@ -135,7 +135,7 @@ namespace ryu {
         int j = e2 - e10 - ceil_log2pow5(e10) + ryu::config::DOUBLE_POW5_BITCOUNT;
         // assert(j >= 0);
 #if defined(RYU_OPTIMIZE_SIZE)
-        uint64_t pow5[2];
+        uint64_t pow5[2]{};
         double_computePow5(e10, pow5);
         m2 = mulShift64(m10, pow5, j);
 #else
@@ -153,7 +153,7 @@ namespace ryu {
         e2 = floor_log2_func(m10) + e10 - ceil_log2pow5(-e10) - (ryu::double_mantissa_bits + 1);
         int j = e2 - e10 + ceil_log2pow5(-e10) - 1 + ryu::config::DOUBLE_POW5_INV_BITCOUNT;
 #if defined(RYU_OPTIMIZE_SIZE)
-        uint64_t pow5[2];
+        uint64_t pow5[2]{};
         double_computeInvPow5(-e10, pow5);
         m2 = mulShift64(m10, pow5, j);
 #else
@@ -227,6 +227,9 @@ namespace ryu {
     }
 
     constexpr double bits_to_double(uint64_t bits) noexcept {
+#if defined(RYU_HAS_CONSTEXPR_BIT_CAST)
+      return ryu::detail::bit_cast<double>(bits);
+#else
       if (bits == 0)
         return 0.0;
       if (ryu::cx::is_nan(bits))
@@ -249,6 +252,7 @@ namespace ryu {
       }
       return sign * (1.0 + mantissa / gcem::pow(2.0, ryu::double_mantissa_bits)) *
              gcem::pow(2.0, e - ryu::double_bias);
+#endif
     }
 
     static_assert(ryu::cx::bits_to_double(uint64_t(0x3FF0000000000000u)) == 1.0);
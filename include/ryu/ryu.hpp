@@ -12,6 +12,7 @@
 #include "ryu/common.hpp"
 #include "ryu/d2fixed.hpp"
 #include "ryu/d2s.hpp"
+#include "ryu/f2fixed.hpp"
 #include "ryu/f2s.hpp"
 #include "ryu/ryu_parse.hpp"
 
@@ -60,6 +61,31 @@ namespace ryu {
   template <typename CharT>
   unsigned d2exp_buffered_n(double d, uint32_t precision, CharT* result) noexcept;
 
+  /**
+   * @brief formats f into result with a specified precision. The output is the same as
+   * d2fixed_buffered_n() of f converted to double, but only 32 and 64 bit arithmetic is used.
+   * @tparam CharT character type.
+   * @param f value to format.
+   * @param precision number of digits after the decimal point.
+   * @param result string to format into.
+   * @return number of characters written.
+   */
+  template <typename CharT>
+  unsigned f2fixed_buffered_n(float f, uint32_t precision, CharT* result) noexcept;
+
+  /**
+   * @brief formats f into result with a specified precision into exponential format. The output
+   * is the same as d2exp_buffered_n() of f converted to double, but only 32 and 64 bit arithmetic
+   * is used.
+   * @tparam CharT character type.
+   * @param f value to format.
+   * @param precision number of digits after the decimal point.
+   * @param result string to format into.
+   * @return number of characters written.
+   */
+  template <typename CharT>
+  unsigned f2exp_buffered_n(float f, uint32_t precision, CharT* result) noexcept;
+
   namespace cx {
     /**
      * @brief constexpr version of ryu::f2s_buffered_n
@@ -102,6 +128,28 @@ namespace ryu {
      */
     template <typename CharT>
     constexpr unsigned d2exp_buffered_n(double d, uint32_t precision, CharT* result) noexcept;
+
+    /**
+     * @brief constexpr version of ryu::f2fixed_buffered_n
+     * @tparam CharT character type
+     * @param f value to format
+     * @param precision number of digits after the decimal point
+     * @param result string t
+     * @return number of characters written.
+     */
+    template <typename CharT>
+    constexpr unsigned f2fixed_buffered_n(float f, uint32_t precision, CharT* result) noexcept;
+
+    /**
+     * @brief constexpr version of ryu::f2exp_buffered_n
+     * @tparam CharT character type
+     * @param f value to format
+     * @param precision number of digits after the decimal point
+     * @param result string t
+     * @return number of characters written.
+     */
+    template <typename CharT>
+    constexpr unsigned f2exp_buffered_n(float f, uint32_t precision, CharT* result) noexcept;
   } // namespace cx
 } // namespace ryu
 #endif /* RYU_RYU_HPP */
@@ -0,0 +1,162 @@
+/**
+ * @file sgl/action_queue.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::ActionQueue, a fixed capacity queue of deferred actions, which lets
+ * input handlers hand off long running work instead of executing it in Menu::handle_input().
+ *
+ * @version 0.1
+ * @date 2023-03-04
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_ACTION_QUEUE_HPP
+#define SGL_ACTION_QUEUE_HPP
+#include "sgl/array.hpp"
+#include "sgl/callable.hpp"
+#include "sgl/error.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace sgl {
+
+  /// @headerfile action_queue.hpp "sgl/action_queue.hpp"
+
+  /**
+    @brief Fixed capacity queue of deferred actions with completion callbacks.
+
+    An action is posted with post() from the thread which drives the menu, typically from a button
+    click handler or a page's on enter callback, so the handler returns immediately. Posting is
+    constant time and does not allocate. The actions are executed by run(), and their completion
+    callbacks, which receive the sgl::error returned by the action, by complete().
+
+    Every sgl::Menu owns an ActionQueue with a capacity of SGL_ACTION_QUEUE_SIZE, see
+    Menu::post(). SGL_ACTION_QUEUE_SIZE is 0 by default, i.e. menus which never defer an action
+    don't pay for the queue; define it, e.g. to 4, to enable it. By default Menu::tick() and
+    Menu::tick_for() call both run() and complete(). If set_threaded(true)
+    is called, Menu::tick() only calls complete() and run() is left to a worker thread. The
+    completion callbacks therefore always run in the thread driving the menu and may modify items,
+    e.g. update their text.
+
+    ```cpp
+    auto start_calibration = [&menu](auto& button) noexcept {
+      button.set_text("calibrating...");
+      return menu.post([]() noexcept { return calibrate(); },
+                       [&button](sgl::error ec) noexcept {
+                         (void)button.set_text(ec == sgl::error::no_error ? "done" : "failed");
+                       });
+    };
+    ```
+
+    Exactly one thread may call post(), one thread run() and one thread complete(). The first and
+    last are usually the same thread.
+
+    @tparam Capacity maximum number of pending actions, a power of two. A capacity of 0 disables
+    the queue, i.e. post() always fails.
+   */
+  template <size_t Capacity>
+  class ActionQueue {
+  public:
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    /// action type. The returned error is passed to the completion callback.
+    using Action = sgl::Callable<sgl::error()>;
+
+    /// completion callback type
+    using Completion = sgl::Callable<void(sgl::error)>;
+
+    /// maximum number of pending actions
+    static constexpr size_t capacity = Capacity;
+
+    constexpr ActionQueue() noexcept = default;
+
+    ActionQueue(const ActionQueue&) = delete;
+    ActionQueue& operator=(const ActionQueue&) = delete;
+
+    /**
+      add an action to the queue.
+      @tparam F action type, anything an sgl::ActionQueue::Action can be constructed from
+      @tparam C completion type, anything an sgl::ActionQueue::Completion can be constructed from
+      @param action action to execute
+      @param completion callback which receives the result of action after it was executed
+      @return sgl::error::no_error in case of success
+      @return sgl::error::queue_full if capacity actions have not completed yet
+     */
+    template <typename F, typename C = Completion>
+    sgl::error post(F&& action, C&& completion = {}) noexcept;
+
+    /**
+      execute up to max pending actions, in the order they were posted.
+      @param max maximum number of actions to execute
+      @return number of actions executed
+     */
+    size_t run(size_t max = static_cast<size_t>(-1)) noexcept;
+
+    /**
+      call the completion callbacks of all executed actions, in the order they were posted.
+      @return number of completed actions
+     */
+    size_t complete() noexcept;
+
+    /// @return number of actions which are posted but not completed yet
+    [[nodiscard]] size_t pending() const noexcept;
+
+    /// @return true if run() is called by a worker thread instead of Menu::tick()
+    [[nodiscard]] bool is_threaded() const noexcept { return threaded_; }
+
+    /// set whether run() is called by a worker thread instead of Menu::tick()
+    void set_threaded(bool threaded) noexcept { threaded_ = threaded; }
+
+  private:
+    struct Slot {
+      Action     action{};
+      Completion completion{};
+      sgl::error result{sgl::error::no_error};
+    };
+
+    // head_: next slot to post into, run_: next slot to execute, done_: next slot to complete.
+    // done_ <= run_ <= head_, and each index is only written by one thread.
+    sgl::Array<Slot, Capacity> slots_{};
+    std::atomic<size_t>        head_{0};
+    std::atomic<size_t>        run_{0};
+    std::atomic<size_t>        done_{0};
+    bool                       threaded_{false};
+  };
+
+  /// @cond
+  template <>
+  class ActionQueue<0> {
+  public:
+    using Action = sgl::Callable<sgl::error()>;
+    using Completion = sgl::Callable<void(sgl::error)>;
+
+    static constexpr size_t capacity = 0;
+
+    constexpr ActionQueue() noexcept = default;
+
+    ActionQueue(const ActionQueue&) = delete;
+    ActionQueue& operator=(const ActionQueue&) = delete;
+
+    template <typename F, typename C = Completion>
+    sgl::error post(F&&, C&& = {}) noexcept {
+      return sgl::error::queue_full;
+    }
+
+    constexpr size_t run(size_t = 0) noexcept { return 0; }
+
+    constexpr size_t complete() noexcept { return 0; }
+
+    [[nodiscard]] constexpr size_t pending() const noexcept { return 0; }
+
+    [[nodiscard]] constexpr bool is_threaded() const noexcept { return false; }
+
+    constexpr void set_threaded(bool) noexcept {}
+  };
+  /// @endcond
+} // namespace sgl
+
+#include "sgl/impl/action_queue_impl.hpp"
+#endif /* SGL_ACTION_QUEUE_HPP */
@@ -0,0 +1,177 @@
+/**
+ * @file sgl/c_api.h
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains the C interface which sgl::c_api and SGL_DEFINE_C_API generate for a menu
+ * type. It can be included from C and C++.
+ *
+ * @version 0.1
+ * @date 2023-03-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_C_API_H
+#define SGL_C_API_H
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// opaque handle of a menu instance
+typedef struct sgl_menu sgl_menu;
+
+/// a sgl::input value, see sgl/input.hpp
+typedef uint64_t sgl_input;
+
+#define SGL_INPUT_UP    UINT64_C(0x0100000000000000) ///< sgl::input::up
+#define SGL_INPUT_DOWN  UINT64_C(0x0200000000000000) ///< sgl::input::down
+#define SGL_INPUT_LEFT  UINT64_C(0x0300000000000000) ///< sgl::input::left
+#define SGL_INPUT_RIGHT UINT64_C(0x0400000000000000) ///< sgl::input::right
+#define SGL_INPUT_ENTER UINT64_C(0x0500000000000000) ///< sgl::input::enter
+
+/// sgl::error codes returned by sgl_set(), sgl_get() and written to the errors arrays
+#define SGL_ERROR_NO_ERROR           0  ///< sgl::error::no_error
+#define SGL_ERROR_INVALID_INPUT      1  ///< sgl::error::invalid_input
+#define SGL_ERROR_OUT_OF_RANGE       2  ///< sgl::error::out_of_range
+#define SGL_ERROR_BUFFER_TOO_SMALL   3  ///< sgl::error::buffer_too_small
+#define SGL_ERROR_NULL_PAGE          4  ///< sgl::error::null_page
+#define SGL_ERROR_NULL_ELEMENT       5  ///< sgl::error::null_element
+#define SGL_ERROR_STRING_CONVERSION  6  ///< sgl::error::string_conversion
+#define SGL_ERROR_NOT_EDITABLE       7  ///< sgl::error::not_editable
+#define SGL_ERROR_INVALID_VALUE      8  ///< sgl::error::invalid_value
+#define SGL_ERROR_EDIT_FINISHED      9  ///< sgl::error::edit_finished
+#define SGL_ERROR_FORMAT_ERROR       10 ///< sgl::error::format_error
+#define SGL_ERROR_PAGE_NOT_FOUND     11 ///< sgl::error::page_not_found
+#define SGL_ERROR_INVALID_PAGE_INDEX 12 ///< sgl::error::invalid_page_index
+#define SGL_ERROR_INVALID_FORMAT     13 ///< sgl::error::invalid_format
+#define SGL_ERROR_NULL_FORMAT        14 ///< sgl::error::null_format
+#define SGL_ERROR_SCHEMA_MISMATCH    15 ///< sgl::error::schema_mismatch
+#define SGL_ERROR_STORAGE_ERROR      16 ///< sgl::error::storage_error
+#define SGL_ERROR_ITEM_NOT_FOUND     17 ///< sgl::error::item_not_found
+#define SGL_ERROR_QUEUE_FULL         18 ///< sgl::error::queue_full
+
+/// line flag of the current item
+#define SGL_LINE_CURRENT 1u
+
+/// line flag of an item in edit mode
+#define SGL_LINE_EDIT 2u
+
+/**
+  One line of the current page. name and text point into the menu and stay valid until the next
+  call which modifies the menu. They are not null terminated.
+ */
+typedef struct sgl_line {
+  const char* name;      ///< item name
+  size_t      name_size; ///< length of name
+  const char* text;      ///< item text
+  size_t      text_size; ///< length of text
+  size_t      index;     ///< index of the item in its page
+  unsigned    flags;     ///< SGL_LINE_CURRENT and SGL_LINE_EDIT
+} sgl_line;
+
+/// state of the current page
+typedef struct sgl_page {
+  const char* name;         ///< page name, not null terminated
+  size_t      name_size;    ///< length of name
+  size_t      index;        ///< index of the page
+  size_t      size;         ///< number of items
+  size_t      current_item; ///< index of the current item
+  int         edit_mode;    ///< 1 if the current item is being edited, 0 otherwise
+} sgl_page;
+
+/// @return size in bytes of the storage sgl_menu_init() needs
+size_t sgl_menu_size(void);
+
+/// @return alignment in bytes of the storage sgl_menu_init() needs
+size_t sgl_menu_align(void);
+
+/**
+  construct a menu in caller provided storage.
+  @param storage at least sgl_menu_size() bytes, aligned to sgl_menu_align()
+  @return handle, or NULL if storage is NULL or misaligned
+ */
+sgl_menu* sgl_menu_init(void* storage);
+
+/// destroy a menu constructed by sgl_menu_init(). The storage is not freed.
+void sgl_menu_deinit(sgl_menu* menu);
+
+/// @return a heap allocated menu, or NULL if the allocation failed
+sgl_menu* sgl_menu_create(void);
+
+/// destroy and free a menu returned by sgl_menu_create(). Does nothing if menu is NULL.
+void sgl_menu_destroy(sgl_menu* menu);
+
+/**
+  handle n inputs in order.
+  @param menu menu
+  @param inputs inputs
+  @param n number of inputs
+  @param errors NULL, or an array of n SGL_ERROR_* codes which receives the error of every input
+  @return number of inputs which did not return sgl::error::no_error
+ */
+size_t sgl_handle_inputs(sgl_menu* menu, const sgl_input* inputs, size_t n, int* errors);
+
+/// call the tick handlers of all items.
+void sgl_tick(sgl_menu* menu);
+
+/**
+  get the state of the current page.
+  @param menu menu
+  @param page receives the page state
+ */
+void sgl_current_page(const sgl_menu* menu, sgl_page* page);
+
+/**
+  get the lines first to first + count - 1 of the current page in one call.
+  @param menu menu
+  @param lines array of count lines
+  @param first index of the first item
+  @param count number of lines
+  @return number of lines written, which is less than count at the end of the page
+ */
+size_t sgl_render(const sgl_menu* menu, sgl_line* lines, size_t first, size_t count);
+
+/**
+  set the value of an item from a string, see sgl::Menu::set().
+  @param menu menu
+  @param path null terminated path of the form "page/item"
+  @param value null terminated value
+  @return SGL_ERROR_NO_ERROR on success, otherwise a SGL_ERROR_* code
+ */
+int sgl_set(sgl_menu* menu, const char* path, const char* value);
+
+/**
+  set n values in one call. Every assignment is applied, even if a previous one failed.
+  @param menu menu
+  @param paths n null terminated paths
+  @param values n null terminated values
+  @param n number of assignments
+  @param errors NULL, or an array of n SGL_ERROR_* codes, one for every assignment
+  @return number of failed assignments
+ */
+size_t sgl_set_values(sgl_menu*          menu,
+                      const char* const* paths,
+                      const char* const* values,
+                      size_t             n,
+                      int*               errors);
+
+/**
+  copy the text of an item into buffer and null terminate it, see sgl::Menu::get().
+  @param menu menu
+  @param path null terminated path of the form "page/item"
+  @param buffer buffer
+  @param len size of buffer, including the null terminator
+  @param written NULL, or receives the length of the text
+  @return SGL_ERROR_NO_ERROR on success, otherwise a SGL_ERROR_* code
+ */
+int sgl_get(const sgl_menu* menu, const char* path, char* buffer, size_t len, size_t* written);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SGL_C_API_H */
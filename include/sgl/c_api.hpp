@@ -0,0 +1,202 @@
+/**
+ * @file sgl/c_api.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::c_api, which implements the C interface of sgl/c_api.h for a menu type,
+ * and the SGL_DEFINE_C_API macro, which exports it.
+ *
+ * @version 0.1
+ * @date 2023-03-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_C_API_HPP
+#define SGL_C_API_HPP
+#include "sgl/c_api.h"
+#include "sgl/menu.hpp"
+
+#include <type_traits>
+
+namespace sgl {
+  // the constants of sgl/c_api.h must match sgl::input and sgl::error
+  static_assert(SGL_INPUT_UP == static_cast<sgl_input>(sgl::input::up));
+  static_assert(SGL_INPUT_DOWN == static_cast<sgl_input>(sgl::input::down));
+  static_assert(SGL_INPUT_LEFT == static_cast<sgl_input>(sgl::input::left));
+  static_assert(SGL_INPUT_RIGHT == static_cast<sgl_input>(sgl::input::right));
+  static_assert(SGL_INPUT_ENTER == static_cast<sgl_input>(sgl::input::enter));
+  static_assert(SGL_ERROR_NO_ERROR == static_cast<int>(sgl::error::no_error));
+  static_assert(SGL_ERROR_INVALID_INPUT == static_cast<int>(sgl::error::invalid_input));
+  static_assert(SGL_ERROR_OUT_OF_RANGE == static_cast<int>(sgl::error::out_of_range));
+  static_assert(SGL_ERROR_BUFFER_TOO_SMALL == static_cast<int>(sgl::error::buffer_too_small));
+  static_assert(SGL_ERROR_NULL_PAGE == static_cast<int>(sgl::error::null_page));
+  static_assert(SGL_ERROR_NULL_ELEMENT == static_cast<int>(sgl::error::null_element));
+  static_assert(SGL_ERROR_STRING_CONVERSION == static_cast<int>(sgl::error::string_conversion));
+  static_assert(SGL_ERROR_NOT_EDITABLE == static_cast<int>(sgl::error::not_editable));
+  static_assert(SGL_ERROR_INVALID_VALUE == static_cast<int>(sgl::error::invalid_value));
+  static_assert(SGL_ERROR_EDIT_FINISHED == static_cast<int>(sgl::error::edit_finished));
+  static_assert(SGL_ERROR_FORMAT_ERROR == static_cast<int>(sgl::error::format_error));
+  static_assert(SGL_ERROR_PAGE_NOT_FOUND == static_cast<int>(sgl::error::page_not_found));
+  static_assert(SGL_ERROR_INVALID_PAGE_INDEX == static_cast<int>(sgl::error::invalid_page_index));
+  static_assert(SGL_ERROR_INVALID_FORMAT == static_cast<int>(sgl::error::invalid_format));
+  static_assert(SGL_ERROR_NULL_FORMAT == static_cast<int>(sgl::error::null_format));
+  static_assert(SGL_ERROR_SCHEMA_MISMATCH == static_cast<int>(sgl::error::schema_mismatch));
+  static_assert(SGL_ERROR_STORAGE_ERROR == static_cast<int>(sgl::error::storage_error));
+  static_assert(SGL_ERROR_ITEM_NOT_FOUND == static_cast<int>(sgl::error::item_not_found));
+  static_assert(SGL_ERROR_QUEUE_FULL == static_cast<int>(sgl::error::queue_full));
+
+  /// @headerfile c_api.hpp "sgl/c_api.hpp"
+
+  /**
+    @brief Implementation of the C interface of sgl/c_api.h for menus of type Menu.
+
+    A sgl_menu handle is a pointer to a Menu, so any number of instances can be created. The calls
+    are batched, i.e. sgl_render() returns all requested lines and sgl_handle_inputs() handles all
+    inputs in one call, so that the cost of crossing the language boundary, e.g. from python
+    ctypes, is paid once per frame instead of once per line or input.
+
+    Use SGL_DEFINE_C_API in exactly one C++ translation unit to export the functions:
+
+    ```cpp
+    #include "sgl/c_api.hpp"
+
+    constexpr auto make_menu() noexcept { return sgl::Menu(...); }
+
+    SGL_DEFINE_C_API(make_menu())
+    ```
+
+    ```c
+    #include "sgl/c_api.h"
+
+    sgl_menu* menu = sgl_menu_create();
+    sgl_input inputs[] = {...};
+    sgl_handle_inputs(menu, inputs, 3, NULL);
+    sgl_line  lines[4];
+    size_t    n = sgl_render(menu, lines, 0, 4);
+    ```
+
+    @tparam Menu sgl::Menu type with char as character type
+   */
+  template <typename Menu>
+  struct c_api {
+    static_assert(std::is_same_v<typename Menu::char_type, char>,
+                  "sgl::c_api only supports menus with char as character type");
+
+    /// @return sizeof(Menu)
+    static constexpr size_t size() noexcept { return sizeof(Menu); }
+
+    /// @return alignof(Menu)
+    static constexpr size_t align() noexcept { return alignof(Menu); }
+
+    /**
+      construct a menu in storage.
+      @param storage storage, see sgl_menu_init()
+      @param factory function returning the initial menu
+      @return handle, or nullptr if storage is null or misaligned
+     */
+    template <typename Factory>
+    static sgl_menu* init(void* storage, Factory&& factory) noexcept;
+
+    /// destroy a menu constructed by init()
+    static void deinit(sgl_menu* menu) noexcept;
+
+    /**
+      allocate and construct a menu.
+      @param factory function returning the initial menu
+      @return handle, or nullptr if the allocation failed
+     */
+    template <typename Factory>
+    static sgl_menu* create(Factory&& factory) noexcept;
+
+    /// destroy and free a menu returned by create(), does nothing if menu is null
+    static void destroy(sgl_menu* menu) noexcept;
+
+    /// see sgl_handle_inputs()
+    static size_t
+        handle_inputs(sgl_menu* menu, const sgl_input* inputs, size_t n, int* errors) noexcept;
+
+    /// see sgl_tick()
+    static void tick(sgl_menu* menu) noexcept;
+
+    /// see sgl_current_page()
+    static void current_page(const sgl_menu* menu, sgl_page* page) noexcept;
+
+    /// see sgl_render()
+    static size_t
+        render(const sgl_menu* menu, sgl_line* lines, size_t first, size_t count) noexcept;
+
+    /// see sgl_set()
+    static int set(sgl_menu* menu, const char* path, const char* value) noexcept;
+
+    /// see sgl_set_values()
+    static size_t set_values(sgl_menu*          menu,
+                             const char* const* paths,
+                             const char* const* values,
+                             size_t             n,
+                             int*               errors) noexcept;
+
+    /// see sgl_get()
+    static int get(const sgl_menu* menu,
+                   const char*     path,
+                   char*           buffer,
+                   size_t          len,
+                   size_t*         written) noexcept;
+
+    /// get the menu of a handle
+    static Menu& from_handle(sgl_menu* menu) noexcept { return *reinterpret_cast<Menu*>(menu); }
+
+    /// get the menu of a handle
+    static const Menu& from_handle(const sgl_menu* menu) noexcept {
+      return *reinterpret_cast<const Menu*>(menu);
+    }
+  };
+} // namespace sgl
+
+/**
+  define the functions of sgl/c_api.h with extern "C" linkage for the menu type returned by
+  factory. Use this macro in exactly one translation unit at global scope.
+  @param factory expression returning the initial menu, e.g. make_menu()
+ */
+#define SGL_DEFINE_C_API(factory)                                                                 \
+  namespace {                                                                                     \
+    using sgl_c_api_t = sgl::c_api<std::decay_t<decltype(factory)>>;                              \
+  }                                                                                               \
+  extern "C" {                                                                                    \
+  size_t    sgl_menu_size(void) { return sgl_c_api_t::size(); }                                   \
+  size_t    sgl_menu_align(void) { return sgl_c_api_t::align(); }                                 \
+  sgl_menu* sgl_menu_init(void* storage) {                                                        \
+    return sgl_c_api_t::init(storage, [] { return factory; });                                    \
+  }                                                                                               \
+  void      sgl_menu_deinit(sgl_menu* menu) { sgl_c_api_t::deinit(menu); }                        \
+  sgl_menu* sgl_menu_create(void) {                                                               \
+    return sgl_c_api_t::create([] { return factory; });                                           \
+  }                                                                                               \
+  void   sgl_menu_destroy(sgl_menu* menu) { sgl_c_api_t::destroy(menu); }                         \
+  size_t sgl_handle_inputs(sgl_menu* menu, const sgl_input* inputs, size_t n, int* errors) {      \
+    return sgl_c_api_t::handle_inputs(menu, inputs, n, errors);                                   \
+  }                                                                                               \
+  void sgl_tick(sgl_menu* menu) { sgl_c_api_t::tick(menu); }                                      \
+  void sgl_current_page(const sgl_menu* menu, sgl_page* page) {                                   \
+    sgl_c_api_t::current_page(menu, page);                                                        \
+  }                                                                                               \
+  size_t sgl_render(const sgl_menu* menu, sgl_line* lines, size_t first, size_t count) {          \
+    return sgl_c_api_t::render(menu, lines, first, count);                                        \
+  }                                                                                               \
+  int sgl_set(sgl_menu* menu, const char* path, const char* value) {                              \
+    return sgl_c_api_t::set(menu, path, value);                                                   \
+  }                                                                                               \
+  size_t sgl_set_values(sgl_menu*          menu,                                                  \
+                        const char* const* paths,                                                 \
+                        const char* const* values,                                                \
+                        size_t             n,                                                     \
+                        int*               errors) {                                              \
+    return sgl_c_api_t::set_values(menu, paths, values, n, errors);                               \
+  }                                                                                               \
+  int sgl_get(const sgl_menu* menu, const char* path, char* buffer, size_t len, size_t* written) { \
+    return sgl_c_api_t::get(menu, path, buffer, len, written);                                    \
+  }                                                                                               \
+  }
+
+#include "sgl/impl/c_api_impl.hpp"
+#endif /* SGL_C_API_HPP */
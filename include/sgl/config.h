@@ -14,6 +14,10 @@
 /// Uncomment next line and replace XXX with a number to set default line width
 //#define SGL_LINE_WIDTH XXX
 
+/// Uncomment next line and replace XXX with a power of two to enable the deferred action queue of
+/// each menu with a capacity of XXX. The default of 0 compiles the queue out.
+//#define SGL_ACTION_QUEUE_SIZE XXX
+
 #ifndef SGL_INSTANTIATE
   #define SGL_INSTANTIATE 0
 #endif
@@ -23,6 +27,9 @@
 #ifndef SGL_LINE_WIDTH
   #define SGL_LINE_WIDTH 40
 #endif
+#ifndef SGL_ACTION_QUEUE_SIZE
+  #define SGL_ACTION_QUEUE_SIZE 0
+#endif
 #if SGL_INSTANTIATE && !defined(SGL_CHAR_TYPE) && !defined(SGL_LINE_WIDTH)
   #error SGL_CHAR_TYPE and SGL_LINE_WIDTH must be defined if SGL_INSTANTIATE is set to 1.
 #endif
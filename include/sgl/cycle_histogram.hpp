@@ -0,0 +1,155 @@
+/**
+ * @file sgl/cycle_histogram.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::CycleHistogram, an observer which records how long the input handling,
+ * ticks and page transitions of a menu take, and sgl::cycle_clock, the default time source.
+ *
+ * @version 0.1
+ * @date 2023-02-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_CYCLE_HISTOGRAM_HPP
+#define SGL_CYCLE_HISTOGRAM_HPP
+#include "sgl/array.hpp"
+#include "sgl/fwd.hpp"
+#include "sgl/observer.hpp"
+#include "sgl/string_view.hpp"
+#include "sgl/type_list.hpp"
+
+#include <cstdint>
+#include <cstdio>
+
+namespace sgl {
+
+  /// @cond
+  namespace cycle_histogram_impl {
+    template <typename Menu>
+    struct layout;
+
+    template <typename NameList, typename... Pages>
+    struct layout<sgl::Menu<NameList, sgl::type_list<Pages...>>> {
+      static constexpr size_t num_pages = sizeof...(Pages);
+
+      // handle_input, tick, then on_enter and on_exit of every page, then the items page by page
+      static constexpr size_t first_item = 2 + 2 * num_pages;
+
+      static constexpr sgl::Array<size_t, num_pages> item_offset = [] {
+        constexpr size_t              sizes[] = {sgl::list_size_v<typename Pages::item_list>...};
+        sgl::Array<size_t, num_pages> offsets{};
+        size_t                        offset = first_item;
+        for (size_t i = 0; i < num_pages; ++i) {
+          offsets[i] = offset;
+          offset += sizes[i];
+        }
+        return offsets;
+      }();
+
+      static constexpr size_t size =
+          first_item + (sgl::list_size_v<typename Pages::item_list> + ...);
+    };
+  } // namespace cycle_histogram_impl
+  /// @endcond
+
+  /// @headerfile cycle_histogram.hpp "sgl/cycle_histogram.hpp"
+
+  /**
+    Default clock of sgl::CycleHistogram. Reads the time stamp counter on x86, the virtual counter on
+    aarch64 and falls back to std::chrono::steady_clock in nanoseconds elsewhere. On a
+    microcontroller, supply a clock which reads the cycle counter instead, e.g. DWT->CYCCNT on a
+    Cortex-M.
+   */
+  struct cycle_clock {
+    /// @return current cycle count
+    static uint64_t now() noexcept;
+  };
+
+  /// statistics of one kind of event
+  struct CycleStats {
+    /// number of histogram buckets. Bucket i counts durations in [2^(i-1), 2^i), bucket 0 counts 0.
+    static constexpr size_t num_buckets = 32;
+
+    uint64_t                          count{0};        ///< number of events
+    uint64_t                          total{0};        ///< sum of all durations
+    uint64_t                          min{UINT64_MAX}; ///< shortest duration
+    uint64_t                          max{0};          ///< longest duration
+    sgl::Array<uint32_t, num_buckets> buckets{};       ///< log2 histogram of the durations
+    sgl::string_view<char>            page_name{};     ///< page of the event
+    sgl::string_view<char>            item_name{};     ///< item of the event
+
+    /// add a duration
+    constexpr void add(uint64_t cycles) noexcept;
+  };
+
+  /**
+    @brief Observer which accumulates a cycle count histogram per event, page and item.
+
+    There is one sgl::CycleStats for Menu::handle_input(), one for Menu::tick(), one each for the on
+    enter and on exit callback of every page, and one for the tick of every item. To use it, connect
+    an instance to the menu type with sgl::ObserverTraits:
+
+    ```cpp
+    using Menu = decltype(make_menu());
+    inline sgl::CycleHistogram<Menu> histogram;
+
+    template <>
+    struct sgl::ObserverTraits<Menu> {
+      static constexpr bool enabled = true;
+      static void begin(const sgl::Event& e) noexcept { histogram.begin(e); }
+      static void end(const sgl::Event& e) noexcept { histogram.end(e); }
+    };
+    ...
+    histogram.dump(stdout);
+    ```
+
+    @tparam Menu sgl::Menu type
+    @tparam Clock type with a static uint64_t now() function
+   */
+  template <typename Menu, typename Clock = sgl::cycle_clock>
+  class CycleHistogram {
+  public:
+    /// number of sgl::CycleStats entries
+    static constexpr size_t size = cycle_histogram_impl::layout<Menu>::size;
+
+    /// maximum nesting depth of events. Deeper events are not recorded.
+    static constexpr size_t max_depth = 8;
+
+    /// record the start of e
+    void begin(const sgl::Event& e) noexcept;
+
+    /// record the end of e
+    void end(const sgl::Event& e) noexcept;
+
+    /// @return statistics of e. page_name and item_name of e are not used.
+    [[nodiscard]] const sgl::CycleStats& stats(const sgl::Event& e) const noexcept;
+
+    /**
+      call f with the sgl::event_kind and the sgl::CycleStats of every entry with at least one
+      event.
+      @tparam F callable type
+      @param f callable
+     */
+    template <typename F>
+    void for_each(F&& f) const;
+
+    /// write one line per recorded entry with the count, min, mean and max into file, followed by
+    /// the non-empty buckets as [2^i]=n, where n durations were in [2^(i-1), 2^i).
+    void dump(std::FILE* file) const noexcept;
+
+    /// reset all statistics
+    void clear() noexcept;
+
+  private:
+    [[nodiscard]] static size_t index_of(const sgl::Event& e) noexcept;
+
+    sgl::Array<sgl::CycleStats, size> stats_{};
+    sgl::Array<uint64_t, max_depth>   start_{};
+    size_t                            depth_{0};
+  };
+} // namespace sgl
+
+#include "sgl/impl/cycle_histogram_impl.hpp"
+#endif /* SGL_CYCLE_HISTOGRAM_HPP */
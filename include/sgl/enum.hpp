@@ -87,6 +87,12 @@ namespace sgl {
      */
     [[nodiscard]] constexpr sgl::string_view<CharT> current_string() const noexcept;
 
+    /**
+      get the map of enum values and their strings
+      @return const reference to the map
+     */
+    [[nodiscard]] constexpr const sgl::EnumMap<T, NumEnumerators, CharT>& get_map() const noexcept;
+
     /**
       get index of current value
       @return size_t
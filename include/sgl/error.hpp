@@ -34,7 +34,11 @@ namespace sgl {
     page_not_found,
     invalid_page_index,
     invalid_format,
-    null_format
+    null_format,
+    schema_mismatch, ///< serialized data was produced by a menu with a different layout
+    storage_error,   ///< a storage backend failed to read, write or erase
+    item_not_found,  ///< no item with the given name exists
+    queue_full       ///< a fixed capacity queue has no free slot
   };
 } // namespace sgl
 #endif /* SGL_ERROR_HPP */
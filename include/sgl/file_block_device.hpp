@@ -0,0 +1,178 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_FILE_BLOCK_DEVICE_HPP
+#define SGL_FILE_BLOCK_DEVICE_HPP
+#include "sgl/error.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sgl {
+
+  /**
+    @brief Block device backed by a file, stand-in for a NOR flash on a POSIX host.
+
+    The file is block_size * block_count bytes large. Like a flash memory, erase() sets all bytes
+    of a block to 0xFF and write() can only clear bits, i.e. the new content of a byte is the
+    bitwise and of its old content and the data written. This makes it usable to test
+    sgl::SettingsJournal on a host.
+   */
+  class FileBlockDevice {
+  public:
+    /**
+      open or create the file at path. Missing bytes at the end of the file are filled with 0xFF.
+      @param path file path
+      @param block_size size of each block in bytes
+      @param block_count number of blocks
+     */
+    FileBlockDevice(const char* path, size_t block_size, size_t block_count) noexcept
+        : fd_(::open(path, O_RDWR | O_CREAT, 0644)), block_size_(block_size),
+          block_count_(block_count) {
+      if (fd_ < 0) {
+        return;
+      }
+      struct stat st {};
+      if (::fstat(fd_, &st) != 0) {
+        close();
+        return;
+      }
+      uint8_t erased[64];
+      for (auto& b : erased) {
+        b = 0xFF;
+      }
+      for (size_t pos = static_cast<size_t>(st.st_size); pos < size();) {
+        const size_t n = (size() - pos) < sizeof(erased) ? (size() - pos) : sizeof(erased);
+        if (::pwrite(fd_, erased, n, static_cast<off_t>(pos)) != static_cast<ssize_t>(n)) {
+          close();
+          return;
+        }
+        pos += n;
+      }
+    }
+
+    FileBlockDevice(const FileBlockDevice&) = delete;
+    FileBlockDevice& operator=(const FileBlockDevice&) = delete;
+
+    ~FileBlockDevice() { close(); }
+
+    /// @return true if the file was opened successfully
+    [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+
+    /// @return size of a block in bytes
+    [[nodiscard]] size_t block_size() const noexcept { return block_size_; }
+
+    /// @return number of blocks
+    [[nodiscard]] size_t block_count() const noexcept { return block_count_; }
+
+    /// @return size of the device in bytes
+    [[nodiscard]] size_t size() const noexcept { return block_size_ * block_count_; }
+
+    /// @return number of times block was erased since construction
+    [[nodiscard]] size_t erase_count(size_t block) const noexcept {
+      return block < max_blocks ? erase_counts_[block] : 0;
+    }
+
+    /**
+      read len bytes starting at offset of block into data.
+      @return sgl::error::no_error in case of success
+      @return sgl::error::out_of_range if the range exceeds the block
+      @return sgl::error::storage_error if the file could not be read
+     */
+    sgl::error read(size_t block, size_t offset, uint8_t* data, size_t len) noexcept {
+      if (!in_range(block, offset, len)) {
+        return sgl::error::out_of_range;
+      }
+      if (::pread(fd_, data, len, position(block, offset)) != static_cast<ssize_t>(len)) {
+        return sgl::error::storage_error;
+      }
+      return sgl::error::no_error;
+    }
+
+    /**
+      program len bytes of data starting at offset of block. Bits can only be cleared.
+      @return sgl::error::no_error in case of success
+      @return sgl::error::out_of_range if the range exceeds the block
+      @return sgl::error::storage_error if the file could not be written
+     */
+    sgl::error write(size_t block, size_t offset, const uint8_t* data, size_t len) noexcept {
+      if (!in_range(block, offset, len)) {
+        return sgl::error::out_of_range;
+      }
+      uint8_t buffer[64];
+      while (len != 0) {
+        const size_t n = len < sizeof(buffer) ? len : sizeof(buffer);
+        if (::pread(fd_, buffer, n, position(block, offset)) != static_cast<ssize_t>(n)) {
+          return sgl::error::storage_error;
+        }
+        for (size_t i = 0; i < n; ++i) {
+          buffer[i] &= data[i];
+        }
+        if (::pwrite(fd_, buffer, n, position(block, offset)) != static_cast<ssize_t>(n)) {
+          return sgl::error::storage_error;
+        }
+        data += n;
+        offset += n;
+        len -= n;
+      }
+      return sgl::error::no_error;
+    }
+
+    /**
+      set all bytes of block to 0xFF.
+      @return sgl::error::no_error in case of success
+      @return sgl::error::out_of_range if block does not exist
+      @return sgl::error::storage_error if the file could not be written
+     */
+    sgl::error erase(size_t block) noexcept {
+      if (!in_range(block, 0, 0)) {
+        return sgl::error::out_of_range;
+      }
+      uint8_t buffer[64];
+      for (auto& b : buffer) {
+        b = 0xFF;
+      }
+      for (size_t offset = 0; offset < block_size_; offset += sizeof(buffer)) {
+        const size_t n =
+            (block_size_ - offset) < sizeof(buffer) ? (block_size_ - offset) : sizeof(buffer);
+        if (::pwrite(fd_, buffer, n, position(block, offset)) != static_cast<ssize_t>(n)) {
+          return sgl::error::storage_error;
+        }
+      }
+      if (block < max_blocks) {
+        ++erase_counts_[block];
+      }
+      return sgl::error::no_error;
+    }
+
+  private:
+    static constexpr size_t max_blocks = 64;
+
+    bool in_range(size_t block, size_t offset, size_t len) const noexcept {
+      return is_open() and block < block_count_ and offset <= block_size_ and
+             len <= block_size_ - offset;
+    }
+
+    off_t position(size_t block, size_t offset) const noexcept {
+      return static_cast<off_t>(block * block_size_ + offset);
+    }
+
+    void close() noexcept {
+      if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+      }
+    }
+
+    int    fd_;
+    size_t block_size_;
+    size_t block_count_;
+    size_t erase_counts_[max_blocks]{};
+  };
+} // namespace sgl
+#endif /* SGL_FILE_BLOCK_DEVICE_HPP */
@@ -0,0 +1,97 @@
+/**
+ * @file sgl/font.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::Font, a monospaced bitmap font atlas which is generated at compile time,
+ * and sgl::font_5x7, a built in 5x7 font for printable ASCII.
+ *
+ * @version 0.1
+ * @date 2023-03-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_FONT_HPP
+#define SGL_FONT_HPP
+#include <cstddef>
+#include <cstdint>
+
+namespace sgl {
+
+  /// @headerfile font.hpp "sgl/font.hpp"
+
+  /**
+    @brief Monospaced bitmap font atlas for glyphs of up to 8x8 pixels.
+
+    Fonts are usually distributed as column data, i.e. one byte per glyph column with the top pixel
+    in bit 0. Blitting into a row major frame buffer needs the glyph rows instead. sgl::make_font()
+    transposes the column data at compile time into rows, where the leftmost pixel is bit 7, so
+    that a glyph row can be shifted directly into a 1 bit per pixel frame buffer.
+
+    ```cpp
+    constexpr uint8_t columns[][3] = {{0x1F, 0x11, 0x1F}, {0x00, 0x1F, 0x00}}; // '0' and '1'
+    constexpr auto    digits = sgl::make_font(columns, 5, U'0');
+    static_assert(digits.row(U'1', 0) == 0x40);
+    ```
+
+    Characters outside of [first, first + count) are drawn as the glyph of fallback, or as a blank
+    cell if fallback is not in the font either.
+   */
+  struct Font {
+    /// maximum number of glyphs in a font
+    static constexpr size_t max_glyphs = 96;
+
+    /// maximum glyph width and height in pixels
+    static constexpr size_t max_glyph_size = 8;
+
+    uint8_t  glyph_width{0};  ///< width of a glyph in pixels
+    uint8_t  glyph_height{0}; ///< height of a glyph in pixels
+    uint8_t  cell_width{0};   ///< glyph width plus horizontal spacing in pixels
+    uint8_t  cell_height{0};  ///< glyph height plus vertical spacing in pixels
+    char32_t first{0};        ///< first character in the font
+    size_t   count{0};        ///< number of glyphs
+    char32_t fallback{0};     ///< character drawn for characters which are not in the font
+
+    uint8_t rows[max_glyphs][max_glyph_size]{}; ///< glyph rows, leftmost pixel in bit 7
+
+    /**
+      get a glyph row.
+      @param c character
+      @param y row, counted from the top. Rows in the vertical spacing are empty.
+      @return row bits, leftmost pixel in bit 7
+     */
+    [[nodiscard]] constexpr uint8_t row(char32_t c, size_t y) const noexcept;
+
+    /**
+      check if the font has a glyph for c.
+      @param c character
+      @return true if c is in the font
+     */
+    [[nodiscard]] constexpr bool contains(char32_t c) const noexcept {
+      return c >= first and c - first < count;
+    }
+  };
+
+  /**
+    create a font atlas from column data.
+    @param columns glyph columns, top pixel in bit 0. One glyph per entry, starting with first.
+    @param glyph_height height of a glyph in pixels, at most 8. Larger values are clamped to 8.
+    @param first character of the first glyph
+    @param spacing pixels between two glyphs horizontally and vertically
+    @param fallback character drawn for characters which are not in the font. If it is not in the
+    font itself, such characters are drawn as blank cells.
+    @tparam N number of glyphs, at most Font::max_glyphs
+    @tparam W glyph width in pixels, at most 8
+    @return font atlas
+   */
+  template <size_t N, size_t W>
+  constexpr Font make_font(const uint8_t (&columns)[N][W],
+                           uint8_t  glyph_height,
+                           char32_t first = U' ',
+                           uint8_t  spacing = 1,
+                           char32_t fallback = U'?') noexcept;
+} // namespace sgl
+
+#include "sgl/impl/font_impl.hpp"
+#endif /* SGL_FONT_HPP */
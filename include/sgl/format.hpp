@@ -21,9 +21,11 @@ namespace sgl {
     floating point values into a string. Integer and fix point formatting is constexpr by default.
     For constexpr floating point formatting, have a look at sgl::cx::to_chars(). It is not constexpr
     by default, because the bit pattern extraction is very expensive when done at compile time
-    instead of a simple memcpy.The floating point formatting is based on ryu, which is the fastest
-    floating point to string conversion rouitne to date. You can find out more about ryu
-    [here](https://github.com/ulfjack/ryu).
+    instead of a simple memcpy. If the compiler provides a constexpr bit_cast (C++20, or
+    __builtin_bit_cast of gcc >= 11, clang >= 9 and msvc >= 19.27 in C++17 mode),
+    RYU_HAS_CONSTEXPR_BIT_CAST is defined and the extraction is a plain bit_cast. The floating point
+    formatting is based on ryu, which is the fastest floating point to string conversion rouitne to
+    date. You can find out more about ryu [here](https://github.com/ulfjack/ryu).
 
     @note If your system has a different endianness for its integer and floating point types, these
     functions may not work!
@@ -134,9 +136,9 @@ namespace sgl {
     /**
      formats value into str with the specified precision and format.
 
-     @note Only use this function in a constexpr context! The floating point to bit representation
-     conversion is expensive when making it constexpr compliant. See sgl::to_chars() for a
-     efficient version to use at runtime.
+     @note Only use this function in a constexpr context! Without RYU_HAS_CONSTEXPR_BIT_CAST, the
+     floating point to bit representation conversion is expensive when making it constexpr
+     compliant. See sgl::to_chars() for a efficient version to use at runtime.
 
      @param str buffer to format into
      @param len buffer length
@@ -152,9 +154,9 @@ namespace sgl {
     /**
      formats value into str with the specified precision and format.
 
-     @note Only use this function in a constexpr context! The floating point to bit representation
-     conversion is expensive when making it constexpr compliant. See sgl::to_chars() for a
-     efficient version to use at runtime.
+     @note Only use this function in a constexpr context! Without RYU_HAS_CONSTEXPR_BIT_CAST, the
+     floating point to bit representation conversion is expensive when making it constexpr
+     compliant. See sgl::to_chars() for a efficient version to use at runtime.
 
      @param str buffer to format into
      @param len buffer length
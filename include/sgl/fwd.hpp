@@ -20,6 +20,9 @@ namespace sgl {
   template <typename ItemNameList, typename ItemTypeList>
   class Page;
 
+  template <typename Menu>
+  class MenuState;
+
   template <typename Impl, typename Traits>
   class ItemBase;
 
@@ -41,6 +44,15 @@ namespace sgl {
   template <size_t TextSize, typename CharT, typename T>
   class Numeric;
 
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  class Graph;
+
+  template <size_t TextSize, typename CharT>
+  class LocalizedText;
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  class LocalizedEnum;
+
   template <typename T, typename CharT>
   struct Pair;
 
@@ -0,0 +1,247 @@
+/**
+ * @file sgl/graph.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains the sgl::Graph item, which shows the history of a value as a sparkline, and
+ * the sgl::graph() factory function.
+ *
+ * @version 0.1
+ * @date 2023-03-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_GRAPH_HPP
+#define SGL_GRAPH_HPP
+#include "sgl/format.hpp"
+#include "sgl/item_base.hpp"
+#include "sgl/item_concepts.hpp"
+#include "sgl/smallest_type.hpp"
+
+#include <type_traits>
+
+namespace sgl {
+  /// @cond
+  namespace detail {
+    /// fixed capacity double ended queue of sample positions, used as monotonic queue by Graph.
+    template <size_t Capacity>
+    class IndexQueue {
+    public:
+      using index_type = sgl::smallest_type_t<Capacity>;
+
+      [[nodiscard]] constexpr bool       empty() const noexcept { return size_ == 0; }
+      [[nodiscard]] constexpr index_type front() const noexcept { return data_[head_]; }
+      [[nodiscard]] constexpr index_type back() const noexcept {
+        return data_[(head_ + size_ - 1) % Capacity];
+      }
+      constexpr void push_back(index_type i) noexcept {
+        data_[(head_ + size_) % Capacity] = i;
+        ++size_;
+      }
+      constexpr void pop_front() noexcept {
+        head_ = static_cast<index_type>((head_ + 1) % Capacity);
+        --size_;
+      }
+      constexpr void pop_back() noexcept { --size_; }
+      constexpr void clear() noexcept {
+        head_ = 0;
+        size_ = 0;
+      }
+
+    private:
+      index_type data_[Capacity]{};
+      index_type head_{0};
+      size_t     size_{0};
+    };
+  } // namespace detail
+
+  /// @endcond
+
+  /**
+    @ingroup item_types
+    @headerfile graph.hpp "sgl/graph.hpp"
+
+    This class models a graph item. It stores the last Samples values pushed with push() in a ring
+    buffer, and shows them as a sparkline of block characters (U+2581 to U+2588), followed by the
+    latest value formatted with the same formatters as sgl::Numeric. The value is left out if it
+    does not fit into TextSize.
+
+    The sparkline is scaled to a fixed range, so that a new sample never changes the glyphs of the
+    older samples: push() moves the existing glyphs one position to the left and renders only the
+    new one. The text is one contiguous string, so that it can be shown like the text of any other
+    item, and the shift is therefore linear in Samples, i.e. Samples * glyph_width code units are
+    moved per push(). Only one glyph is rendered, and the minimum and maximum of the stored samples
+    are maintained with monotonic queues and the mean with a running sum, so min(), max() and
+    mean() take constant time, and so does the bookkeeping of push(). For floating point types the
+    running sum is compensated, so that the rounding error of a large sample does not outlive it.
+
+    A char graph encodes each glyph as three UTF-8 code units, other character types use one code
+    unit per glyph. Values are usually pushed from a tick handler:
+
+    ```cpp
+    NAME("temperature") <<= sgl::graph<16, 64, char>(0.0f, 100.0f).set_tick_handler(
+        [](auto& graph) noexcept { graph.push(read_temperature()); })
+    ```
+
+    @tparam Samples number of samples in the history
+    @tparam TextSize text size, at least Samples * glyph_width
+    @tparam CharT character type
+    @tparam T value type
+   */
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  class Graph : public sgl::ItemBase<Graph<Samples, TextSize, CharT, T>> {
+  public:
+    static_assert(Samples > 0, "a graph needs at least one sample");
+    static_assert(std::is_arithmetic_v<T> and !std::is_same_v<bool, T>,
+                  "T must be an integral or floating point type");
+
+    /// base class of Graph
+    using Base = sgl::ItemBase<Graph<Samples, TextSize, CharT, T>>;
+    /// string_view type of this item
+    using StringView = typename Base::StringView;
+    /// value type of this item
+    using value_type = T;
+    /// concrete formatter type, see sgl::Numeric
+    using Formatter_t = Callable<sgl::format_result(CharT*, size_t, T, uint32_t, sgl::format)>;
+
+    /// number of code units of one sparkline glyph
+    static constexpr size_t glyph_width = std::is_same_v<CharT, char> ? 3 : 1;
+
+    static_assert(TextSize >= Samples * glyph_width, "TextSize is too small for the sparkline");
+
+    /**
+      Construct a graph with the default formatter.
+      @param low value shown as the lowest block
+      @param high value shown as the highest block
+     */
+    constexpr Graph(T low, T high) noexcept;
+
+    /**
+      Construct a graph with a custom formatter for the latest value.
+      @tparam Formatter formatter type, see enable_if_is_value_formatter for more details.
+      @param low value shown as the lowest block
+      @param high value shown as the highest block
+      @param formatter formatter instance
+     */
+    template <typename Formatter,
+              enable_if_is_value_formatter<Formatter, Graph<Samples, TextSize, CharT, T>> = true>
+    constexpr Graph(T low, T high, Formatter&& formatter) noexcept;
+
+    /**
+      add a sample. The oldest sample is dropped if the history is full.
+      @param value sample to add
+     */
+    constexpr void push(T value) noexcept;
+
+    /// drop all samples and clear the text.
+    constexpr void clear() noexcept;
+
+    /**
+      set the range of the sparkline and render all glyphs again. This is the only operation whose
+      cost depends on Samples.
+      @param low value shown as the lowest block
+      @param high value shown as the highest block
+     */
+    constexpr void set_range(T low, T high) noexcept;
+
+    /// @return number of stored samples
+    [[nodiscard]] constexpr size_t size() const noexcept;
+
+    /// @return maximum number of stored samples, i.e. Samples
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return Samples; }
+
+    /**
+      get a stored sample.
+      @param i index, 0 is the oldest and size() - 1 the latest sample
+      @return T
+     */
+    [[nodiscard]] constexpr T sample(size_t i) const noexcept;
+
+    /// @return the latest sample, or 0 if there is none
+    [[nodiscard]] constexpr T latest() const noexcept;
+
+    /// @return the smallest stored sample, or 0 if there is none
+    [[nodiscard]] constexpr T min() const noexcept;
+
+    /// @return the largest stored sample, or 0 if there is none
+    [[nodiscard]] constexpr T max() const noexcept;
+
+    /// @return the mean of the stored samples, or 0 if there is none
+    [[nodiscard]] constexpr T mean() const noexcept;
+
+    /**
+      set the formatting precision of the latest value.
+      @param precision number of fractional digits
+     */
+    constexpr void set_precision(uint32_t precision) noexcept;
+
+    /**
+      set the formatting type of the latest value.
+      @param format format to use
+     */
+    constexpr void set_format(sgl::format format) noexcept;
+
+  private:
+    /// type of the running sum
+    using sum_type = std::conditional_t<
+        std::is_floating_point_v<T>,
+        double,
+        std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>>;
+
+    using index_type = sgl::smallest_type_t<Samples>;
+
+    /// add value to the running sum, compensated for rounding errors if T is a floating point type
+    constexpr void add_to_sum(sum_type value) noexcept;
+
+    /// @return index of the block glyph of value, 0 to 7
+    [[nodiscard]] constexpr size_t level(T value) const noexcept;
+
+    /// write the glyph of value to str
+    constexpr void write_glyph(CharT* str, T value) const noexcept;
+
+    /// append the latest value after the sparkline, if it fits
+    constexpr void format_latest() noexcept;
+
+    constexpr static sgl::format_result default_format(CharT*      str,
+                                                       size_t      len,
+                                                       T           value,
+                                                       uint32_t    precision,
+                                                       sgl::format format) noexcept;
+
+    Formatter_t                 format_{&default_format};         ///< formatter
+    T                           samples_[Samples]{};              ///< ring buffer
+    index_type                  next_{0};                         ///< next write position
+    size_t                      size_{0};                         ///< number of samples
+    sum_type                    sum_{0};                          ///< sum of the samples
+    sum_type                    compensation_{0};                 ///< rounding error of sum_
+    detail::IndexQueue<Samples> min_{};                           ///< increasing samples
+    detail::IndexQueue<Samples> max_{};                           ///< decreasing samples
+    T                           low_{0};                          ///< lowest block value
+    T                           high_{0};                         ///< highest block value
+    uint32_t                    precision_{2};                    ///< formatting precision
+    sgl::format                 format_type_{sgl::format::fixed}; ///< formatting type
+  };
+
+  /// @ingroup item_factories
+  /// @addtogroup graph_factories
+  /// @{
+
+  /**
+    create a graph with the default formatter.
+    @tparam Samples number of samples in the history
+    @tparam TextSize text size
+    @tparam CharT character type
+    @tparam T value type
+    @param low value shown as the lowest block
+    @param high value shown as the highest block
+    @return Graph<Samples, TextSize, CharT, T>
+   */
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr Graph<Samples, TextSize, CharT, T> graph(T low, T high) noexcept;
+
+  /// @}
+} // namespace sgl
+
+#include "sgl/impl/graph_impl.hpp"
+#endif /* SGL_GRAPH_HPP */
@@ -0,0 +1,60 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_ACTION_QUEUE_IMPL_HPP
+#define SGL_IMPL_ACTION_QUEUE_IMPL_HPP
+#include "sgl/action_queue.hpp"
+
+#include <utility>
+
+namespace sgl {
+  template <size_t Capacity>
+  template <typename F, typename C>
+  sgl::error ActionQueue<Capacity>::post(F&& action, C&& completion) noexcept {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head - done_.load(std::memory_order_acquire) == Capacity) {
+      return sgl::error::queue_full;
+    }
+    Slot& slot = slots_[head & (Capacity - 1)];
+    slot.action = Action(std::forward<F>(action));
+    slot.completion = Completion(std::forward<C>(completion));
+    head_.store(head + 1, std::memory_order_release);
+    return sgl::error::no_error;
+  }
+
+  template <size_t Capacity>
+  size_t ActionQueue<Capacity>::run(size_t max) noexcept {
+    size_t       count = 0;
+    size_t       run = run_.load(std::memory_order_relaxed);
+    const size_t head = head_.load(std::memory_order_acquire);
+    for (; run != head and count < max; ++run, ++count) {
+      Slot& slot = slots_[run & (Capacity - 1)];
+      slot.result = slot.action();
+      run_.store(run + 1, std::memory_order_release);
+    }
+    return count;
+  }
+
+  template <size_t Capacity>
+  size_t ActionQueue<Capacity>::complete() noexcept {
+    size_t       count = 0;
+    size_t       done = done_.load(std::memory_order_relaxed);
+    const size_t run = run_.load(std::memory_order_acquire);
+    for (; done != run; ++done, ++count) {
+      Slot& slot = slots_[done & (Capacity - 1)];
+      slot.completion(slot.result);
+      slot.action.reset();
+      slot.completion.reset();
+      done_.store(done + 1, std::memory_order_release);
+    }
+    return count;
+  }
+
+  template <size_t Capacity>
+  size_t ActionQueue<Capacity>::pending() const noexcept {
+    return head_.load(std::memory_order_acquire) - done_.load(std::memory_order_acquire);
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_ACTION_QUEUE_IMPL_HPP */
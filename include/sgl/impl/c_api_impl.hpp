@@ -0,0 +1,152 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_C_API_IMPL_HPP
+#define SGL_IMPL_C_API_IMPL_HPP
+#include "sgl/c_api.hpp"
+
+#include <cstdint>
+#include <new>
+
+namespace sgl {
+  template <typename Menu>
+  template <typename Factory>
+  sgl_menu* c_api<Menu>::init(void* storage, Factory&& factory) noexcept {
+    if (storage == nullptr or reinterpret_cast<std::uintptr_t>(storage) % alignof(Menu) != 0) {
+      return nullptr;
+    }
+    return reinterpret_cast<sgl_menu*>(new (storage) Menu(factory()));
+  }
+
+  template <typename Menu>
+  void c_api<Menu>::deinit(sgl_menu* menu) noexcept {
+    if (menu != nullptr) {
+      from_handle(menu).~Menu();
+    }
+  }
+
+  template <typename Menu>
+  template <typename Factory>
+  sgl_menu* c_api<Menu>::create(Factory&& factory) noexcept {
+    return reinterpret_cast<sgl_menu*>(new (std::nothrow) Menu(factory()));
+  }
+
+  template <typename Menu>
+  void c_api<Menu>::destroy(sgl_menu* menu) noexcept {
+    if (menu != nullptr) {
+      delete &from_handle(menu);
+    }
+  }
+
+  template <typename Menu>
+  size_t c_api<Menu>::handle_inputs(sgl_menu*        menu,
+                                    const sgl_input* inputs,
+                                    size_t           n,
+                                    int*             errors) noexcept {
+    auto&  m = from_handle(menu);
+    size_t failed = 0;
+    for (size_t i = 0; i < n; ++i) {
+      const auto ec = m.handle_input(static_cast<sgl::input>(inputs[i]));
+      if (ec != sgl::error::no_error) {
+        ++failed;
+      }
+      if (errors != nullptr) {
+        errors[i] = static_cast<int>(ec);
+      }
+    }
+    return failed;
+  }
+
+  template <typename Menu>
+  void c_api<Menu>::tick(sgl_menu* menu) noexcept {
+    from_handle(menu).tick();
+  }
+
+  template <typename Menu>
+  void c_api<Menu>::current_page(const sgl_menu* menu, sgl_page* page) noexcept {
+    const auto& m = from_handle(menu);
+    const auto  name = m.page_name();
+    page->name = name.data();
+    page->name_size = name.size();
+    page->index = m.current_page_index();
+    m.for_current_page([page](const auto& p) {
+      page->size = p.size();
+      page->current_item = p.current_item_index();
+      page->edit_mode = p.is_in_edit_mode() ? 1 : 0;
+    });
+  }
+
+  template <typename Menu>
+  size_t c_api<Menu>::render(const sgl_menu* menu,
+                             sgl_line*       lines,
+                             size_t          first,
+                             size_t          count) noexcept {
+    // the current page is dispatched once, the names and texts are then looked up in constant time
+    return from_handle(menu).for_current_page([lines, first, count](const auto& page) -> size_t {
+      const size_t   size = page.size();
+      const size_t   current = page.current_item_index();
+      const unsigned edit = page.is_in_edit_mode() ? SGL_LINE_EDIT : 0u;
+      size_t         written = 0;
+      for (size_t i = first; i < size and written < count; ++i, ++written) {
+        const auto name = page.item_name(i);
+        const auto text = page.item_text(i);
+        auto&      line = lines[written];
+        line.name = name.data();
+        line.name_size = name.size();
+        line.text = text.data();
+        line.text_size = text.size();
+        line.index = i;
+        line.flags = i == current ? (SGL_LINE_CURRENT | edit) : 0u;
+      }
+      return written;
+    });
+  }
+
+  template <typename Menu>
+  int c_api<Menu>::set(sgl_menu* menu, const char* path, const char* value) noexcept {
+    return static_cast<int>(
+        from_handle(menu).set(sgl::string_view<char>(path), sgl::string_view<char>(value)));
+  }
+
+  template <typename Menu>
+  size_t c_api<Menu>::set_values(sgl_menu*          menu,
+                                 const char* const* paths,
+                                 const char* const* values,
+                                 size_t             n,
+                                 int*               errors) noexcept {
+    auto&  m = from_handle(menu);
+    size_t failed = 0;
+    for (size_t i = 0; i < n; ++i) {
+      const auto ec = m.set(sgl::string_view<char>(paths[i]), sgl::string_view<char>(values[i]));
+      if (ec != sgl::error::no_error) {
+        ++failed;
+      }
+      if (errors != nullptr) {
+        errors[i] = static_cast<int>(ec);
+      }
+    }
+    return failed;
+  }
+
+  template <typename Menu>
+  int c_api<Menu>::get(const sgl_menu* menu,
+                       const char*     path,
+                       char*           buffer,
+                       size_t          len,
+                       size_t*         written) noexcept {
+    if (len == 0) {
+      return static_cast<int>(sgl::error::buffer_too_small);
+    }
+    // one character is reserved for the null terminator
+    const auto res = from_handle(menu).get(sgl::string_view<char>(path), buffer, len - 1);
+    const auto size = res.ec == sgl::error::no_error ? res.size : 0;
+    buffer[size] = '\0';
+    if (written != nullptr) {
+      *written = size;
+    }
+    return static_cast<int>(res.ec);
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_C_API_IMPL_HPP */
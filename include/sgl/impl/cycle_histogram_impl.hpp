@@ -0,0 +1,158 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_CYCLE_HISTOGRAM_IMPL_HPP
+#define SGL_IMPL_CYCLE_HISTOGRAM_IMPL_HPP
+#include "sgl/cycle_histogram.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+#elif !defined(__aarch64__)
+  #include <chrono>
+#endif
+
+namespace sgl {
+  inline uint64_t cycle_clock::now() noexcept {
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || \
+    defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t count;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(count));
+    return count;
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#endif
+  }
+
+  constexpr void CycleStats::add(uint64_t cycles) noexcept {
+    ++count;
+    total += cycles;
+    min = cycles < min ? cycles : min;
+    max = cycles > max ? cycles : max;
+    size_t bucket = 0;
+    while (cycles != 0 and bucket < num_buckets - 1) {
+      cycles >>= 1;
+      ++bucket;
+    }
+    ++buckets[bucket];
+  }
+
+  template <typename Menu, typename Clock>
+  void CycleHistogram<Menu, Clock>::begin(const sgl::Event& e) noexcept {
+    static_cast<void>(e);
+    if (depth_ < max_depth) {
+      start_[depth_] = Clock::now();
+    }
+    ++depth_;
+  }
+
+  template <typename Menu, typename Clock>
+  void CycleHistogram<Menu, Clock>::end(const sgl::Event& e) noexcept {
+    const uint64_t now = Clock::now();
+    if (depth_ == 0) {
+      return;
+    }
+    --depth_;
+    if (depth_ < max_depth) {
+      auto& stats = stats_[index_of(e)];
+      stats.add(now - start_[depth_]);
+      stats.page_name = e.page_name;
+      stats.item_name = e.item_name;
+    }
+  }
+
+  template <typename Menu, typename Clock>
+  const sgl::CycleStats& CycleHistogram<Menu, Clock>::stats(const sgl::Event& e) const noexcept {
+    return stats_[index_of(e)];
+  }
+
+  template <typename Menu, typename Clock>
+  template <typename F>
+  void CycleHistogram<Menu, Clock>::for_each(F&& f) const {
+    using Layout = cycle_histogram_impl::layout<Menu>;
+    for (size_t i = 0; i < size; ++i) {
+      if (stats_[i].count == 0) {
+        continue;
+      }
+      sgl::event_kind kind = sgl::event_kind::item_tick;
+      if (i == 0) {
+        kind = sgl::event_kind::handle_input;
+      } else if (i == 1) {
+        kind = sgl::event_kind::tick;
+      } else if (i < 2 + Layout::num_pages) {
+        kind = sgl::event_kind::on_enter;
+      } else if (i < Layout::first_item) {
+        kind = sgl::event_kind::on_exit;
+      }
+      f(kind, stats_[i]);
+    }
+  }
+
+  template <typename Menu, typename Clock>
+  void CycleHistogram<Menu, Clock>::dump(std::FILE* file) const noexcept {
+    constexpr const char* kind_names[] = {
+        "handle_input", "tick", "on_enter", "on_exit", "item_tick"};
+    for_each([file, &kind_names](sgl::event_kind kind, const sgl::CycleStats& s) {
+      std::fprintf(file,
+                   "%-12s %.*s%s%.*s count=%llu min=%llu mean=%llu max=%llu",
+                   kind_names[static_cast<size_t>(kind)],
+                   static_cast<int>(s.page_name.size()),
+                   s.page_name.data(),
+                   s.item_name.size() != 0 ? "/" : "",
+                   static_cast<int>(s.item_name.size()),
+                   s.item_name.data(),
+                   static_cast<unsigned long long>(s.count),
+                   static_cast<unsigned long long>(s.min),
+                   static_cast<unsigned long long>(s.total / s.count),
+                   static_cast<unsigned long long>(s.max));
+      // bucket i holds durations below 2^i, bucket 0 only zero durations
+      for (size_t i = 0; i < sgl::CycleStats::num_buckets; ++i) {
+        if (s.buckets[i] == 0) {
+          continue;
+        }
+        if (i == 0) {
+          std::fprintf(file, " [0]=%lu", static_cast<unsigned long>(s.buckets[i]));
+        } else {
+          std::fprintf(file,
+                       " [2^%u]=%lu",
+                       static_cast<unsigned>(i),
+                       static_cast<unsigned long>(s.buckets[i]));
+        }
+      }
+      std::fputc('\n', file);
+    });
+  }
+
+  template <typename Menu, typename Clock>
+  void CycleHistogram<Menu, Clock>::clear() noexcept {
+    for (auto& s : stats_) {
+      s = sgl::CycleStats{};
+    }
+  }
+
+  template <typename Menu, typename Clock>
+  size_t CycleHistogram<Menu, Clock>::index_of(const sgl::Event& e) noexcept {
+    using Layout = cycle_histogram_impl::layout<Menu>;
+    switch (e.kind) {
+      case sgl::event_kind::handle_input:
+        return 0;
+      case sgl::event_kind::tick:
+        return 1;
+      case sgl::event_kind::on_enter:
+        return 2 + e.page;
+      case sgl::event_kind::on_exit:
+        return 2 + Layout::num_pages + e.page;
+      case sgl::event_kind::item_tick:
+      default:
+        return Layout::item_offset[e.page] + e.item;
+    }
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_CYCLE_HISTOGRAM_IMPL_HPP */
@@ -33,6 +33,12 @@ namespace sgl {
     return map_.get_view(index_);
   }
 
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr const sgl::EnumMap<T, NumEnumerators, CharT>&
+      Enum<T, NumEnumerators, TextSize, CharT>::get_map() const noexcept {
+    return map_;
+  }
+
   template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
   constexpr size_t Enum<T, NumEnumerators, TextSize, CharT>::index() const noexcept {
     return index_;
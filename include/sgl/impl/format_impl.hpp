@@ -285,18 +285,22 @@ namespace sgl {
 
       static_assert(std::is_integral_v<T>, "T must be an integral type");
       // static_assert(std::is_unsigned_v<T>, "");
-      constexpr size_t           size = 2 * sizeof(T) + 3; // +2 for '0x', + 1 for '-'
+      constexpr size_t           size = 2 * sizeof(T) + 4; // +2 for '0x', + 1 for '-', + 1 for '\0'
       static_string<CharT, size> buf{};
+      // the magnitude is computed unsigned, -min of a signed type is not representable in T.
+      using U = std::make_unsigned_t<T>;
+      U magnitude = static_cast<U>(value);
       if constexpr (std::is_signed_v<T>) {
         if (value < 0) {
           buf.append(CharT{'-'});
-          value = -value;
+          magnitude = static_cast<U>(U{0} - magnitude);
         }
       }
-      buf.append("0x", 2);
-      for (size_t pow16 = biggest_pow16(value); pow16 != 0; pow16 /= base) {
-        buf.append(hex_char(static_cast<T>(value / pow16)));
-        value = value % pow16;
+      buf.append(CharT{'0'});
+      buf.append(CharT{'x'});
+      for (size_t pow16 = biggest_pow16(magnitude); pow16 != 0; pow16 /= base) {
+        buf.append(hex_char(static_cast<T>(magnitude / pow16)));
+        magnitude = static_cast<U>(magnitude % pow16);
       }
       if (buf.size() >= len) {
         return {sgl::error::format_error, 0};
@@ -313,15 +317,18 @@ namespace sgl {
       static_assert(std::is_integral_v<T>, "T must be an integral type");
       constexpr size_t                                          base = 10;
       static_string<CharT, sgl::format_impl::max_buf_size_v<T>> buf{};
+      // the magnitude is computed unsigned, -min of a signed type is not representable in T.
+      using U = std::make_unsigned_t<T>;
+      U magnitude = static_cast<U>(value);
       if constexpr (std::is_signed_v<T>) {
         if (value < 0) {
           buf.append(CharT{'-'});
-          value = -value;
+          magnitude = static_cast<U>(U{0} - magnitude);
         }
       }
-      for (size_t pow10 = biggest_pow10(value); pow10 != 0; pow10 /= base) {
-        buf.append(static_cast<CharT>(value / pow10 + '0'));
-        value = value % pow10;
+      for (size_t pow10 = biggest_pow10(magnitude); pow10 != 0; pow10 /= base) {
+        buf.append(static_cast<CharT>(magnitude / pow10 + '0'));
+        magnitude = static_cast<U>(magnitude % pow10);
       }
       if (buf.size() > len) {
         return {sgl::error::buffer_too_small, 0};
@@ -373,32 +380,49 @@ namespace sgl {
       static_assert(std::is_same_v<CharT, char>,
                     "only CharT=char supported with floating point parsing");
 
-      if (ryu::s2f_n(str, &value) == ryu::status::success)
+      if (ryu::s2f_n(str, static_cast<int>(len), &value) == ryu::status::success)
         return sgl::error::no_error;
       else
         return sgl::error::format_error;
 
     } else {
 
-      if ((len > sgl::format_impl::max_buf_size_v<T>) || (len == 0))
+      if (len > sgl::format_impl::max_buf_size_v<T>)
         return sgl::error::format_error;
 
       bool   negative = false;
       size_t i{0};
-      if (str[0] == '-') {
+      if (len != 0 and str[0] == '-') {
+        if constexpr (std::is_unsigned_v<T>) {
+          return sgl::error::format_error;
+        }
         negative = true;
         i = 1;
       }
-      T val{0};
+      if (i == len) {
+        return sgl::error::invalid_value;
+      }
+      constexpr T min = std::numeric_limits<T>::min();
+      constexpr T max = std::numeric_limits<T>::max();
+      T           val{0};
       for (; i < len; ++i) {
-        if ((str[i] >= '0') and (str[i] <= '9')) {
-          val = val * 10 + (str[i] - '0');
-        } else {
+        if ((str[i] < '0') or (str[i] > '9')) {
           return sgl::error::format_error;
         }
+        const T digit = static_cast<T>(str[i] - '0');
+        // negative values are accumulated below zero, so that min is reachable.
+        if (negative) {
+          if (val < (min + digit) / 10) {
+            return sgl::error::out_of_range;
+          }
+          val = static_cast<T>(val * 10 - digit);
+        } else {
+          if (val > (max - digit) / 10) {
+            return sgl::error::out_of_range;
+          }
+          val = static_cast<T>(val * 10 + digit);
+        }
       }
-      if (negative)
-        val = -val;
       value = val;
       return sgl::error::no_error;
     }
@@ -517,13 +541,13 @@ namespace sgl {
         size = ryu::f2s_buffered_n(value, buf.data());
         break;
       case sgl::format::exponential:
-        size = ryu::d2exp_buffered_n(value, precision, buf.data());
+        size = ryu::f2exp_buffered_n(value, precision, buf.data());
         break;
       case sgl::format::fixed:
-        size = ryu::d2fixed_buffered_n(value, precision, buf.data());
+        size = ryu::f2fixed_buffered_n(value, precision, buf.data());
         break;
       case sgl::format::integer:
-        size = ryu::d2fixed_buffered_n(gcem::round(value), 0, buf.data());
+        size = ryu::f2fixed_buffered_n(gcem::round(value), 0, buf.data());
         break;
       case sgl::format::hex:
         return sgl::format_impl::basic_hex_format(str, len, ryu::to_bits(value));
@@ -701,13 +725,13 @@ namespace sgl {
           size = ryu::cx::f2s_buffered_n(value, buf.data());
           break;
         case sgl::format::exponential:
-          size = ryu::cx::d2exp_buffered_n(value, precision, buf.data());
+          size = ryu::cx::f2exp_buffered_n(value, precision, buf.data());
           break;
         case sgl::format::fixed:
-          size = ryu::cx::d2fixed_buffered_n(value, precision, buf.data());
+          size = ryu::cx::f2fixed_buffered_n(value, precision, buf.data());
           break;
         case sgl::format::integer:
-          size = ryu::cx::d2fixed_buffered_n(gcem::round(value), 0, buf.data());
+          size = ryu::cx::f2fixed_buffered_n(gcem::round(value), 0, buf.data());
           break;
         case sgl::format::hex:
           return sgl::format_impl::basic_hex_format(str, len, ryu::cx::to_bits(value));
@@ -0,0 +1,230 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_GRAPH_IMPL_HPP
+#define SGL_IMPL_GRAPH_IMPL_HPP
+#include "sgl/graph.hpp"
+
+namespace sgl {
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr Graph<Samples, TextSize, CharT, T>::Graph(T low, T high) noexcept
+      : Base(sgl::string_view<CharT>{}), low_(low), high_(high) {}
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  template <typename Formatter,
+            enable_if_is_value_formatter<Formatter, Graph<Samples, TextSize, CharT, T>>>
+  constexpr Graph<Samples, TextSize, CharT, T>::Graph(T           low,
+                                                      T           high,
+                                                      Formatter&& formatter) noexcept
+      : Base(sgl::string_view<CharT>{}), format_(std::forward<Formatter>(formatter)), low_(low),
+        high_(high) {}
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr void Graph<Samples, TextSize, CharT, T>::push(T value) noexcept {
+    const index_type pos = next_;
+    const bool       full = size_ == Samples;
+    if (full) {
+      // the sample at pos is the oldest one and leaves the window
+      if constexpr (std::is_floating_point_v<T>) {
+        add_to_sum(-static_cast<sum_type>(samples_[pos]));
+      } else {
+        sum_ -= static_cast<sum_type>(samples_[pos]);
+      }
+      if (min_.front() == pos) {
+        min_.pop_front();
+      }
+      if (max_.front() == pos) {
+        max_.pop_front();
+      }
+    } else {
+      ++size_;
+    }
+    samples_[pos] = value;
+    add_to_sum(static_cast<sum_type>(value));
+    while (not min_.empty() and not(samples_[min_.back()] < value)) {
+      min_.pop_back();
+    }
+    min_.push_back(pos);
+    while (not max_.empty() and not(value < samples_[max_.back()])) {
+      max_.pop_back();
+    }
+    max_.push_back(pos);
+    next_ = static_cast<index_type>((pos + 1) % Samples);
+
+    // shift the sparkline by one glyph and render only the new one
+    auto&        text = this->text();
+    const size_t glyphs = size_ * glyph_width;
+    CharT*       str = text.data();
+    if (full) {
+      for (size_t i = glyph_width; i < glyphs; ++i) {
+        str[i - glyph_width] = str[i];
+      }
+    }
+    write_glyph(str + glyphs - glyph_width, value);
+    text.resize(glyphs);
+    format_latest();
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr void Graph<Samples, TextSize, CharT, T>::clear() noexcept {
+    next_ = 0;
+    size_ = 0;
+    sum_ = 0;
+    compensation_ = 0;
+    min_.clear();
+    max_.clear();
+    this->clear_text();
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr void Graph<Samples, TextSize, CharT, T>::set_range(T low, T high) noexcept {
+    low_ = low;
+    high_ = high;
+    if (size_ == 0) {
+      return;
+    }
+    CharT* str = this->text().data();
+    for (size_t i = 0; i < size_; ++i) {
+      write_glyph(str + i * glyph_width, sample(i));
+    }
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr size_t Graph<Samples, TextSize, CharT, T>::size() const noexcept {
+    return size_;
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr T Graph<Samples, TextSize, CharT, T>::sample(size_t i) const noexcept {
+    // the oldest sample is at next_ once the buffer is full, and at 0 before
+    const size_t first = size_ == Samples ? next_ : 0;
+    return samples_[(first + i) % Samples];
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr T Graph<Samples, TextSize, CharT, T>::latest() const noexcept {
+    return size_ == 0 ? T{0} : samples_[(next_ + Samples - 1) % Samples];
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr T Graph<Samples, TextSize, CharT, T>::min() const noexcept {
+    return size_ == 0 ? T{0} : samples_[min_.front()];
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr T Graph<Samples, TextSize, CharT, T>::max() const noexcept {
+    return size_ == 0 ? T{0} : samples_[max_.front()];
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr T Graph<Samples, TextSize, CharT, T>::mean() const noexcept {
+    return size_ == 0 ? T{0}
+                      : static_cast<T>((sum_ + compensation_) / static_cast<sum_type>(size_));
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr void Graph<Samples, TextSize, CharT, T>::set_precision(uint32_t precision) noexcept {
+    precision_ = precision;
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr void Graph<Samples, TextSize, CharT, T>::set_format(sgl::format format) noexcept {
+    format_type_ = format;
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr void Graph<Samples, TextSize, CharT, T>::add_to_sum(sum_type value) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+      // Neumaier summation: the rounding error of every addition is kept in compensation_, so a
+      // large sample which left the window does not distort the mean for good.
+      const sum_type sum = sum_ + value;
+      const sum_type abs_sum = sum_ < 0 ? -sum_ : sum_;
+      const sum_type abs_value = value < 0 ? -value : value;
+      compensation_ += abs_sum >= abs_value ? (sum_ - sum) + value : (value - sum) + sum_;
+      sum_ = sum;
+    } else {
+      sum_ += value;
+    }
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr size_t Graph<Samples, TextSize, CharT, T>::level(T value) const noexcept {
+    if (not(low_ < value)) {
+      return 0;
+    }
+    if (not(value < high_)) {
+      return 7;
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+      const auto l = static_cast<size_t>(
+          (static_cast<sum_type>(value) - static_cast<sum_type>(low_)) * 8 /
+          (static_cast<sum_type>(high_) - static_cast<sum_type>(low_)));
+      return l > 7 ? 7 : l;
+    } else {
+      // low_ < value < high_, so the unsigned differences are exact even for the full range of T.
+      // offset * 8 may still overflow, so the level is found by comparing offset with the
+      // thresholds ceil(l * range / 8) instead.
+      using U = unsigned long long;
+      const U offset = static_cast<U>(value) - static_cast<U>(low_);
+      const U range = static_cast<U>(high_) - static_cast<U>(low_);
+      size_t  l = 0;
+      while (l < 7 and offset >= (l + 1) * (range / 8) + ((l + 1) * (range % 8) + 7) / 8) {
+        ++l;
+      }
+      return l;
+    }
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr void Graph<Samples, TextSize, CharT, T>::write_glyph(CharT* str,
+                                                                 T      value) const noexcept {
+    const size_t l = level(value);
+    if constexpr (glyph_width == 3) {
+      // UTF-8 encoding of U+2581 + l
+      str[0] = static_cast<CharT>(0xE2);
+      str[1] = static_cast<CharT>(0x96);
+      str[2] = static_cast<CharT>(0x81 + l);
+    } else {
+      str[0] = static_cast<CharT>(0x2581 + l);
+    }
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr void Graph<Samples, TextSize, CharT, T>::format_latest() noexcept {
+    auto&        text = this->text();
+    const size_t glyphs = text.size();
+    // one character for the separating space, and at least one for the value
+    if (TextSize < glyphs + 2) {
+      return;
+    }
+    text.resize(TextSize);
+    CharT* str = text.data();
+    str[glyphs] = CharT{' '};
+    const format_result res =
+        format_(str + glyphs + 1, TextSize - glyphs - 1, latest(), precision_, format_type_);
+    text.resize(res.ec == sgl::error::no_error ? glyphs + 1 + res.size : glyphs);
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr sgl::format_result
+      Graph<Samples, TextSize, CharT, T>::default_format(CharT*      str,
+                                                         size_t      len,
+                                                         T           value,
+                                                         uint32_t    precision,
+                                                         sgl::format format) noexcept {
+    if constexpr (std::is_integral_v<T>) {
+      (void)precision;
+      (void)format;
+      return sgl::to_chars(str, len, value);
+    } else
+      return sgl::to_chars(str, len, value, precision, format);
+  }
+
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  constexpr Graph<Samples, TextSize, CharT, T> graph(T low, T high) noexcept {
+    return Graph<Samples, TextSize, CharT, T>(low, high);
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_GRAPH_IMPL_HPP */
@@ -0,0 +1,64 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_LOCALE_IMPL_HPP
+#define SGL_IMPL_LOCALE_IMPL_HPP
+#include "sgl/locale.hpp"
+
+namespace sgl {
+  template <typename CharT>
+  template <size_t Languages, size_t Strings>
+  constexpr Locale<CharT>::Locale(const StringTable<CharT, Languages, Strings>& table,
+                                  size_t                                       language) noexcept
+      : table_(&table),
+        row_([](const void* t, size_t l) noexcept -> const sgl::string_view<CharT>* {
+          return static_cast<const StringTable<CharT, Languages, Strings>*>(t)->strings[l];
+        }),
+        current_(table.strings[language < Languages ? language : 0]), languages_(Languages),
+        size_(Strings), language_(language < Languages ? language : 0) {}
+
+  template <typename CharT>
+  constexpr sgl::error Locale<CharT>::set_language(size_t language) noexcept {
+    if (language >= languages_) {
+      return sgl::error::out_of_range;
+    }
+    if (language != language_) {
+      current_ = row_(table_, language);
+      language_ = language;
+      ++generation_;
+    }
+    return sgl::error::no_error;
+  }
+
+  template <typename CharT>
+  constexpr size_t Locale<CharT>::language() const noexcept {
+    return language_;
+  }
+
+  template <typename CharT>
+  constexpr size_t Locale<CharT>::languages() const noexcept {
+    return languages_;
+  }
+
+  template <typename CharT>
+  constexpr size_t Locale<CharT>::size() const noexcept {
+    return size_;
+  }
+
+  template <typename CharT>
+  template <typename Id>
+  constexpr sgl::string_view<CharT> Locale<CharT>::get(Id id) const noexcept {
+    static_assert(std::is_enum_v<Id> or std::is_integral_v<Id>,
+                  "string ids must be enumerators or integers");
+    const auto i = static_cast<size_t>(id);
+    return i < size_ ? current_[i] : sgl::string_view<CharT>{};
+  }
+
+  template <typename CharT>
+  constexpr uint32_t Locale<CharT>::generation() const noexcept {
+    return generation_;
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_LOCALE_IMPL_HPP */
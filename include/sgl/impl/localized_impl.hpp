@@ -0,0 +1,167 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_LOCALIZED_IMPL_HPP
+#define SGL_IMPL_LOCALIZED_IMPL_HPP
+#include "sgl/localized.hpp"
+
+namespace sgl {
+  template <size_t TextSize, typename CharT>
+  template <typename Id>
+  constexpr LocalizedText<TextSize, CharT>::LocalizedText(const sgl::Locale<CharT>& locale,
+                                                          Id                        id) noexcept
+      : Base(StringView{}), locale_(&locale), id_(static_cast<size_t>(id)) {}
+
+  template <size_t TextSize, typename CharT>
+  constexpr size_t LocalizedText<TextSize, CharT>::id() const noexcept {
+    return id_;
+  }
+
+  template <size_t TextSize, typename CharT>
+  template <typename Id>
+  constexpr void LocalizedText<TextSize, CharT>::set_id(Id id) noexcept {
+    id_ = static_cast<size_t>(id);
+    render();
+  }
+
+  template <size_t TextSize, typename CharT>
+  constexpr void LocalizedText<TextSize, CharT>::refresh() noexcept {
+    if (not rendered_ or generation_ != locale_->generation()) {
+      render();
+    }
+  }
+
+  template <size_t TextSize, typename CharT>
+  template <typename Menu>
+  constexpr void LocalizedText<TextSize, CharT>::set_menu(Menu* menu) noexcept {
+    static_cast<void>(menu);
+    refresh();
+  }
+
+  template <size_t TextSize, typename CharT>
+  constexpr void LocalizedText<TextSize, CharT>::render() noexcept {
+    static_cast<void>(this->set_text(locale_->get(id_)));
+    generation_ = locale_->generation();
+    rendered_ = true;
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  template <typename Id>
+  constexpr LocalizedEnum<T, NumEnumerators, TextSize, CharT>::LocalizedEnum(
+      const sgl::Locale<CharT>& locale,
+      const T (&values)[NumEnumerators],
+      Id     first_id,
+      size_t start_index) noexcept
+      : Base(StringView{}, &default_handle_input), locale_(&locale),
+        first_id_(static_cast<size_t>(first_id)),
+        index_(static_cast<sgl::smallest_type_t<NumEnumerators>>(start_index % NumEnumerators)) {
+    for (size_t i = 0; i < NumEnumerators; ++i) {
+      values_[i] = values[i];
+    }
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr size_t LocalizedEnum<T, NumEnumerators, TextSize, CharT>::num_values() const noexcept {
+    return NumEnumerators;
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr size_t LocalizedEnum<T, NumEnumerators, TextSize, CharT>::index() const noexcept {
+    return index_;
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr void LocalizedEnum<T, NumEnumerators, TextSize, CharT>::set_index(size_t i) noexcept {
+    index_ = static_cast<sgl::smallest_type_t<NumEnumerators>>(i % NumEnumerators);
+    render();
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr T LocalizedEnum<T, NumEnumerators, TextSize, CharT>::get_value() const noexcept {
+    return values_[index_];
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr sgl::error
+      LocalizedEnum<T, NumEnumerators, TextSize, CharT>::set_value(T value) noexcept {
+    for (size_t i = 0; i < NumEnumerators; ++i) {
+      if (values_[i] == value) {
+        set_index(i);
+        return sgl::error::no_error;
+      }
+    }
+    return sgl::error::invalid_value;
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr typename LocalizedEnum<T, NumEnumerators, TextSize, CharT>::StringView
+      LocalizedEnum<T, NumEnumerators, TextSize, CharT>::string(size_t i) const noexcept {
+    return i < NumEnumerators ? locale_->get(first_id_ + i) : StringView{};
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr typename LocalizedEnum<T, NumEnumerators, TextSize, CharT>::StringView
+      LocalizedEnum<T, NumEnumerators, TextSize, CharT>::current_string() const noexcept {
+    return string(index_);
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr void LocalizedEnum<T, NumEnumerators, TextSize, CharT>::refresh() noexcept {
+    if (not rendered_ or generation_ != locale_->generation()) {
+      render();
+    }
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  template <typename Menu>
+  constexpr void LocalizedEnum<T, NumEnumerators, TextSize, CharT>::set_menu(Menu* menu) noexcept {
+    static_cast<void>(menu);
+    refresh();
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr void LocalizedEnum<T, NumEnumerators, TextSize, CharT>::render() noexcept {
+    static_cast<void>(this->set_text(current_string()));
+    generation_ = locale_->generation();
+    rendered_ = true;
+  }
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  constexpr sgl::error LocalizedEnum<T, NumEnumerators, TextSize, CharT>::default_handle_input(
+      LocalizedEnum& item,
+      sgl::input     input) noexcept {
+    switch (input) {
+      case sgl::input::right:
+        [[fallthrough]];
+      case sgl::input::up:
+        item.set_index((item.index() + 1) % item.num_values());
+        break;
+      case sgl::input::left:
+        [[fallthrough]];
+      case sgl::input::down:
+        item.set_index(item.index() == 0 ? item.num_values() - 1 : item.index() - 1);
+        break;
+      default:
+        break;
+    }
+    return sgl::error::no_error;
+  }
+
+  template <size_t TextSize, typename CharT, typename Id>
+  constexpr LocalizedText<TextSize, CharT> localized_text(const sgl::Locale<CharT>& locale,
+                                                          Id                        id) noexcept {
+    return LocalizedText<TextSize, CharT>(locale, id);
+  }
+
+  template <size_t TextSize, typename T, size_t NumEnumerators, typename CharT, typename Id>
+  constexpr LocalizedEnum<T, NumEnumerators, TextSize, CharT>
+      localized_enum(const sgl::Locale<CharT>& locale,
+                     const T (&values)[NumEnumerators],
+                     Id     first_id,
+                     size_t start_index) noexcept {
+    return LocalizedEnum<T, NumEnumerators, TextSize, CharT>(locale, values, first_id, start_index);
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_LOCALIZED_IMPL_HPP */
@@ -13,7 +13,8 @@ namespace sgl {
   template <typename NameList, typename PageList>
   constexpr Menu<NameList, PageList>::Menu(const Menu& other) noexcept(
       std::is_nothrow_copy_constructible_v<PageTuple>)
-      : pages_(other.pages_), input_handler_(other.input_handler_), index_(other.index_) {
+      : pages_(other.pages_), input_handler_(other.input_handler_), index_(other.index_),
+        tick_page_(other.tick_page_), tick_item_(other.tick_item_) {
     for_each(pages_, [this](auto& page) { page.set_menu(this); });
   }
 
@@ -21,7 +22,8 @@ namespace sgl {
   constexpr Menu<NameList, PageList>::Menu(Menu&& other) noexcept(
       std::is_nothrow_move_constructible_v<PageTuple>)
       : pages_(std::move(other.pages_)), input_handler_(std::move(other.input_handler_)),
-        index_(std::move(other.index_)) {
+        index_(std::move(other.index_)), tick_page_(other.tick_page_),
+        tick_item_(other.tick_item_) {
     for_each(pages_, [this](auto& page) { page.set_menu(this); });
   }
 
@@ -43,13 +45,99 @@ namespace sgl {
 
   template <typename NameList, typename PageList>
   constexpr sgl::error Menu<NameList, PageList>::handle_input(sgl::input i) noexcept {
-    return for_current_page(
-        [i](auto& page) noexcept -> sgl::error { return page.handle_input(i); });
+    return observer_impl::observe<Menu>(
+        [this] { return current_page_event(sgl::event_kind::handle_input); },
+        [this, i] {
+          return for_current_page(
+              [i](auto& page) noexcept -> sgl::error { return page.handle_input(i); });
+        });
+  }
+
+  template <typename NameList, typename PageList>
+  constexpr void Menu<NameList, PageList>::refresh() noexcept {
+    for_current_page([](auto& page) noexcept { page.refresh(); });
   }
 
   template <typename NameList, typename PageList>
   constexpr void Menu<NameList, PageList>::tick() noexcept {
-    for_each(pages_, [](auto& page) { page.tick(); });
+    drain_actions();
+    if constexpr (!sgl::ObserverTraits<Menu>::enabled) {
+      for_each(pages_, [](auto& page) { page.tick(); });
+    } else {
+      // tick the items one by one instead of through Page::tick(), so each gets its own event.
+      observer_impl::observe<Menu>(
+          [] {
+            return sgl::Event{sgl::event_kind::tick, sgl::Event::npos, sgl::Event::npos, {}, {}};
+          },
+          [this] {
+            size_t page_index = 0;
+            for_each_page_with_name([&page_index](auto page_name, auto& page) {
+              size_t item_index = 0;
+              page.for_each_item_with_name([&](auto item_name, auto& item) {
+                observer_impl::observe<Menu>(
+                    [&] {
+                      return sgl::Event{sgl::event_kind::item_tick,
+                                        page_index,
+                                        item_index,
+                                        page_name.to_view(),
+                                        item_name.to_view()};
+                    },
+                    [&item] { item.tick(); });
+                ++item_index;
+              });
+              ++page_index;
+            });
+          });
+    }
+  }
+
+  template <typename NameList, typename PageList>
+  template <typename Duration, typename Clock>
+  constexpr size_t Menu<NameList, PageList>::tick_for(Duration budget, Clock&& clock) {
+    const auto start = clock();
+    drain_actions();
+    size_t ticked = 0;
+    do {
+      tick_next();
+      ++ticked;
+    } while (ticked < num_items and (clock() - start) < budget);
+    return ticked;
+  }
+
+  template <typename NameList, typename PageList>
+  constexpr void Menu<NameList, PageList>::drain_actions() noexcept {
+    if (!actions_.is_threaded()) {
+      static_cast<void>(actions_.run());
+    }
+    static_cast<void>(actions_.complete());
+  }
+
+  template <typename NameList, typename PageList>
+  constexpr void Menu<NameList, PageList>::tick_next() noexcept {
+    auto f = [this](auto& page) {
+      observer_impl::observe<Menu>(
+          [this, &page] {
+            return sgl::Event{sgl::event_kind::item_tick,
+                              tick_page_,
+                              tick_item_,
+                              sgl::NameTable<NameList>::name(tick_page_),
+                              page.item_name(tick_item_)};
+          },
+          [this, &page] { page.tick_item(tick_item_); });
+      if (++tick_item_ == page.size()) {
+        tick_item_ = 0;
+        tick_page_ =
+            static_cast<decltype(tick_page_)>((tick_page_ + 1) % sgl::list_size_v<PageList>);
+      }
+    };
+    static_cast<void>(name_table_impl::visit(
+        pages_, tick_page_, f, std::make_index_sequence<sgl::list_size_v<PageList>>{}));
+  }
+
+  template <typename NameList, typename PageList>
+  template <typename F, typename C>
+  sgl::error Menu<NameList, PageList>::post(F&& action, C&& completion) noexcept {
+    return actions_.post(std::forward<F>(action), std::forward<C>(completion));
   }
 
   template <typename NameList, typename PageList>
@@ -69,14 +157,19 @@ namespace sgl {
       return sgl::error::out_of_range;
     }
 
-    auto ec = for_current_page([](auto& page) { return page.on_exit(); });
+    auto ec = observer_impl::observe<Menu>(
+        [this] { return current_page_event(sgl::event_kind::on_exit); },
+        [this] { return for_current_page([](auto& page) { return page.on_exit(); }); });
     if (ec != sgl::error::no_error) {
       return ec;
     }
 
     index_ = page_index;
+    refresh();
 
-    return for_current_page([](auto& page) { return page.on_enter(); });
+    return observer_impl::observe<Menu>(
+        [this] { return current_page_event(sgl::event_kind::on_enter); },
+        [this] { return for_current_page([](auto& page) { return page.on_enter(); }); });
   }
 
   template <typename NameList, typename PageList>
@@ -91,6 +184,99 @@ namespace sgl {
     }
   }
 
+  template <typename NameList, typename PageList>
+  constexpr sgl::error
+      Menu<NameList, PageList>::set_current_page(sgl::string_view<char> name) noexcept {
+    const size_t i = find_page(name);
+    if (i == sgl::list_size_v<PageList>) {
+      return sgl::error::page_not_found;
+    }
+    return set_current_page(i);
+  }
+
+  template <typename NameList, typename PageList>
+  constexpr size_t Menu<NameList, PageList>::find_page(sgl::string_view<char> name) noexcept {
+    return sgl::NameTable<NameList>::find(name);
+  }
+
+  template <typename NameList, typename PageList>
+  template <typename F>
+  constexpr sgl::error Menu<NameList, PageList>::visit_page(sgl::string_view<char> name, F&& f) {
+    const size_t i = find_page(name);
+    if (i == sgl::list_size_v<PageList>) {
+      return sgl::error::page_not_found;
+    }
+    return name_table_impl::visit(pages_,
+                                  i,
+                                  f,
+                                  std::make_index_sequence<sgl::list_size_v<PageList>>{});
+  }
+
+  template <typename NameList, typename PageList>
+  template <typename F>
+  constexpr sgl::error Menu<NameList, PageList>::visit_page(sgl::string_view<char> name,
+                                                            F&&                    f) const {
+    const size_t i = find_page(name);
+    if (i == sgl::list_size_v<PageList>) {
+      return sgl::error::page_not_found;
+    }
+    return name_table_impl::visit(pages_,
+                                  i,
+                                  f,
+                                  std::make_index_sequence<sgl::list_size_v<PageList>>{});
+  }
+
+  template <typename NameList, typename PageList>
+  sgl::error Menu<NameList, PageList>::set(sgl::string_view<char>      path,
+                                           sgl::string_view<char_type> value) noexcept {
+    sgl::string_view<char> page_name;
+    sgl::string_view<char> item_name;
+    if (!path_impl::split(path, page_name, item_name)) {
+      return sgl::error::invalid_input;
+    }
+    return visit_page(page_name, [item_name, value](auto& page) {
+      return page.visit_item(item_name,
+                             [value](auto& item) { return path_impl::set(item, value); });
+    });
+  }
+
+  template <typename NameList, typename PageList>
+  size_t Menu<NameList, PageList>::set(sgl::PathAssignment<char_type>* assignments,
+                                       size_t                          count) noexcept {
+    size_t failed = 0;
+    for (size_t i = 0; i < count; ++i) {
+      assignments[i].ec = set(assignments[i].path, assignments[i].value);
+      failed += assignments[i].ec != sgl::error::no_error;
+    }
+    return failed;
+  }
+
+  template <typename NameList, typename PageList>
+  constexpr sgl::format_result Menu<NameList, PageList>::get(sgl::string_view<char> path,
+                                                             char_type*             buffer,
+                                                             size_t len) const noexcept {
+    sgl::string_view<char> page_name;
+    sgl::string_view<char> item_name;
+    if (!path_impl::split(path, page_name, item_name)) {
+      return {sgl::error::invalid_input, 0};
+    }
+    size_t size = 0;
+    auto   ec = visit_page(page_name, [item_name, buffer, len, &size](const auto& page) {
+      return page.visit_item(item_name, [buffer, len, &size](const auto& item) {
+        const auto& text = item.text();
+        if (text.size() > len) {
+          return sgl::error::buffer_too_small;
+        }
+        for (size_t i = 0; i < text.size(); ++i) {
+          buffer[i] = text[i];
+        }
+        size = text.size();
+        return sgl::error::no_error;
+      });
+    });
+    return {ec, size};
+  }
+
   template <typename NameList, typename PageList>
   template <char... Cs>
   constexpr auto& Menu<NameList, PageList>::operator[](sgl::Name<Cs...> name) noexcept {
@@ -135,7 +321,7 @@ namespace sgl {
 
   template <typename NameList, typename PageList>
   constexpr sgl::string_view<char> Menu<NameList, PageList>::page_name() const noexcept {
-    return page_name_impl<0>();
+    return tuple_detail::name_views<NameList>::value[index_];
   }
 
   template <typename NameList, typename PageList>
@@ -164,57 +350,27 @@ namespace sgl {
   template <typename NameList, typename PageList>
   template <typename F>
   constexpr decltype(auto) Menu<NameList, PageList>::for_current_page(F&& f) {
-    return for_current_page_impl<0>(std::forward<F>(f));
+    return tuple_detail::visit(
+        pages_, index_, f, std::make_index_sequence<sgl::list_size_v<PageList>>{});
   }
 
   template <typename NameList, typename PageList>
   template <typename F>
   constexpr decltype(auto) Menu<NameList, PageList>::for_current_page(F&& f) const {
-    return for_current_page_impl<0>(std::forward<F>(f));
-  }
-
-  template <typename NameList, typename PageList>
-  constexpr sgl::error Menu<NameList, PageList>::default_handle_input(Menu& menu,
-                                                                      input input) noexcept {
-    return menu.for_current_page([input](auto& page) { return page.handle_input(input); });
+    return tuple_detail::visit(
+        pages_, index_, f, std::make_index_sequence<sgl::list_size_v<PageList>>{});
   }
 
   template <typename NameList, typename PageList>
-  template <size_t I, typename F>
-  constexpr decltype(auto) Menu<NameList, PageList>::for_current_page_impl(F&& f) {
-    if constexpr (I == (sgl::list_size_v<PageList> - 1)) {
-      return std::forward<F>(f)(sgl::get<I>(pages_));
-    } else {
-      if (I == index_) {
-        return std::forward<F>(f)(sgl::get<I>(pages_));
-      }
-      return for_current_page_impl<I + 1>(std::forward<F>(f));
-    }
+  constexpr sgl::Event
+      Menu<NameList, PageList>::current_page_event(sgl::event_kind kind) const noexcept {
+    return sgl::Event{kind, index_, sgl::Event::npos, page_name(), {}};
   }
 
   template <typename NameList, typename PageList>
-  template <size_t I, typename F>
-  constexpr decltype(auto) Menu<NameList, PageList>::for_current_page_impl(F&& f) const {
-    if constexpr (I == (sgl::list_size_v<PageList> - 1)) {
-      return std::forward<F>(f)(sgl::get<I>(pages_));
-    } else {
-      if (I == index_) {
-        return std::forward<F>(f)(sgl::get<I>(pages_));
-      }
-      return for_current_page_impl<I + 1>(std::forward<F>(f));
-    }
-  }
-
-  template <typename NameList, typename PageList>
-  template <size_t I>
-  constexpr sgl::string_view<char> Menu<NameList, PageList>::page_name_impl() const noexcept {
-    if constexpr (I == sgl::list_size_v<PageList>)
-      return {};
-    else {
-      if (index_ == I)
-        return sgl::type_at_t<I, NameList>{}.to_view();
-      return this->page_name_impl<I + 1>();
-    }
+  constexpr sgl::error Menu<NameList, PageList>::default_handle_input(Menu& menu,
+                                                                      input input) noexcept {
+    return menu.for_current_page([input](auto& page) { return page.handle_input(input); });
   }
 
   template <typename NameList, typename PageList>
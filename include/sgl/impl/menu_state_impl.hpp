@@ -0,0 +1,83 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_MENU_STATE_IMPL_HPP
+#define SGL_IMPL_MENU_STATE_IMPL_HPP
+#include "sgl/menu_state.hpp"
+
+#include <cstring>
+
+namespace sgl {
+  template <typename Menu>
+  MenuState<Menu>::MenuState(const Menu& menu) noexcept {
+    save(menu);
+  }
+
+  template <typename Menu>
+  void MenuState<Menu>::save(const Menu& menu) noexcept {
+    page_index_ = static_cast<page_index_type>(menu.index_);
+    size_t     page_index = 0;
+    uint8_t*   out = values_.data;
+    char_type* text = texts_.data;
+    size_t     text_index = 0;
+    menu.for_each_page([&](const auto& page) {
+      item_index_[page_index] = static_cast<item_index_type>(page.current_item_index());
+      edit_mode_[page_index] = page.is_in_edit_mode();
+      ++page_index;
+      page.for_each_item([&](const auto& item) {
+        using Item = std::decay_t<decltype(item)>;
+        if constexpr (menu_state_impl::stores_text_v<Item>) {
+          const auto& str = item.text();
+          for (size_t i = 0; i < str.size(); ++i) {
+            text[i] = str[i];
+          }
+          text_sizes_[text_index++] = static_cast<text_size_type>(str.size());
+          text += Item::text_size;
+        } else {
+          serialize_impl::write(item, out);
+        }
+      });
+    });
+  }
+
+  template <typename Menu>
+  sgl::error MenuState<Menu>::load(Menu& menu) const noexcept {
+    menu.index_ = page_index_;
+    size_t           page_index = 0;
+    const uint8_t*   in = values_.data;
+    const char_type* text = texts_.data;
+    size_t           text_index = 0;
+    sgl::error       ec{sgl::error::no_error};
+    menu.for_each_page([&](auto& page) {
+      page.set_current_item(item_index_[page_index]);
+      if (edit_mode_[page_index]) {
+        page.set_edit_mode();
+      }
+      ++page_index;
+      page.for_each_item([&](auto& item) {
+        using Item = std::decay_t<decltype(item)>;
+        using Traits = sgl::SerializeTraits<Item>;
+        if constexpr (menu_state_impl::stores_text_v<Item>) {
+          const sgl::string_view<char_type> stored(text, text_sizes_[text_index++]);
+          if (not(sgl::string_view<char_type>(item.text()) == stored)) {
+            static_cast<void>(item.set_text(stored));
+          }
+          text += Item::text_size;
+        } else {
+          uint8_t current[Traits::size]{};
+          Traits::write(item, current);
+          if (ec == sgl::error::no_error and std::memcmp(current, in, Traits::size) != 0) {
+            ec = Traits::read(item, in);
+          }
+          in += Traits::size;
+        }
+      });
+    });
+    // the current page is entered without set_current_page(), which would refresh it
+    menu.refresh();
+    return ec;
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_MENU_STATE_IMPL_HPP */
@@ -0,0 +1,132 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_NAME_TABLE_IMPL_HPP
+#define SGL_IMPL_NAME_TABLE_IMPL_HPP
+#include "sgl/name_table.hpp"
+#include "sgl/named_tuple.hpp"
+
+namespace sgl {
+  /// @cond
+  namespace name_table_impl {
+    /// 64 bit FNV-1a. The upper half selects the bucket, the lower half the slot.
+    constexpr uint64_t hash(const char* str, size_t len) noexcept {
+      uint64_t h = 14695981039346656037ull;
+      for (size_t i = 0; i < len; ++i) {
+        h = (h ^ static_cast<uint8_t>(str[i])) * 1099511628211ull;
+      }
+      return h;
+    }
+
+    /// murmur3 finalizer
+    constexpr uint32_t mix(uint32_t x) noexcept {
+      x ^= x >> 16;
+      x *= 0x85EBCA6Bu;
+      x ^= x >> 13;
+      x *= 0xC2B2AE35u;
+      x ^= x >> 16;
+      return x;
+    }
+
+    constexpr size_t bucket(uint64_t h, size_t num_buckets) noexcept {
+      return static_cast<size_t>(h >> 32) % num_buckets;
+    }
+
+    constexpr size_t slot(uint64_t h, uint32_t displacement, size_t num_slots) noexcept {
+      return mix(static_cast<uint32_t>(h) + displacement * 0x9E3779B9u) & (num_slots - 1);
+    }
+
+    template <size_t N>
+    constexpr Table<N> build(const sgl::string_view<char> (&names)[N]) noexcept {
+      using T = Table<N>;
+      using Index = sgl::smallest_type_t<N + 1>;
+      T table{};
+      for (auto& s : table.slots) {
+        s = static_cast<Index>(T::empty);
+      }
+
+      // sort the names by bucket, i.e. members[start[b]..start[b + 1]] are the names in bucket b.
+      uint64_t hashes[N]{};
+      size_t   start[T::num_buckets + 1]{};
+      size_t   members[N]{};
+      for (size_t i = 0; i < N; ++i) {
+        hashes[i] = hash(names[i].data(), names[i].size());
+        ++start[bucket(hashes[i], T::num_buckets) + 1];
+      }
+      size_t max_bucket_size = 0;
+      for (size_t b = 0; b < T::num_buckets; ++b) {
+        max_bucket_size = start[b + 1] > max_bucket_size ? start[b + 1] : max_bucket_size;
+        start[b + 1] += start[b];
+      }
+      size_t fill[T::num_buckets]{};
+      for (size_t i = 0; i < N; ++i) {
+        const size_t b = bucket(hashes[i], T::num_buckets);
+        members[start[b] + fill[b]++] = i;
+      }
+
+      // place the largest buckets first, they are the hardest to fit.
+      for (size_t bucket_size = max_bucket_size; bucket_size > 0; --bucket_size) {
+        for (size_t b = 0; b < T::num_buckets; ++b) {
+          if (start[b + 1] - start[b] != bucket_size) {
+            continue;
+          }
+          bool placed = false;
+          for (uint32_t d = 0; d < 0xFFFF and !placed; ++d) {
+            placed = true;
+            for (size_t m = start[b]; m < start[b + 1] and placed; ++m) {
+              const size_t s = slot(hashes[members[m]], d, T::num_slots);
+              placed = table.slots[s] == T::empty;
+              // two names of the same bucket could collide with each other as well
+              for (size_t k = start[b]; k < m and placed; ++k) {
+                placed = slot(hashes[members[k]], d, T::num_slots) != s;
+              }
+            }
+            if (placed) {
+              table.displacement[b] = static_cast<uint16_t>(d);
+              for (size_t m = start[b]; m < start[b + 1]; ++m) {
+                table.slots[slot(hashes[members[m]], d, T::num_slots)] =
+                    static_cast<Index>(members[m]);
+              }
+            }
+          }
+          if (!placed) {
+            return table;
+          }
+        }
+      }
+      table.ok = true;
+      return table;
+    }
+
+    /// applies f to the i-th element of t through the jump table of tuple_detail::visit(), and
+    /// converts the result to sgl::error. i must be in range.
+    template <typename Tuple, typename F, size_t... I>
+    constexpr sgl::error visit(Tuple& t, size_t i, F& f, std::index_sequence<I...> seq) {
+      auto to_error = [&f](auto& element) -> sgl::error {
+        if constexpr (std::is_same_v<decltype(f(element)), sgl::error>) {
+          return f(element);
+        } else {
+          f(element);
+          return sgl::error::no_error;
+        }
+      };
+      return tuple_detail::visit(t, i, to_error, seq);
+    }
+  } // namespace name_table_impl
+  /// @endcond
+
+  template <typename... Names>
+  constexpr size_t NameTable<sgl::type_list<Names...>>::find(sgl::string_view<char> name) noexcept {
+    using T = name_table_impl::Table<size>;
+    const uint64_t h = name_table_impl::hash(name.data(), name.size());
+    const size_t   b = name_table_impl::bucket(h, T::num_buckets);
+    const size_t   i = table_.slots[name_table_impl::slot(h, table_.displacement[b], T::num_slots)];
+    if (i != T::empty and names_[i] == name) {
+      return i;
+    }
+    return npos;
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_NAME_TABLE_IMPL_HPP */
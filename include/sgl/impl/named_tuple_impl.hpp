@@ -12,20 +12,41 @@ namespace sgl {
   namespace tuple_detail {
     template <auto...>
     static constexpr bool always_false = false;
-    template <typename Name, typename Tuple>
-    struct type_for;
+    // The element of a name is found by deducing the value type from the tuple's NamedValue base
+    // with that name, i.e. by overload resolution instead of searching the name list.
+    template <typename Name, typename T>
+    constexpr NamedValue<Name, T>& element(NamedValue<Name, T>& value) noexcept {
+      return value;
+    }
 
-    template <typename Name, typename... Names, typename... Ts>
-    struct type_for<Name, NamedTuple<sgl::type_list<Names...>, sgl::type_list<Ts...>>> {
-      using name_list_t = sgl::type_list<Names...>;
-      using type_list_t = sgl::type_list<Ts...>;
-      static_assert(sgl::contains_v<Name, name_list_t>, "Name not found in tuple type");
+    template <typename Name, typename T>
+    constexpr const NamedValue<Name, T>& element(const NamedValue<Name, T>& value) noexcept {
+      return value;
+    }
 
-      using type = type_at_t<index_of_v<Name, name_list_t>, type_list_t>;
-    };
+    template <size_t I, typename Tuple, typename F>
+    constexpr decltype(auto) invoke_at(Tuple& t, F& f) {
+      return f(sgl::get<I>(t));
+    }
+
+    /// invokes f with the i-th element of t through a jump table. i must be in range, and f must
+    /// return the same type for every element.
+    template <typename Tuple, typename F, size_t... I>
+    constexpr decltype(auto) visit(Tuple& t, size_t i, F& f, std::index_sequence<I...>) {
+      using R = decltype(f(sgl::get<0>(t)));
+      using Fn = R (*)(Tuple&, F&);
+      constexpr Fn table[] = {&invoke_at<I, Tuple, F>...};
+      return table[i](t, f);
+    }
+
+    template <typename NameList>
+    struct name_views;
 
-    template <typename Name, typename Tuple>
-    using type_for_t = typename type_for<Name, Tuple>::type;
+    /// views of the names in NameList, indexable at runtime
+    template <typename... Names>
+    struct name_views<sgl::type_list<Names...>> {
+      static constexpr sgl::string_view<char> value[] = {Names{}.to_view()...};
+    };
   } // namespace tuple_detail
 
   /// \endcond
@@ -54,11 +75,10 @@ namespace sgl {
   template <typename Name>
   constexpr const auto&
       NamedTuple<sgl::type_list<Names...>, sgl::type_list<Ts...>>::get(Name name) const noexcept {
-    if constexpr (!sgl::contains_v<Name, name_list_t>) {
-      static_assert(sgl::contains_v<Name, name_list_t>, "No such name in tuple");
+    if constexpr (!has_name<Name>) {
+      static_assert(has_name<Name>, "No such name in tuple");
     } else {
-      return static_cast<const NamedValue<Name, tuple_detail::type_for_t<Name, This_t>>*>(this)
-          ->value();
+      return tuple_detail::element<Name>(*this).value();
       static_cast<void>(name);
     }
   }
@@ -67,10 +87,10 @@ namespace sgl {
   template <typename Name>
   constexpr auto&
       NamedTuple<sgl::type_list<Names...>, sgl::type_list<Ts...>>::get(Name name) noexcept {
-    if constexpr (!sgl::contains_v<Name, name_list_t>) {
-      static_assert(sgl::contains_v<Name, name_list_t>, "No such name in tuple");
+    if constexpr (!has_name<Name>) {
+      static_assert(has_name<Name>, "No such name in tuple");
     } else {
-      return static_cast<NamedValue<Name, tuple_detail::type_for_t<Name, This_t>>*>(this)->value();
+      return tuple_detail::element<Name>(*this).value();
       static_cast<void>(name);
     }
   }
@@ -81,9 +101,7 @@ namespace sgl {
     if constexpr (I >= sizeof...(Ts)) {
       static_assert(tuple_detail::always_false<I>, "Index out of range.");
     } else {
-      using Name = type_at_t<I, name_list_t>;
-      using Type = type_at_t<I, type_list_t>;
-      return static_cast<NamedValue<Name, Type>*>(this)->value();
+      return tuple_detail::element<type_at_t<I, name_list_t>>(*this).value();
     }
   }
 
@@ -94,9 +112,7 @@ namespace sgl {
     if constexpr (I >= sizeof...(Ts)) {
       static_assert(tuple_detail::always_false<I>, "Index out of range.");
     } else {
-      using Name = type_at_t<I, name_list_t>;
-      using Type = type_at_t<I, type_list_t>;
-      return static_cast<const NamedValue<Name, Type>*>(this)->value();
+      return tuple_detail::element<type_at_t<I, name_list_t>>(*this).value();
     }
   }
 
@@ -104,29 +120,14 @@ namespace sgl {
   template <char... Cs>
   constexpr auto& NamedTuple<sgl::type_list<Names...>, sgl::type_list<Ts...>>::operator[](
       sgl::Name<Cs...> name) noexcept {
-    if constexpr (!sgl::contains_v<sgl::Name<Cs...>, name_list_t>) {
-      static_assert(sgl::contains_v<sgl::Name<Cs...>, name_list_t>, "No such name in tuple");
-    } else {
-      return static_cast<
-                 NamedValue<sgl::Name<Cs...>, tuple_detail::type_for_t<sgl::Name<Cs...>, This_t>>*>(
-                 this)
-          ->value();
-      static_cast<void>(name);
-    }
+    return this->get(name);
   }
 
   template <typename... Names, typename... Ts>
   template <char... Cs>
   constexpr const auto& NamedTuple<sgl::type_list<Names...>, sgl::type_list<Ts...>>::operator[](
-      sgl::Name<Cs...>) const noexcept {
-    if constexpr (!sgl::contains_v<sgl::Name<Cs...>, name_list_t>) {
-      static_assert(sgl::contains_v<sgl::Name<Cs...>, name_list_t>, "No such name in tuple");
-    } else {
-      return static_cast<const NamedValue<sgl::Name<Cs...>,
-                                          tuple_detail::type_for_t<sgl::Name<Cs...>, This_t>>*>(
-                 this)
-          ->value();
-    }
+      sgl::Name<Cs...> name) const noexcept {
+    return this->get(name);
   }
 
   template <typename... Names, typename... Ts>
@@ -137,7 +138,7 @@ namespace sgl {
                     "f must be invocable with T& for each T in this "
                     "tuple.");
     } else {
-      (std::forward<F>(f)(this->get(Names{})), ...);
+      (std::forward<F>(f)(static_cast<NamedValue<Names, Ts>&>(*this).value()), ...);
     }
   }
 
@@ -150,7 +151,7 @@ namespace sgl {
                     "f must be invocable with const T& for each T in this "
                     "tuple.");
     } else {
-      (std::forward<F>(f)(this->get(Names{})), ...);
+      (std::forward<F>(f)(static_cast<const NamedValue<Names, Ts>&>(*this).value()), ...);
     }
   }
 
@@ -163,7 +164,7 @@ namespace sgl {
                     "f must be invocable with (sgl::Name<...>, const T&) for each name and T in "
                     "this tuple.");
     } else {
-      (std::forward<F>(f)(Names{}, this->get(Names{})), ...);
+      (std::forward<F>(f)(Names{}, static_cast<NamedValue<Names, Ts>&>(*this).value()), ...);
     }
   }
 
@@ -176,7 +177,8 @@ namespace sgl {
                     "f must be invocable with (sgl::Name<...>, const T&) for each name and T in "
                     "this tuple.");
     } else {
-      (std::forward<F>(f)(Names{}, this->get(Names{})), ...);
+      (std::forward<F>(f)(Names{}, static_cast<const NamedValue<Names, Ts>&>(*this).value()),
+       ...);
     }
   }
 
@@ -56,10 +56,26 @@ namespace sgl {
                                                  StringView initial_text) noexcept
       : Base(initial_text, &default_handle_input), value_(initial_value), delta_(delta) {}
 
+  namespace numeric_impl {
+    /// convert the string of a cx_arg, which only contains ASCII characters, to CharT.
+    template <typename CharT, size_t Size>
+    constexpr sgl::static_string<CharT, Size>
+        widen(const sgl::static_string<char, Size>& str) noexcept {
+      sgl::static_string<CharT, Size> res(str.size(), CharT{' '});
+      for (size_t i = 0; i < str.size(); ++i) {
+        res[i] = static_cast<CharT>(str[i]);
+      }
+      return res;
+    }
+  } // namespace numeric_impl
+
   template <size_t TextSize, typename CharT, typename T>
   constexpr Numeric<TextSize, CharT, T>::Numeric(const cx_arg<T, TextSize>& initial_value,
                                                  T                          delta) noexcept
-      : Numeric<TextSize, CharT, T>(initial_value.value, delta, StringView(initial_value.string)) {}
+      : Numeric<TextSize, CharT, T>(
+            initial_value.value,
+            delta,
+            StringView(numeric_impl::widen<CharT>(initial_value.string))) {}
 
   template <size_t TextSize, typename CharT, typename T>
   template <typename Formatter,
@@ -131,7 +147,7 @@ namespace sgl {
 
   template <size_t TextSize, typename CharT, typename T>
   constexpr void Numeric<TextSize, CharT, T>::set_format(sgl::format format) noexcept {
-    format_ = format;
+    format_type_ = format;
   }
 
   template <size_t TextSize, typename CharT, typename T>
@@ -136,13 +136,15 @@ namespace sgl {
   template <typename NameList, typename ItemList>
   template <typename F>
   constexpr decltype(auto) Page<NameList, ItemList>::for_current_item(F&& f) {
-    return for_current_item_impl<0>(std::forward<F>(f));
+    return tuple_detail::visit(
+        items_, index_, f, std::make_index_sequence<sgl::list_size_v<ItemList>>{});
   }
 
   template <typename NameList, typename ItemList>
   template <typename F>
   constexpr decltype(auto) Page<NameList, ItemList>::for_current_item(F&& f) const {
-    return for_current_item_impl<0>(std::forward<F>(f));
+    return tuple_detail::visit(
+        items_, index_, f, std::make_index_sequence<sgl::list_size_v<ItemList>>{});
   }
 
   template <typename NameList, typename ItemList>
@@ -167,6 +169,38 @@ namespace sgl {
     }
   }
 
+  template <typename NameList, typename ItemList>
+  constexpr size_t Page<NameList, ItemList>::find_item(sgl::string_view<char> name) noexcept {
+    return sgl::NameTable<NameList>::find(name);
+  }
+
+  template <typename NameList, typename ItemList>
+  template <typename F>
+  constexpr sgl::error Page<NameList, ItemList>::visit_item(sgl::string_view<char> name, F&& f) {
+    const size_t i = find_item(name);
+    if (i == sgl::list_size_v<ItemList>) {
+      return sgl::error::item_not_found;
+    }
+    return name_table_impl::visit(items_,
+                                  i,
+                                  f,
+                                  std::make_index_sequence<sgl::list_size_v<ItemList>>{});
+  }
+
+  template <typename NameList, typename ItemList>
+  template <typename F>
+  constexpr sgl::error Page<NameList, ItemList>::visit_item(sgl::string_view<char> name,
+                                                            F&&                    f) const {
+    const size_t i = find_item(name);
+    if (i == sgl::list_size_v<ItemList>) {
+      return sgl::error::item_not_found;
+    }
+    return name_table_impl::visit(items_,
+                                  i,
+                                  f,
+                                  std::make_index_sequence<sgl::list_size_v<ItemList>>{});
+  }
+
   template <typename NameList, typename ItemList>
   template <typename Action>
   constexpr Page<NameList, ItemList>&
@@ -198,15 +232,41 @@ namespace sgl {
     sgl::for_each(items_, [](auto& item) { item.tick(); });
   }
 
+  template <typename NameList, typename ItemList>
+  constexpr void Page<NameList, ItemList>::refresh() noexcept {
+    sgl::for_each(items_, [](auto& item) {
+      if constexpr (sgl::has_refresh_v<std::decay_t<decltype(item)>>) {
+        item.refresh();
+      }
+    });
+  }
+
+  template <typename NameList, typename ItemList>
+  constexpr void Page<NameList, ItemList>::tick_item(size_t i) noexcept {
+    auto f = [](auto& item) { item.tick(); };
+    static_cast<void>(name_table_impl::visit(
+        items_, i, f, std::make_index_sequence<sgl::list_size_v<ItemList>>{}));
+  }
+
   template <typename NameList, typename ItemList>
   constexpr sgl::string_view<char> Page<NameList, ItemList>::item_name(size_t i) const noexcept {
-    return item_name_impl<0>(i);
+    if (i >= sgl::list_size_v<ItemList>) {
+      return {};
+    }
+    return tuple_detail::name_views<NameList>::value[i];
   }
 
   template <typename NameList, typename ItemList>
   constexpr sgl::string_view<typename Page<NameList, ItemList>::char_type>
       Page<NameList, ItemList>::item_text(size_t i) const noexcept {
-    return this->item_text_impl<0>(i);
+    if (i >= sgl::list_size_v<ItemList>) {
+      return {};
+    }
+    auto f = [](const auto& item) -> sgl::string_view<char_type> {
+      return {item.text().data(), item.text().size()};
+    };
+    return tuple_detail::visit(
+        items_, i, f, std::make_index_sequence<sgl::list_size_v<ItemList>>{});
   }
 
   template <typename NameList, typename ItemList>
@@ -264,32 +324,6 @@ namespace sgl {
     return sgl::error::no_error;
   }
 
-  template <typename NameList, typename ItemList>
-  template <size_t I, typename F>
-  constexpr decltype(auto) Page<NameList, ItemList>::for_current_item_impl(F&& f) {
-    if constexpr (I == (list_size_v<ItemList> - 1)) {
-      return std::forward<F>(f)(sgl::get<I>(items_));
-    } else {
-      if (index_ == I) {
-        return std::forward<F>(f)(sgl::get<I>(items_));
-      }
-      return for_current_item_impl<I + 1>(std::forward<F>(f));
-    }
-  }
-
-  template <typename NameList, typename ItemList>
-  template <size_t I, typename F>
-  constexpr decltype(auto) Page<NameList, ItemList>::for_current_item_impl(F&& f) const {
-    if constexpr (I == (list_size_v<ItemList> - 1)) {
-      return std::forward<F>(f)(sgl::get<I>(items_));
-    } else {
-      if (index_ == I) {
-        return std::forward<F>(f)(sgl::get<I>(items_));
-      }
-      return for_current_item_impl<I + 1>(std::forward<F>(f));
-    }
-  }
-
   template <typename NameList, typename ItemList>
   constexpr sgl::error
       Page<NameList, ItemList>::default_page_action(Page<NameList, ItemList>& page) noexcept {
@@ -297,34 +331,6 @@ namespace sgl {
     return sgl::error::no_error;
   }
 
-  template <typename NameList, typename ItemList>
-  template <size_t I>
-  constexpr sgl::string_view<char>
-      Page<NameList, ItemList>::item_name_impl(size_t i) const noexcept {
-    if constexpr (I == list_size_v<ItemList>) {
-      return {};
-    } else {
-      if (I == i) {
-        return sgl::type_at_t<I, NameList>{}.to_view();
-      }
-      return this->item_name_impl<I + 1>(i);
-    }
-  }
-
-  template <typename NameList, typename ItemList>
-  template <size_t I>
-  constexpr sgl::string_view<typename Page<NameList, ItemList>::char_type>
-      Page<NameList, ItemList>::item_text_impl(size_t i) const noexcept {
-    if constexpr (I == list_size_v<ItemList>) {
-      return {};
-    } else {
-      if (I == i) {
-        return {sgl::get<I>(items_).text().data(), sgl::get<I>(items_).text().size()};
-      }
-      return item_text_impl<I + 1>(i);
-    }
-  }
-
   template <typename NameList, typename ItemList, typename F>
   constexpr void for_each(Page<NameList, ItemList>& page, F&& f) {
     return page.for_each_item(std::forward<F>(f));
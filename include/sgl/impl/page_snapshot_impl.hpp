@@ -0,0 +1,49 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_PAGE_SNAPSHOT_IMPL_HPP
+#define SGL_IMPL_PAGE_SNAPSHOT_IMPL_HPP
+#include "sgl/page_snapshot.hpp"
+
+namespace sgl {
+  template <typename NameList, typename PageList>
+  void capture(const sgl::Menu<NameList, PageList>&          menu,
+               sgl::PageView<sgl::Menu<NameList, PageList>>& view) noexcept {
+    using View = sgl::PageView<sgl::Menu<NameList, PageList>>;
+    view.page_index = menu.current_page_index();
+    view.page_name = menu.page_name();
+    menu.for_current_page([&view](const auto& page) {
+      view.size = page.size();
+      view.current_item = page.current_item_index();
+      view.edit_mode = page.is_in_edit_mode();
+      size_t i = 0;
+      page.for_each_item_with_name([&view, &i](auto name, const auto& item) {
+        view.names[i] = name.to_view();
+        view.texts[i] = typename View::String(item.text().data(), item.text().size());
+        ++i;
+      });
+    });
+  }
+
+  template <typename Menu>
+  PageSnapshot<Menu>::PageSnapshot(const Menu& menu) noexcept {
+    publish(menu);
+  }
+
+  template <typename Menu>
+  void PageSnapshot<Menu>::publish(const Menu& menu) noexcept {
+    View& view = buffer_.back();
+    sgl::capture(menu, view);
+    view.sequence = ++sequence_;
+    buffer_.publish();
+  }
+
+  template <typename Menu>
+  auto PageSnapshot<Menu>::read() noexcept -> const View& {
+    buffer_.update();
+    return buffer_.front();
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_PAGE_SNAPSHOT_IMPL_HPP */
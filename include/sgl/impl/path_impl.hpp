@@ -0,0 +1,121 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_PATH_IMPL_HPP
+#define SGL_IMPL_PATH_IMPL_HPP
+#include "sgl/path.hpp"
+
+namespace sgl {
+  /// @cond
+  template <size_t TextSize, typename CharT>
+  struct PathTraits<sgl::Boolean<TextSize, CharT>> {
+    static constexpr bool settable = true;
+
+    // accepts the true and false strings of the item, ignoring ASCII case, as well as "1" and "0".
+    static sgl::error set(sgl::Boolean<TextSize, CharT>& item,
+                          sgl::string_view<CharT>        value) noexcept {
+      if (equal(value, item.true_string()) or (value.size() == 1 and value[0] == CharT('1'))) {
+        return item.set_value(true);
+      }
+      if (equal(value, item.false_string()) or (value.size() == 1 and value[0] == CharT('0'))) {
+        return item.set_value(false);
+      }
+      return sgl::error::invalid_value;
+    }
+
+  private:
+    static constexpr CharT to_lower(CharT c) noexcept {
+      return (c >= CharT('A') and c <= CharT('Z')) ? static_cast<CharT>(c - CharT('A') + CharT('a'))
+                                                   : c;
+    }
+
+    static constexpr bool equal(sgl::string_view<CharT> a, sgl::string_view<CharT> b) noexcept {
+      if (a.size() != b.size()) {
+        return false;
+      }
+      for (size_t i = 0; i < a.size(); ++i) {
+        if (to_lower(a[i]) != to_lower(b[i])) {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  struct PathTraits<sgl::Enum<T, NumEnumerators, TextSize, CharT>> {
+    static constexpr bool settable = true;
+
+    // accepts the string of an enumerator.
+    static sgl::error set(sgl::Enum<T, NumEnumerators, TextSize, CharT>& item,
+                          sgl::string_view<CharT>                        value) noexcept {
+      const auto& map = item.get_map();
+      for (size_t i = 0; i < map.size(); ++i) {
+        if (map.get_view(i) == value) {
+          item.set_index(i);
+          return item.set_text(item.current_string());
+        }
+      }
+      return sgl::error::invalid_value;
+    }
+  };
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  struct PathTraits<sgl::LocalizedEnum<T, NumEnumerators, TextSize, CharT>> {
+    static constexpr bool settable = true;
+
+    // accepts the string of an enumerator in the current language.
+    static sgl::error set(sgl::LocalizedEnum<T, NumEnumerators, TextSize, CharT>& item,
+                          sgl::string_view<CharT>                                 value) noexcept {
+      for (size_t i = 0; i < item.num_values(); ++i) {
+        if (item.string(i) == value) {
+          item.set_index(i);
+          return sgl::error::no_error;
+        }
+      }
+      return sgl::error::invalid_value;
+    }
+  };
+
+  template <size_t TextSize, typename CharT, typename T>
+  struct PathTraits<sgl::Numeric<TextSize, CharT, T>> {
+    static constexpr bool settable = true;
+
+    // parses the value with sgl::parse(), the text is formatted by the item's formatter. Fix point
+    // values are parsed as double. sgl::parse() only parses floating point numbers from char, so
+    // other character types are narrowed first, and values with non ASCII code units are invalid.
+    static sgl::error set(sgl::Numeric<TextSize, CharT, T>& item,
+                          sgl::string_view<CharT>           value) noexcept {
+      using parse_type = std::conditional_t<std::is_arithmetic_v<T>, T, double>;
+      parse_type parsed{0};
+      sgl::error ec = sgl::error::no_error;
+      if constexpr (std::is_floating_point_v<parse_type> and not std::is_same_v<CharT, char>) {
+        char narrow[max_float_size]{};
+        if (value.size() > max_float_size) {
+          return sgl::error::format_error;
+        }
+        for (size_t i = 0; i < value.size(); ++i) {
+          if (static_cast<uint32_t>(value[i]) > 0x7F) {
+            return sgl::error::invalid_value;
+          }
+          narrow[i] = static_cast<char>(value[i]);
+        }
+        ec = sgl::parse(narrow, value.size(), parsed);
+      } else {
+        ec = sgl::parse(value.data(), value.size(), parsed);
+      }
+      if (ec != sgl::error::no_error) {
+        return ec;
+      }
+      return item.set_value(T(parsed));
+    }
+
+  private:
+    /// longest floating point value accepted from a non char string
+    static constexpr size_t max_float_size = 64;
+  };
+  /// @endcond
+} // namespace sgl
+#endif /* SGL_IMPL_PATH_IMPL_HPP */
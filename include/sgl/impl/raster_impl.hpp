@@ -0,0 +1,186 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_RASTER_IMPL_HPP
+#define SGL_IMPL_RASTER_IMPL_HPP
+#include "sgl/raster.hpp"
+
+#include <type_traits>
+
+namespace sgl {
+  constexpr void
+      Mono1::write(storage_type* line, size_t x, uint8_t bits, uint8_t count) const noexcept {
+    // the count pixels starting at x span at most two bytes. In a 16 bit window starting at the
+    // byte of x, they start at bit 15 - x % 8.
+    const unsigned shift = 8u - static_cast<unsigned>(x % 8);
+    const uint16_t mask = static_cast<uint16_t>(static_cast<uint8_t>(0xFFu << (8u - count))
+                                                << shift);
+    const uint16_t value = static_cast<uint16_t>(static_cast<uint16_t>(bits) << shift) & mask;
+    storage_type*  p = line + x / 8;
+    p[0] = static_cast<storage_type>((p[0] & ~(mask >> 8)) | (value >> 8));
+    if ((mask & 0xFFu) != 0) {
+      p[1] = static_cast<storage_type>((p[1] & ~mask) | value);
+    }
+  }
+
+  constexpr void
+      Rgb565::write(storage_type* line, size_t x, uint8_t bits, uint8_t count) const noexcept {
+    for (uint8_t i = 0; i < count; ++i) {
+      line[x + i] = (bits & (0x80u >> i)) ? foreground : background;
+    }
+  }
+
+  template <size_t Columns, size_t Rows, typename CharT>
+  template <typename NameList, typename PageList>
+  constexpr void TextRasterizer<Columns, Rows, CharT>::update(
+      const sgl::Menu<NameList, PageList>& menu) noexcept {
+    static_assert(std::is_same_v<typename sgl::Menu<NameList, PageList>::char_type, CharT>,
+                  "the character type of the menu and the rasterizer must match");
+    menu.for_current_page([this](const auto& page) {
+      const size_t current = page.current_item_index();
+      const bool   edit = page.is_in_edit_mode();
+      scroll(page.size(), current);
+      size_t i = 0;
+      page.for_each_item([this, &i, current, edit](const auto& item) {
+        if (i >= top_ and i < top_ + Rows) {
+          set_line(i - top_, sgl::string_view<CharT>(item.text()), i == current, edit);
+        }
+        ++i;
+      });
+      clear_lines(page.size() - top_);
+    });
+  }
+
+  template <size_t Columns, size_t Rows, typename CharT>
+  template <typename Menu>
+  constexpr void
+      TextRasterizer<Columns, Rows, CharT>::update(const sgl::PageView<Menu>& view) noexcept {
+    static_assert(std::is_same_v<typename Menu::char_type, CharT>,
+                  "the character type of the menu and the rasterizer must match");
+    scroll(view.size, view.current_item);
+    size_t row = 0;
+    for (size_t i = top_; i < view.size and row < Rows; ++i, ++row) {
+      set_line(row,
+               sgl::string_view<CharT>(view.texts[i]),
+               i == view.current_item,
+               view.edit_mode);
+    }
+    clear_lines(row);
+  }
+
+  template <size_t Columns, size_t Rows, typename CharT>
+  template <typename Format>
+  constexpr size_t
+      TextRasterizer<Columns, Rows, CharT>::draw(const sgl::Bitmap<Format>& bitmap) noexcept {
+    size_t count = 0;
+    for (size_t r = 0; r < Rows; ++r) {
+      for (size_t c = 0; c < Columns; ++c) {
+        if (valid_ and cells_[r][c] == drawn_[r][c]) {
+          continue;
+        }
+        draw_cell(bitmap, c, r);
+        drawn_[r][c] = cells_[r][c];
+        ++count;
+      }
+    }
+    valid_ = true;
+    return count;
+  }
+
+  template <size_t Columns, size_t Rows, typename CharT>
+  constexpr void TextRasterizer<Columns, Rows, CharT>::scroll(size_t size,
+                                                              size_t current) noexcept {
+    if (current < top_) {
+      top_ = current;
+    } else if (current >= top_ + Rows) {
+      top_ = current - Rows + 1;
+    }
+    // don't leave empty lines at the bottom when the page shrank or the page changed.
+    if (size <= Rows) {
+      top_ = 0;
+    } else if (top_ > size - Rows) {
+      top_ = size - Rows;
+    }
+  }
+
+  template <size_t Columns, size_t Rows, typename CharT>
+  constexpr void TextRasterizer<Columns, Rows, CharT>::set_line(size_t                  row,
+                                                                sgl::string_view<CharT> text,
+                                                                bool                    current,
+                                                                bool edit) noexcept {
+    Cell* line = cells_[row];
+    line[0] = Cell{current ? cursor : U' ', false};
+    const bool inverted = current and edit;
+    // the text cells only change if the text or the edit state changed
+    if (not layouts_[row].update(text, Columns - 1) and line[1].inverted == inverted) {
+      return;
+    }
+    const LineLayout& layout = layouts_[row].layout();
+    size_t            c = 1;
+    size_t            pos = 0;
+    while (pos < layout.units) {
+      const char32_t ch = sgl::decode(text, pos);
+      const size_t   width = sgl::display_width(ch);
+      // a monospaced font can't draw combining marks, and draws wide characters in one cell
+      if (width == 0) {
+        continue;
+      }
+      line[c++] = Cell{ch, inverted};
+      if (width == 2) {
+        line[c++] = Cell{U' ', inverted};
+      }
+    }
+    if (layout.truncated) {
+      line[c++] = Cell{ellipsis, inverted};
+    }
+    for (; c < Columns; ++c) {
+      line[c] = Cell{U' ', inverted};
+    }
+  }
+
+  template <size_t Columns, size_t Rows, typename CharT>
+  constexpr void TextRasterizer<Columns, Rows, CharT>::clear_lines(size_t row) noexcept {
+    for (; row < Rows; ++row) {
+      for (auto& cell : cells_[row]) {
+        cell = Cell{};
+      }
+      layouts_[row].invalidate();
+    }
+  }
+
+  template <size_t Columns, size_t Rows, typename CharT>
+  template <typename Format>
+  constexpr void
+      TextRasterizer<Columns, Rows, CharT>::draw_cell(const sgl::Bitmap<Format>& bitmap,
+                                                      size_t                     column,
+                                                      size_t                     row) noexcept {
+    const size_t x = column * font_->cell_width;
+    const size_t y = row * font_->cell_height;
+    if (x >= bitmap.width or y >= bitmap.height) {
+      return;
+    }
+    const size_t width =
+        bitmap.width - x < font_->cell_width ? bitmap.width - x : font_->cell_width;
+    const Cell&   cell = cells_[row][column];
+    const size_t  stride = Format::stride(bitmap.width);
+    const uint8_t blank = cell.inverted ? 0xFF : 0x00;
+    for (size_t dy = 0; dy < font_->cell_height and y + dy < bitmap.height; ++dy) {
+      auto* line = bitmap.data + (y + dy) * stride;
+      // write() takes at most 8 pixels, the pixels right of the glyph row are spacing.
+      for (size_t dx = 0; dx < width; dx += 8) {
+        const uint8_t count = static_cast<uint8_t>(width - dx < 8 ? width - dx : 8);
+        uint8_t       bits = blank;
+        if (dx == 0) {
+          bits = font_->row(cell.c, dy);
+          if (cell.inverted) {
+            bits = static_cast<uint8_t>(~bits);
+          }
+        }
+        bitmap.format.write(line, x + dx, bits, count);
+      }
+    }
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_RASTER_IMPL_HPP */
@@ -0,0 +1,148 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_REFLECTION_IMPL_HPP
+#define SGL_IMPL_REFLECTION_IMPL_HPP
+#include "sgl/boolean.hpp"
+#include "sgl/button.hpp"
+#include "sgl/enum.hpp"
+#include "sgl/numeric.hpp"
+#include "sgl/page_link.hpp"
+#include "sgl/path.hpp"
+#include "sgl/reflection.hpp"
+
+#include <utility>
+
+namespace sgl {
+  /// @cond
+  namespace reflection_impl {
+    template <typename Item>
+    inline constexpr sgl::item_kind kind_v = sgl::item_kind::custom;
+
+    template <size_t TextSize, typename CharT>
+    inline constexpr sgl::item_kind kind_v<sgl::Button<TextSize, CharT>> = sgl::item_kind::button;
+
+    template <size_t TextSize, typename CharT>
+    inline constexpr sgl::item_kind kind_v<sgl::Boolean<TextSize, CharT>> = sgl::item_kind::boolean;
+
+    template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+    inline constexpr sgl::item_kind kind_v<sgl::Enum<T, NumEnumerators, TextSize, CharT>> =
+        sgl::item_kind::enumeration;
+
+    template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+    inline constexpr sgl::item_kind kind_v<sgl::LocalizedEnum<T, NumEnumerators, TextSize, CharT>> =
+        sgl::item_kind::enumeration;
+
+    template <size_t TextSize, typename CharT, typename T>
+    inline constexpr sgl::item_kind kind_v<sgl::Numeric<TextSize, CharT, T>> =
+        sgl::item_kind::numeric;
+
+    template <typename PageName, size_t TextSize, typename CharT>
+    inline constexpr sgl::item_kind kind_v<sgl::PageLink<PageName, TextSize, CharT>> =
+        sgl::item_kind::page_link;
+
+    template <typename Item>
+    sgl::string_view<typename Item::char_type> text(const void* item) noexcept {
+      const auto& str = static_cast<const Item*>(item)->text();
+      return sgl::string_view<typename Item::char_type>(str.data(), str.size());
+    }
+
+    template <typename Item>
+    sgl::error handle_input(void* item, sgl::input i) noexcept {
+      return static_cast<Item*>(item)->handle_input(i);
+    }
+
+    template <typename Item>
+    void tick(void* item) noexcept {
+      static_cast<Item*>(item)->tick();
+    }
+
+    template <typename Item>
+    sgl::error set(void* item, sgl::string_view<typename Item::char_type> value) noexcept {
+      return path_impl::set(*static_cast<Item*>(item), value);
+    }
+
+    template <typename Item>
+    inline constexpr sgl::ItemOps<typename Item::char_type> ops_v{&text<Item>,
+                                                                  &handle_input<Item>,
+                                                                  &tick<Item>,
+                                                                  &set<Item>};
+
+    template <typename Menu, size_t P, size_t I>
+    void* address(Menu& menu) noexcept {
+      using Page = std::decay_t<decltype(menu.template get_page<P>())>;
+      return &menu.template get_page<P>()[sgl::type_at_t<I, typename Page::name_list>{}];
+    }
+
+    template <typename NameList, typename... Pages>
+    struct tables<sgl::Menu<NameList, sgl::type_list<Pages...>>> {
+      using Menu = sgl::Menu<NameList, sgl::type_list<Pages...>>;
+
+      static constexpr size_t num_pages = sizeof...(Pages);
+
+      static constexpr size_t num_items = (sgl::list_size_v<typename Pages::item_list> + ...);
+
+      template <size_t P, size_t I>
+      static constexpr sgl::ItemInfo<Menu> item() noexcept {
+        using Page = sgl::type_at_t<P, sgl::type_list<Pages...>>;
+        using Item = sgl::type_at_t<I, typename Page::item_list>;
+        using Traits = sgl::SerializeTraits<Item>;
+        return sgl::ItemInfo<Menu>{sgl::type_at_t<P, NameList>{}.to_view(),
+                                   sgl::type_at_t<I, typename Page::name_list>{}.to_view(),
+                                   P,
+                                   I,
+                                   kind_v<Item>,
+                                   static_cast<sgl::value_type>(Traits::tag),
+                                   Traits::size,
+                                   Item::text_size,
+                                   &address<Menu, P, I>,
+                                   &ops_v<Item>};
+      }
+
+      template <size_t P, size_t... I>
+      static constexpr void add_page(sgl::Array<sgl::ItemInfo<Menu>, num_items>& table,
+                                     size_t&                                    k,
+                                     std::index_sequence<I...>) noexcept {
+        ((table[k++] = item<P, I>()), ...);
+      }
+
+      template <size_t... P>
+      static constexpr sgl::Array<sgl::ItemInfo<Menu>, num_items>
+          items(std::index_sequence<P...>) noexcept {
+        sgl::Array<sgl::ItemInfo<Menu>, num_items> table{};
+        size_t                                     k = 0;
+        (add_page<P>(table,
+                     k,
+                     std::make_index_sequence<
+                         sgl::list_size_v<typename sgl::type_at_t<P, sgl::type_list<Pages...>>::
+                                              item_list>>{}),
+         ...);
+        return table;
+      }
+
+      static constexpr sgl::Array<sgl::ItemInfo<Menu>, num_items> items() noexcept {
+        return items(std::make_index_sequence<num_pages>{});
+      }
+
+      template <size_t... P>
+      static constexpr sgl::Array<sgl::PageInfo, num_pages>
+          pages(std::index_sequence<P...>) noexcept {
+        constexpr size_t sizes[] = {sgl::list_size_v<typename Pages::item_list>...};
+        sgl::Array<sgl::PageInfo, num_pages> table{};
+        size_t                               first = 0;
+        ((table[P] = sgl::PageInfo{sgl::type_at_t<P, NameList>{}.to_view(), first, sizes[P]},
+          first += sizes[P]),
+         ...);
+        return table;
+      }
+
+      static constexpr sgl::Array<sgl::PageInfo, num_pages> pages() noexcept {
+        return pages(std::make_index_sequence<num_pages>{});
+      }
+    };
+  } // namespace reflection_impl
+  /// @endcond
+} // namespace sgl
+#endif /* SGL_IMPL_REFLECTION_IMPL_HPP */
@@ -0,0 +1,482 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_SERIALIZE_IMPL_HPP
+#define SGL_IMPL_SERIALIZE_IMPL_HPP
+#include "sgl/boolean.hpp"
+#include "sgl/enum.hpp"
+#include "sgl/numeric.hpp"
+#include "sgl/serialize.hpp"
+
+#include <cstring>
+
+namespace sgl {
+  /// @cond
+  namespace serialize_impl {
+    /// size of the schema hash at the start of snapshots and deltas
+    inline constexpr size_t header_size = 4;
+
+    /// size of the item id in front of each delta record
+    inline constexpr size_t id_size = 2;
+
+    // value encodings, part of the schema hash
+    inline constexpr uint8_t tag_boolean = 1;
+    inline constexpr uint8_t tag_enum = 2;
+    inline constexpr uint8_t tag_unsigned = 3;
+    inline constexpr uint8_t tag_signed = 4;
+    inline constexpr uint8_t tag_floating = 5;
+    inline constexpr uint8_t tag_unsigned_fixed = 6;
+    inline constexpr uint8_t tag_signed_fixed = 7;
+
+    /// store the integer value in little endian byte order
+    template <typename U>
+    constexpr void store(uint8_t* out, U value) noexcept {
+      using Unsigned = std::make_unsigned_t<U>;
+      const auto bits = static_cast<Unsigned>(value);
+      for (size_t i = 0; i < sizeof(U); ++i) {
+        out[i] = static_cast<uint8_t>(bits >> (8 * i));
+      }
+    }
+
+    /// load an integer value stored in little endian byte order
+    template <typename U>
+    constexpr U load(const uint8_t* in) noexcept {
+      using Unsigned = std::make_unsigned_t<U>;
+      Unsigned bits{0};
+      for (size_t i = 0; i < sizeof(U); ++i) {
+        bits = static_cast<Unsigned>(bits | (static_cast<Unsigned>(in[i]) << (8 * i)));
+      }
+      return static_cast<U>(bits);
+    }
+
+    /// 32 bit FNV-1a
+    constexpr uint32_t hash(uint32_t h, const char* str, size_t n) noexcept {
+      for (size_t i = 0; i < n; ++i) {
+        h = (h ^ static_cast<uint8_t>(str[i])) * 16777619u;
+      }
+      return h;
+    }
+
+    constexpr uint32_t hash(uint32_t h, uint8_t byte) noexcept {
+      return (h ^ byte) * 16777619u;
+    }
+
+    inline constexpr uint32_t hash_seed = 2166136261u;
+
+    template <typename Name>
+    constexpr uint32_t hash_name(uint32_t h) noexcept {
+      return hash(h, Name::chars, sizeof(Name::chars));
+    }
+
+    template <typename Name, typename Item>
+    constexpr uint32_t hash_item(uint32_t h) noexcept {
+      using Traits = sgl::SerializeTraits<Item>;
+      h = hash_name<Name>(h);
+      h = hash(h, Traits::tag);
+      return hash(h, static_cast<uint8_t>(Traits::size));
+    }
+
+    template <typename Page>
+    struct page_schema;
+
+    template <typename... Names, typename... Items>
+    struct page_schema<sgl::Page<sgl::type_list<Names...>, sgl::type_list<Items...>>> {
+      static constexpr size_t payload_size = (sgl::SerializeTraits<Items>::size + ... + 0);
+
+      static constexpr size_t num_serialized = ((sgl::SerializeTraits<Items>::size != 0) + ... + 0);
+
+      static constexpr size_t num_items = sizeof...(Items);
+
+      static constexpr uint32_t hash(uint32_t h) noexcept {
+        ((h = hash_item<Names, Items>(h)), ...);
+        return h;
+      }
+    };
+
+    template <typename Menu>
+    struct menu_schema;
+
+    template <typename... Names, typename... Pages>
+    struct menu_schema<sgl::Menu<sgl::type_list<Names...>, sgl::type_list<Pages...>>> {
+      static constexpr size_t payload_size = (page_schema<Pages>::payload_size + ...);
+
+      static constexpr size_t num_items = (page_schema<Pages>::num_items + ...);
+
+      static constexpr size_t num_serialized = (page_schema<Pages>::num_serialized + ...);
+
+      static_assert(num_items <= 0xFFFF, "delta records only support menus with up to 65535 items");
+
+      static constexpr uint32_t compute_hash() noexcept {
+        uint32_t h = hash_seed;
+        ((h = page_schema<Pages>::hash(hash_name<Names>(h))), ...);
+        return h;
+      }
+
+      static constexpr uint32_t hash = compute_hash();
+    };
+
+    template <typename Item>
+    constexpr void write(const Item& item, uint8_t*& out) noexcept {
+      using Traits = sgl::SerializeTraits<Item>;
+      if constexpr (Traits::size != 0) {
+        Traits::write(item, out);
+        out += Traits::size;
+      } else {
+        static_cast<void>(item);
+      }
+    }
+
+    template <typename Item>
+    sgl::error read(Item& item, const uint8_t*& in) noexcept {
+      using Traits = sgl::SerializeTraits<Item>;
+      if constexpr (Traits::size != 0) {
+        auto ec = Traits::read(item, in);
+        in += Traits::size;
+        return ec;
+      } else {
+        static_cast<void>(item);
+        return sgl::error::no_error;
+      }
+    }
+
+    template <typename Menu>
+    constexpr bool check_hash(const uint8_t* buffer) noexcept {
+      return load<uint32_t>(buffer) == menu_schema<Menu>::hash;
+    }
+  } // namespace serialize_impl
+
+  template <size_t TextSize, typename CharT>
+  struct SerializeTraits<sgl::Boolean<TextSize, CharT>> {
+    static constexpr size_t  size = 1;
+    static constexpr uint8_t tag = serialize_impl::tag_boolean;
+
+    static void write(const sgl::Boolean<TextSize, CharT>& item, uint8_t* out) noexcept {
+      out[0] = item.get_value() ? 1 : 0;
+    }
+
+    static sgl::error read(sgl::Boolean<TextSize, CharT>& item, const uint8_t* in) noexcept {
+      if (in[0] > 1) {
+        return sgl::error::invalid_value;
+      }
+      return item.set_value(in[0] == 1);
+    }
+  };
+
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  struct SerializeTraits<sgl::Enum<T, NumEnumerators, TextSize, CharT>> {
+    using index_type = sgl::smallest_type_t<NumEnumerators>;
+
+    static constexpr size_t  size = sizeof(index_type);
+    static constexpr uint8_t tag = serialize_impl::tag_enum;
+
+    static void write(const sgl::Enum<T, NumEnumerators, TextSize, CharT>& item,
+                      uint8_t*                                             out) noexcept {
+      serialize_impl::store(out, static_cast<index_type>(item.index()));
+    }
+
+    static sgl::error read(sgl::Enum<T, NumEnumerators, TextSize, CharT>& item,
+                           const uint8_t*                                 in) noexcept {
+      const auto index = serialize_impl::load<index_type>(in);
+      if (index >= NumEnumerators) {
+        return sgl::error::invalid_value;
+      }
+      item.set_index(index);
+      return item.set_text(item.current_string());
+    }
+  };
+
+  // the index is stored, so snapshots do not depend on the language
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  struct SerializeTraits<sgl::LocalizedEnum<T, NumEnumerators, TextSize, CharT>> {
+    using index_type = sgl::smallest_type_t<NumEnumerators>;
+
+    static constexpr size_t  size = sizeof(index_type);
+    static constexpr uint8_t tag = serialize_impl::tag_enum;
+
+    static void write(const sgl::LocalizedEnum<T, NumEnumerators, TextSize, CharT>& item,
+                      uint8_t*                                                      out) noexcept {
+      serialize_impl::store(out, static_cast<index_type>(item.index()));
+    }
+
+    static sgl::error read(sgl::LocalizedEnum<T, NumEnumerators, TextSize, CharT>& item,
+                           const uint8_t*                                          in) noexcept {
+      const auto index = serialize_impl::load<index_type>(in);
+      if (index >= NumEnumerators) {
+        return sgl::error::invalid_value;
+      }
+      item.set_index(index);
+      return sgl::error::no_error;
+    }
+  };
+
+  template <size_t TextSize, typename CharT, typename T>
+  struct SerializeTraits<sgl::Numeric<TextSize, CharT, T>> {
+    static_assert(std::is_arithmetic_v<T>,
+                  "sgl::SerializeTraits is not specialized for this numeric value type.");
+
+    static constexpr size_t  size = sizeof(T);
+    static constexpr uint8_t tag = std::is_floating_point_v<T> ? serialize_impl::tag_floating
+                                   : std::is_signed_v<T>       ? serialize_impl::tag_signed
+                                                               : serialize_impl::tag_unsigned;
+
+    static void write(const sgl::Numeric<TextSize, CharT, T>& item, uint8_t* out) noexcept {
+      if constexpr (std::is_floating_point_v<T>) {
+        serialize_impl::store(out, ryu::to_bits(item.get_value()));
+      } else {
+        serialize_impl::store(out, item.get_value());
+      }
+    }
+
+    static sgl::error read(sgl::Numeric<TextSize, CharT, T>& item, const uint8_t* in) noexcept {
+      if constexpr (std::is_floating_point_v<T>) {
+        using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        const auto bits = serialize_impl::load<Bits>(in);
+        T          value{};
+        std::memcpy(&value, &bits, sizeof(T));
+        return item.set_value(value);
+      } else {
+        return item.set_value(serialize_impl::load<T>(in));
+      }
+    }
+  };
+
+  template <size_t TextSize, typename CharT, size_t I, size_t F>
+  struct SerializeTraits<sgl::Numeric<TextSize, CharT, sgl::unsigned_fixed<I, F>>> {
+    using item_type = sgl::Numeric<TextSize, CharT, sgl::unsigned_fixed<I, F>>;
+    using value_type = typename sgl::unsigned_fixed<I, F>::value_type;
+
+    static constexpr size_t  size = sizeof(value_type);
+    static constexpr uint8_t tag = serialize_impl::tag_unsigned_fixed;
+
+    static void write(const item_type& item, uint8_t* out) noexcept {
+      serialize_impl::store(out, item.get_value().value());
+    }
+
+    static sgl::error read(item_type& item, const uint8_t* in) noexcept {
+      return item.set_value(sgl::unsigned_fixed<I, F>(serialize_impl::load<value_type>(in)));
+    }
+  };
+
+  template <size_t TextSize, typename CharT, size_t I, size_t F>
+  struct SerializeTraits<sgl::Numeric<TextSize, CharT, sgl::signed_fixed<I, F>>> {
+    using item_type = sgl::Numeric<TextSize, CharT, sgl::signed_fixed<I, F>>;
+    using value_type = typename sgl::signed_fixed<I, F>::value_type;
+
+    static constexpr size_t  size = sizeof(value_type);
+    static constexpr uint8_t tag = serialize_impl::tag_signed_fixed;
+
+    static void write(const item_type& item, uint8_t* out) noexcept {
+      serialize_impl::store(out, item.get_value().value());
+    }
+
+    static sgl::error read(item_type& item, const uint8_t* in) noexcept {
+      return item.set_value(sgl::signed_fixed<I, F>(serialize_impl::load<value_type>(in)));
+    }
+  };
+
+  template <typename NameList, typename PageList>
+  inline constexpr size_t snapshot_size_v<sgl::Menu<NameList, PageList>> =
+      serialize_impl::header_size +
+      serialize_impl::menu_schema<sgl::Menu<NameList, PageList>>::payload_size;
+
+  template <typename NameList, typename PageList>
+  inline constexpr size_t max_delta_size_v<sgl::Menu<NameList, PageList>> =
+      snapshot_size_v<sgl::Menu<NameList, PageList>> +
+      serialize_impl::id_size *
+          serialize_impl::menu_schema<sgl::Menu<NameList, PageList>>::num_serialized;
+
+  template <typename NameList, typename PageList>
+  inline constexpr uint32_t schema_hash_v<sgl::Menu<NameList, PageList>> =
+      serialize_impl::menu_schema<sgl::Menu<NameList, PageList>>::hash;
+  /// @endcond
+
+  template <typename NameList, typename PageList>
+  sgl::serialize_result serialize(const sgl::Menu<NameList, PageList>& menu,
+                                  uint8_t*                             buffer,
+                                  size_t                               len) noexcept {
+    using Menu = sgl::Menu<NameList, PageList>;
+    if (len < snapshot_size_v<Menu>) {
+      return {sgl::error::buffer_too_small, 0};
+    }
+    serialize_impl::store(buffer, schema_hash_v<Menu>);
+    uint8_t* out = buffer + serialize_impl::header_size;
+    menu.for_each_page([&out](const auto& page) {
+      page.for_each_item([&out](const auto& item) { serialize_impl::write(item, out); });
+    });
+    return {sgl::error::no_error, snapshot_size_v<Menu>};
+  }
+
+  template <typename NameList, typename PageList>
+  sgl::error deserialize(sgl::Menu<NameList, PageList>& menu,
+                         const uint8_t*                 buffer,
+                         size_t                         len) noexcept {
+    using Menu = sgl::Menu<NameList, PageList>;
+    if (len < serialize_impl::header_size) {
+      return sgl::error::buffer_too_small;
+    }
+    if (!serialize_impl::check_hash<Menu>(buffer)) {
+      return sgl::error::schema_mismatch;
+    }
+    if (len < snapshot_size_v<Menu>) {
+      return sgl::error::buffer_too_small;
+    }
+    const uint8_t* in = buffer + serialize_impl::header_size;
+    sgl::error     ec{sgl::error::no_error};
+    menu.for_each_page([&in, &ec](auto& page) {
+      page.for_each_item([&in, &ec](auto& item) {
+        if (ec == sgl::error::no_error) {
+          ec = serialize_impl::read(item, in);
+        }
+      });
+    });
+    return ec;
+  }
+
+  /// @cond
+  namespace serialize_impl {
+    /// write a record for every value of menu which differs from the values in last into out.
+    /// last is not modified, see commit_records(). Returns the number of bytes written.
+    template <typename Menu>
+    sgl::serialize_result
+        write_records(const Menu& menu, const uint8_t* last, uint8_t* out, size_t len) noexcept {
+      size_t     size = 0;
+      uint16_t   id = 0;
+      sgl::error ec{sgl::error::no_error};
+      menu.for_each_page([&](const auto& page) {
+        page.for_each_item([&](const auto& item) {
+          using Traits = sgl::SerializeTraits<std::decay_t<decltype(item)>>;
+          if constexpr (Traits::size != 0) {
+            uint8_t  current[Traits::size]{};
+            uint8_t* it = current;
+            write(item, it);
+            if (ec == sgl::error::no_error and std::memcmp(current, last, Traits::size) != 0) {
+              if (size + id_size + Traits::size > len) {
+                ec = sgl::error::buffer_too_small;
+              } else {
+                store(out + size, id);
+                std::memcpy(out + size + id_size, current, Traits::size);
+                size += id_size + Traits::size;
+              }
+            }
+            last += Traits::size;
+          }
+          ++id;
+        });
+      });
+      if (ec != sgl::error::no_error) {
+        return {ec, 0};
+      }
+      return {sgl::error::no_error, size};
+    }
+
+    /// copy the values of the records in [in, in + len), written by write_records(), into last.
+    template <typename Menu>
+    void commit_records(const Menu& menu, uint8_t* last, const uint8_t* in, size_t len) noexcept {
+      const uint8_t* end = in + len;
+      uint16_t       id = 0;
+      menu.for_each_page([&](const auto& page) {
+        page.for_each_item([&](const auto& item) {
+          using Traits = sgl::SerializeTraits<std::decay_t<decltype(item)>>;
+          if constexpr (Traits::size != 0) {
+            if (in != end and load<uint16_t>(in) == id) {
+              std::memcpy(last, in + id_size, Traits::size);
+              in += id_size + Traits::size;
+            }
+            last += Traits::size;
+          }
+          ++id;
+        });
+      });
+    }
+
+    /// apply the records in [in, in + len) to menu.
+    template <typename Menu>
+    sgl::error read_records(Menu& menu, const uint8_t* in, size_t len) noexcept {
+      // records are sorted by id, so they can be applied in a single pass over the menu.
+      const uint8_t* end = in + len;
+      uint16_t       id = 0;
+      sgl::error     ec{sgl::error::no_error};
+      menu.for_each_page([&](auto& page) {
+        page.for_each_item([&](auto& item) {
+          using Traits = sgl::SerializeTraits<std::decay_t<decltype(item)>>;
+          if (ec == sgl::error::no_error and (end - in) >= 2 and load<uint16_t>(in) == id) {
+            if constexpr (Traits::size != 0) {
+              if (static_cast<size_t>(end - in) < id_size + Traits::size) {
+                ec = sgl::error::invalid_value;
+              } else {
+                in += id_size;
+                ec = read(item, in);
+              }
+            } else {
+              static_cast<void>(item);
+              ec = sgl::error::invalid_value;
+            }
+          }
+          ++id;
+        });
+      });
+      if (ec == sgl::error::no_error and in != end) {
+        // unknown id or records out of order
+        return sgl::error::invalid_value;
+      }
+      return ec;
+    }
+  } // namespace serialize_impl
+  /// @endcond
+
+  template <typename NameList, typename PageList>
+  sgl::serialize_result serialize_delta(const sgl::Menu<NameList, PageList>& menu,
+                                        uint8_t*                             snapshot,
+                                        size_t                               snapshot_len,
+                                        uint8_t*                             buffer,
+                                        size_t                               len) noexcept {
+    using Menu = sgl::Menu<NameList, PageList>;
+    if (snapshot_len < snapshot_size_v<Menu>) {
+      return {sgl::error::buffer_too_small, 0};
+    }
+    if (!serialize_impl::check_hash<Menu>(snapshot)) {
+      return {sgl::error::schema_mismatch, 0};
+    }
+    if (len < serialize_impl::header_size) {
+      return {sgl::error::buffer_too_small, 0};
+    }
+    // the header is only written if something changed.
+    auto res = serialize_impl::write_records(menu,
+                                             snapshot + serialize_impl::header_size,
+                                             buffer + serialize_impl::header_size,
+                                             len - serialize_impl::header_size);
+    if (res.ec != sgl::error::no_error or res.size == 0) {
+      return res;
+    }
+    // the snapshot is only updated once the whole delta fits, so that a retry with a bigger
+    // buffer still contains every change.
+    serialize_impl::commit_records(menu,
+                                   snapshot + serialize_impl::header_size,
+                                   buffer + serialize_impl::header_size,
+                                   res.size);
+    serialize_impl::store(buffer, schema_hash_v<Menu>);
+    return {sgl::error::no_error, serialize_impl::header_size + res.size};
+  }
+
+  template <typename NameList, typename PageList>
+  sgl::error deserialize_delta(sgl::Menu<NameList, PageList>& menu,
+                               const uint8_t*                 buffer,
+                               size_t                         len) noexcept {
+    using Menu = sgl::Menu<NameList, PageList>;
+    if (len == 0) {
+      return sgl::error::no_error;
+    }
+    if (len < serialize_impl::header_size) {
+      return sgl::error::invalid_value;
+    }
+    if (!serialize_impl::check_hash<Menu>(buffer)) {
+      return sgl::error::schema_mismatch;
+    }
+    return serialize_impl::read_records(menu,
+                                        buffer + serialize_impl::header_size,
+                                        len - serialize_impl::header_size);
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_SERIALIZE_IMPL_HPP */
@@ -0,0 +1,205 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_SETTINGS_JOURNAL_IMPL_HPP
+#define SGL_IMPL_SETTINGS_JOURNAL_IMPL_HPP
+#include "sgl/settings_journal.hpp"
+
+namespace sgl {
+  /// @cond
+  namespace journal_impl {
+    /// 'SGLJ'
+    inline constexpr uint32_t magic = 0x4A4C4753u;
+
+    /// length of an entry in erased memory
+    inline constexpr uint16_t erased_length = 0xFFFF;
+
+    /// CRC-16/CCITT-FALSE, catches torn writes and corrupted entries. It detects all burst errors
+    /// of up to 16 bits and any odd number of flipped bits. crc continues a previous calculation.
+    constexpr uint16_t crc16(const uint8_t* data, size_t len, uint16_t crc = 0xFFFF) noexcept {
+      for (size_t i = 0; i < len; ++i) {
+        crc = static_cast<uint16_t>(crc ^ (data[i] << 8));
+        for (int bit = 0; bit < 8; ++bit) {
+          crc = static_cast<uint16_t>((crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1);
+        }
+      }
+      return crc;
+    }
+
+    /// crc of an entry, covers the payload length and the payload which follows the crc.
+    constexpr uint16_t entry_crc(const uint8_t* entry, size_t payload_size) noexcept {
+      return crc16(entry + 4, payload_size, crc16(entry, 2));
+    }
+
+    /// newer sequence number, wrap around safe
+    constexpr bool is_newer(uint32_t a, uint32_t b) noexcept {
+      return static_cast<int32_t>(a - b) > 0;
+    }
+  } // namespace journal_impl
+  /// @endcond
+
+  template <typename Menu, typename BlockDevice>
+  SettingsJournal<Menu, BlockDevice>::SettingsJournal(const Menu&  menu,
+                                                      BlockDevice& device) noexcept
+      : device_(&device) {
+    static_cast<void>(sgl::serialize(menu, snapshot_, sizeof(snapshot_)));
+  }
+
+  template <typename Menu, typename BlockDevice>
+  sgl::error SettingsJournal<Menu, BlockDevice>::restore(Menu& menu) noexcept {
+    const size_t count = device_->block_count();
+    if (count < 2) {
+      return sgl::error::invalid_input;
+    }
+    if (device_->block_size() < min_block_size) {
+      return sgl::error::buffer_too_small;
+    }
+    bool found = false;
+    for (size_t block = 0; block < count; ++block) {
+      uint8_t header[block_header_size + serialize_impl::header_size]{};
+      if (device_->read(block, 0, header, sizeof(header)) != sgl::error::no_error) {
+        return sgl::error::storage_error;
+      }
+      const auto sequence = serialize_impl::load<uint32_t>(header + 4);
+      if (serialize_impl::load<uint32_t>(header) != journal_impl::magic or
+          !serialize_impl::check_hash<Menu>(header + block_header_size)) {
+        continue;
+      }
+      if (!found or journal_impl::is_newer(sequence, sequence_)) {
+        found = true;
+        block_ = block;
+        sequence_ = sequence;
+      }
+    }
+    if (!found) {
+      // nothing to restore, start a new journal with the current values of menu.
+      block_ = count - 1;
+      sequence_ = 0;
+      return compact(menu);
+    }
+    return replay(menu, block_);
+  }
+
+  template <typename Menu, typename BlockDevice>
+  sgl::error SettingsJournal<Menu, BlockDevice>::record(const Menu& menu) noexcept {
+    if (needs_compaction_) {
+      return compact(menu);
+    }
+    constexpr size_t max_payload = sgl::max_delta_size_v<Menu> - serialize_impl::header_size;
+    uint8_t          entry[entry_header_size + max_payload]{};
+    auto             res = serialize_impl::write_records(menu,
+                                             snapshot_ + serialize_impl::header_size,
+                                             entry + entry_header_size,
+                                             max_payload);
+    if (res.ec != sgl::error::no_error) {
+      return res.ec;
+    }
+    if (res.size == 0) {
+      return sgl::error::no_error;
+    }
+    serialize_impl::commit_records(menu,
+                                   snapshot_ + serialize_impl::header_size,
+                                   entry + entry_header_size,
+                                   res.size);
+    const size_t entry_size = entry_header_size + res.size;
+    if (offset_ + entry_size > device_->block_size()) {
+      // snapshot_ is already up to date, only the block needs to be written.
+      return write_block((block_ + 1) % device_->block_count());
+    }
+    serialize_impl::store(entry, static_cast<uint16_t>(res.size));
+    serialize_impl::store(entry + 2, journal_impl::entry_crc(entry, res.size));
+    if (device_->write(block_, offset_, entry, entry_size) != sgl::error::no_error) {
+      needs_compaction_ = true;
+      return sgl::error::storage_error;
+    }
+    offset_ += entry_size;
+    return sgl::error::no_error;
+  }
+
+  template <typename Menu, typename BlockDevice>
+  sgl::error SettingsJournal<Menu, BlockDevice>::compact(const Menu& menu) noexcept {
+    static_cast<void>(sgl::serialize(menu, snapshot_, sizeof(snapshot_)));
+    return write_block((block_ + 1) % device_->block_count());
+  }
+
+  template <typename Menu, typename BlockDevice>
+  size_t SettingsJournal<Menu, BlockDevice>::current_block() const noexcept {
+    return block_;
+  }
+
+  template <typename Menu, typename BlockDevice>
+  size_t SettingsJournal<Menu, BlockDevice>::bytes_used() const noexcept {
+    return offset_;
+  }
+
+  template <typename Menu, typename BlockDevice>
+  sgl::error SettingsJournal<Menu, BlockDevice>::write_block(size_t block) noexcept {
+    needs_compaction_ = true;
+    uint8_t header[block_header_size]{};
+    serialize_impl::store(header, journal_impl::magic);
+    serialize_impl::store(header + 4, sequence_ + 1);
+    // the magic is written last, so a block is only valid once its snapshot is complete.
+    if (device_->erase(block) != sgl::error::no_error or
+        device_->write(block, 4, header + 4, 4) != sgl::error::no_error or
+        device_->write(block, block_header_size, snapshot_, sizeof(snapshot_)) !=
+            sgl::error::no_error or
+        device_->write(block, 0, header, 4) != sgl::error::no_error) {
+      return sgl::error::storage_error;
+    }
+    block_ = block;
+    ++sequence_;
+    offset_ = block_header_size + sizeof(snapshot_);
+    needs_compaction_ = false;
+    return sgl::error::no_error;
+  }
+
+  template <typename Menu, typename BlockDevice>
+  sgl::error SettingsJournal<Menu, BlockDevice>::replay(Menu& menu, size_t block) noexcept {
+    if (device_->read(block, block_header_size, snapshot_, sizeof(snapshot_)) !=
+        sgl::error::no_error) {
+      return sgl::error::storage_error;
+    }
+    if (auto ec = sgl::deserialize(menu, snapshot_, sizeof(snapshot_)); ec != sgl::error::no_error) {
+      return ec;
+    }
+    constexpr size_t max_payload = sgl::max_delta_size_v<Menu> - serialize_impl::header_size;
+    const size_t     block_size = device_->block_size();
+    sgl::error       ec{sgl::error::no_error};
+    offset_ = block_header_size + sizeof(snapshot_);
+    needs_compaction_ = false;
+    while (offset_ + entry_header_size <= block_size) {
+      uint8_t entry[entry_header_size + max_payload]{};
+      if (device_->read(block, offset_, entry, entry_header_size) != sgl::error::no_error) {
+        return sgl::error::storage_error;
+      }
+      const auto size = serialize_impl::load<uint16_t>(entry);
+      if (size == journal_impl::erased_length) {
+        break;
+      }
+      if (size == 0 or size > max_payload or offset_ + entry_header_size + size > block_size) {
+        needs_compaction_ = true;
+        break;
+      }
+      if (device_->read(block, offset_ + entry_header_size, entry + entry_header_size, size) !=
+          sgl::error::no_error) {
+        return sgl::error::storage_error;
+      }
+      if (journal_impl::entry_crc(entry, size) != serialize_impl::load<uint16_t>(entry + 2)) {
+        // torn write, the rest of the block can not be appended to anymore.
+        needs_compaction_ = true;
+        break;
+      }
+      ec = serialize_impl::read_records(menu, entry + entry_header_size, size);
+      if (ec != sgl::error::no_error) {
+        needs_compaction_ = true;
+        break;
+      }
+      offset_ += entry_header_size + size;
+    }
+    static_cast<void>(sgl::serialize(menu, snapshot_, sizeof(snapshot_)));
+    return ec;
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_SETTINGS_JOURNAL_IMPL_HPP */
@@ -0,0 +1,211 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef SGL_IMPL_TEXT_LAYOUT_IMPL_HPP
+#define SGL_IMPL_TEXT_LAYOUT_IMPL_HPP
+#include "sgl/text_layout.hpp"
+
+#include <type_traits>
+
+namespace sgl {
+  namespace detail {
+    /// closed range of code points
+    struct CodePointRange {
+      char32_t first;
+      char32_t last;
+    };
+
+    /// combining marks and zero width characters
+    inline constexpr CodePointRange zero_width_ranges[] = {
+        {0x0300, 0x036F},   {0x0483, 0x0489},   {0x0591, 0x05BD},   {0x05BF, 0x05BF},
+        {0x05C1, 0x05C2},   {0x05C4, 0x05C5},   {0x05C7, 0x05C7},   {0x0610, 0x061A},
+        {0x064B, 0x065F},   {0x0670, 0x0670},   {0x06D6, 0x06DC},   {0x06DF, 0x06E4},
+        {0x0900, 0x0902},   {0x093C, 0x093C},   {0x0941, 0x0948},   {0x094D, 0x094D},
+        {0x0E31, 0x0E31},   {0x0E34, 0x0E3A},   {0x0E47, 0x0E4E},   {0x1AB0, 0x1AFF},
+        {0x1DC0, 0x1DFF},   {0x200B, 0x200F},   {0x202A, 0x202E},   {0x2060, 0x2064},
+        {0x20D0, 0x20FF},   {0x302A, 0x302D},   {0x3099, 0x309A},   {0xFE00, 0xFE0F},
+        {0xFE20, 0xFE2F},   {0xFEFF, 0xFEFF},   {0xE0001, 0xE007F}, {0xE0100, 0xE01EF}};
+
+    /// East Asian wide and fullwidth characters
+    inline constexpr CodePointRange wide_ranges[] = {
+        {0x1100, 0x115F},   {0x231A, 0x231B},   {0x2329, 0x232A},   {0x23E9, 0x23EC},
+        {0x25FD, 0x25FE},   {0x2614, 0x2615},   {0x2E80, 0x3029},   {0x302E, 0x303E},
+        {0x3041, 0x3098},   {0x309B, 0x33FF},   {0x3400, 0x4DBF},   {0x4E00, 0x9FFF},
+        {0xA000, 0xA4CF},   {0xA960, 0xA97F},   {0xAC00, 0xD7A3},   {0xF900, 0xFAFF},
+        {0xFE10, 0xFE19},   {0xFE30, 0xFE6F},   {0xFF00, 0xFF60},   {0xFFE0, 0xFFE6},
+        {0x1F300, 0x1F64F}, {0x1F900, 0x1F9FF}, {0x20000, 0x2FFFD}, {0x30000, 0x3FFFD}};
+
+    /// binary search of c in sorted, disjoint ranges
+    template <size_t N>
+    constexpr bool contains(const CodePointRange (&ranges)[N], char32_t c) noexcept {
+      if (c < ranges[0].first or c > ranges[N - 1].last) {
+        return false;
+      }
+      size_t low = 0;
+      size_t high = N;
+      while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        if (c > ranges[mid].last) {
+          low = mid + 1;
+        } else if (c < ranges[mid].first) {
+          high = mid;
+        } else {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    inline constexpr char32_t replacement_character = 0xFFFD;
+  } // namespace detail
+
+  template <typename CharT>
+  constexpr char32_t decode(sgl::string_view<CharT> text, size_t& pos) noexcept {
+    using uchar = std::make_unsigned_t<CharT>;
+    const auto unit = [&text](size_t i) {
+      return static_cast<char32_t>(static_cast<uchar>(text[i]));
+    };
+    const char32_t first = unit(pos);
+    ++pos;
+    if constexpr (sizeof(CharT) == 1) {
+      if (first < 0x80) {
+        return first;
+      }
+      size_t   length = 0;
+      char32_t c = 0;
+      char32_t min = 0;
+      if ((first & 0xE0) == 0xC0) {
+        length = 1;
+        c = first & 0x1F;
+        min = 0x80;
+      } else if ((first & 0xF0) == 0xE0) {
+        length = 2;
+        c = first & 0x0F;
+        min = 0x800;
+      } else if ((first & 0xF8) == 0xF0) {
+        length = 3;
+        c = first & 0x07;
+        min = 0x10000;
+      } else {
+        return detail::replacement_character;
+      }
+      if (text.size() - pos < length) {
+        return detail::replacement_character;
+      }
+      for (size_t i = 0; i < length; ++i) {
+        const char32_t next = unit(pos + i);
+        if ((next & 0xC0) != 0x80) {
+          return detail::replacement_character;
+        }
+        c = (c << 6) | (next & 0x3F);
+      }
+      // reject overlong encodings, surrogates and code points past U+10FFFF
+      if (c < min or (c >= 0xD800 and c <= 0xDFFF) or c > 0x10FFFF) {
+        return detail::replacement_character;
+      }
+      pos += length;
+      return c;
+    } else if constexpr (sizeof(CharT) == 2) {
+      if (first < 0xD800 or first > 0xDFFF) {
+        return first;
+      }
+      if (first > 0xDBFF or pos == text.size()) {
+        return detail::replacement_character;
+      }
+      const char32_t low = unit(pos);
+      if (low < 0xDC00 or low > 0xDFFF) {
+        return detail::replacement_character;
+      }
+      ++pos;
+      return 0x10000 + ((first - 0xD800) << 10) + (low - 0xDC00);
+    } else {
+      return first > 0x10FFFF ? detail::replacement_character : first;
+    }
+  }
+
+  constexpr size_t display_width(char32_t c) noexcept {
+    if (c < 0x300) {
+      return 1;
+    }
+    if (detail::contains(detail::zero_width_ranges, c)) {
+      return 0;
+    }
+    return detail::contains(detail::wide_ranges, c) ? 2 : 1;
+  }
+
+  template <typename CharT>
+  constexpr size_t display_width(sgl::string_view<CharT> text) noexcept {
+    size_t width = 0;
+    size_t pos = 0;
+    while (pos < text.size()) {
+      width += display_width(decode(text, pos));
+    }
+    return width;
+  }
+
+  template <typename CharT>
+  constexpr LineLayout
+      layout_line(sgl::string_view<CharT> text, size_t columns, size_t ellipsis_width) noexcept {
+    // columns available for the visible text if the ellipsis is needed
+    const size_t limit = columns < ellipsis_width ? 0 : columns - ellipsis_width;
+    LineLayout   res;
+    size_t       width = 0;
+    size_t       pos = 0;
+    while (pos < text.size()) {
+      const size_t w = display_width(decode(text, pos));
+      if (width + w > columns) {
+        // the text does not fit, res holds the longest prefix which fits next to the ellipsis
+        res.scanned = pos;
+        res.truncated = true;
+        return res;
+      }
+      width += w;
+      if (width <= limit) {
+        res.width = width;
+        res.units = pos;
+      }
+    }
+    res.width = width;
+    res.units = text.size();
+    res.scanned = text.size();
+    return res;
+  }
+
+  template <typename CharT, size_t Capacity>
+  constexpr bool TextLayout<CharT, Capacity>::update(sgl::string_view<CharT> text,
+                                                     size_t                  columns,
+                                                     size_t ellipsis_width) noexcept {
+    if (valid_ and columns == columns_ and ellipsis_width == ellipsis_width_ and matches(text)) {
+      return false;
+    }
+    layout_ = layout_line(text, columns, ellipsis_width);
+    columns_ = columns;
+    ellipsis_width_ = ellipsis_width;
+    valid_ = layout_.scanned <= Capacity;
+    if (valid_) {
+      for (size_t i = 0; i < layout_.scanned; ++i) {
+        units_[i] = text[i];
+      }
+    }
+    return true;
+  }
+
+  template <typename CharT, size_t Capacity>
+  constexpr bool
+      TextLayout<CharT, Capacity>::matches(sgl::string_view<CharT> text) const noexcept {
+    // a truncated layout only depends on the scanned prefix, a complete one on the whole text
+    const size_t scanned = layout_.scanned;
+    if (layout_.truncated ? text.size() < scanned : text.size() != scanned) {
+      return false;
+    }
+    for (size_t i = 0; i < scanned; ++i) {
+      if (units_[i] != text[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+} // namespace sgl
+#endif /* SGL_IMPL_TEXT_LAYOUT_IMPL_HPP */
@@ -0,0 +1,87 @@
+/**
+ * @file sgl/instantiate.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains the item aliases and the extern template declarations which are active if
+ * SGL_INSTANTIATE is 1, i.e. if the instantiate meson option is set. The matching explicit
+ * instantiations are compiled once into the sgl static library, see src/instantiate.cpp.
+ *
+ * @version 0.1
+ * @date 2023-03-18
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_INSTANTIATE_HPP
+#define SGL_INSTANTIATE_HPP
+#include "sgl/config.h"
+#include "sgl/items.hpp"
+
+#if SGL_INSTANTIATE == 1
+namespace sgl {
+  using Bool_t = Boolean<SGL_LINE_WIDTH, SGL_CHAR_TYPE>;
+  using Int8_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, int8_t>;
+  using UInt8_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, uint8_t>;
+  using Int16_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, int16_t>;
+  using UInt16_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, uint16_t>;
+  using Int32_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, int32_t>;
+  using UInt32_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, uint32_t>;
+  using Int64_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, int64_t>;
+  using UInt64_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, uint64_t>;
+  using Float_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, float>;
+  using Double_t = Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, double>;
+} // namespace sgl
+
+/// @cond
+// SGL_INSTANTIATE_ALL(extern) declares, SGL_INSTANTIATE_ALL() defines the instantiations.
+  #define SGL_INSTANTIATE_ITEM(EXTERN, ITEM)                                                  \
+    EXTERN template class sgl::Callable<sgl::error(ITEM&, sgl::input)>;                      \
+    EXTERN template class sgl::Callable<void(ITEM&)>;                                         \
+    EXTERN template class sgl::ItemBase<ITEM>;                                                \
+    EXTERN template class ITEM;
+
+  #define SGL_INSTANTIATE_NUMERIC(EXTERN, T)                                                  \
+    EXTERN template class sgl::Callable<sgl::format_result(                                   \
+        SGL_CHAR_TYPE*, size_t, T, uint32_t, sgl::format)>;                                   \
+    SGL_INSTANTIATE_ITEM(EXTERN, SGL_WRAP(sgl::Numeric<SGL_LINE_WIDTH, SGL_CHAR_TYPE, T>))
+
+  #define SGL_INSTANTIATE_INTEGER(EXTERN, T)                                                  \
+    EXTERN template sgl::format_result sgl::to_chars<SGL_CHAR_TYPE, T>(                       \
+        SGL_CHAR_TYPE*, size_t, T) noexcept;                                                  \
+    SGL_INSTANTIATE_NUMERIC(EXTERN, T)
+
+  #define SGL_WRAP(...) __VA_ARGS__
+
+  #define SGL_INSTANTIATE_ALL(EXTERN)                                                         \
+    EXTERN template unsigned ryu::f2s_buffered_n<SGL_CHAR_TYPE>(float, SGL_CHAR_TYPE*) noexcept; \
+    EXTERN template unsigned ryu::d2s_buffered_n<SGL_CHAR_TYPE>(double,                       \
+                                                                SGL_CHAR_TYPE*) noexcept;     \
+    EXTERN template unsigned ryu::d2fixed_buffered_n<SGL_CHAR_TYPE>(                          \
+        double, uint32_t, SGL_CHAR_TYPE*) noexcept;                                           \
+    EXTERN template unsigned ryu::d2exp_buffered_n<SGL_CHAR_TYPE>(                            \
+        double, uint32_t, SGL_CHAR_TYPE*) noexcept;                                           \
+    EXTERN template unsigned ryu::f2fixed_buffered_n<SGL_CHAR_TYPE>(                          \
+        float, uint32_t, SGL_CHAR_TYPE*) noexcept;                                            \
+    EXTERN template unsigned ryu::f2exp_buffered_n<SGL_CHAR_TYPE>(                            \
+        float, uint32_t, SGL_CHAR_TYPE*) noexcept;                                            \
+    EXTERN template sgl::format_result sgl::to_chars<SGL_CHAR_TYPE>(                          \
+        SGL_CHAR_TYPE*, size_t, float, uint32_t, sgl::format) noexcept;                       \
+    EXTERN template sgl::format_result sgl::to_chars<SGL_CHAR_TYPE>(                          \
+        SGL_CHAR_TYPE*, size_t, double, uint32_t, sgl::format) noexcept;                      \
+    SGL_INSTANTIATE_ITEM(EXTERN, SGL_WRAP(sgl::Boolean<SGL_LINE_WIDTH, SGL_CHAR_TYPE>))      \
+    SGL_INSTANTIATE_INTEGER(EXTERN, int8_t)                                                   \
+    SGL_INSTANTIATE_INTEGER(EXTERN, uint8_t)                                                  \
+    SGL_INSTANTIATE_INTEGER(EXTERN, int16_t)                                                  \
+    SGL_INSTANTIATE_INTEGER(EXTERN, uint16_t)                                                 \
+    SGL_INSTANTIATE_INTEGER(EXTERN, int32_t)                                                  \
+    SGL_INSTANTIATE_INTEGER(EXTERN, uint32_t)                                                 \
+    SGL_INSTANTIATE_INTEGER(EXTERN, int64_t)                                                  \
+    SGL_INSTANTIATE_INTEGER(EXTERN, uint64_t)                                                 \
+    SGL_INSTANTIATE_NUMERIC(EXTERN, float)                                                    \
+    SGL_INSTANTIATE_NUMERIC(EXTERN, double)
+
+SGL_INSTANTIATE_ALL(extern)
+/// @endcond
+#endif
+#endif /* SGL_INSTANTIATE_HPP */
@@ -135,6 +135,19 @@ namespace sgl {
   template <typename T>
   inline constexpr bool has_tick_v = has_tick<T>::value;
 
+  // optional hook of items whose text depends on external state, e.g. sgl::LocalizedText. Pages
+  // call it when they are entered or refreshed.
+  template <typename T, typename = void>
+  struct has_refresh : std::false_type {};
+
+  template <typename T>
+  struct has_refresh<T, decltype(std::declval<T>().refresh())> {
+    static constexpr bool value = noexcept(std::declval<T>().refresh());
+  };
+
+  template <typename T>
+  inline constexpr bool has_refresh_v = has_refresh<T>::value;
+
   namespace detail {
     [[maybe_unused]] inline auto pf = [](auto&) {};
     [[maybe_unused]] inline auto pcf = [](const auto&) {};
@@ -62,6 +62,30 @@ namespace sgl {
     static constexpr size_t text_size = TextSize;
   };
 
+  // localized text item traits
+  template <size_t TextSize, typename CharT>
+  struct ItemTraits<sgl::LocalizedText<TextSize, CharT>> {
+    using item_type = sgl::LocalizedText<TextSize, CharT>;
+    using char_type = CharT;
+    static constexpr size_t text_size = TextSize;
+  };
+
+  // localized enum item traits
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  struct ItemTraits<sgl::LocalizedEnum<T, NumEnumerators, TextSize, CharT>> {
+    using item_type = sgl::LocalizedEnum<T, NumEnumerators, TextSize, CharT>;
+    using char_type = CharT;
+    static constexpr size_t text_size = TextSize;
+  };
+
+  // graph item traits
+  template <size_t Samples, size_t TextSize, typename CharT, typename T>
+  struct ItemTraits<sgl::Graph<Samples, TextSize, CharT, T>> {
+    using item_type = sgl::Graph<Samples, TextSize, CharT, T>;
+    using char_type = CharT;
+    static constexpr size_t text_size = TextSize;
+  };
+
   /// @endcond
 } // namespace sgl
 
@@ -8,7 +8,9 @@
 #include "sgl/boolean.hpp"
 #include "sgl/button.hpp"
 #include "sgl/enum.hpp"
+#include "sgl/graph.hpp"
 #include "sgl/item_base.hpp"
+#include "sgl/localized.hpp"
 #include "sgl/numeric.hpp"
 #include "sgl/page_link.hpp"
 #include "sgl/pass_through_button.hpp"
@@ -19,4 +21,6 @@
 /// @defgroup boolean_factories Boolean Factory Functions
 /// @defgroup page_link_factories PageLink Factory Functions
 /// @defgroup numeric_factories Numeric Factory Functions
+/// @defgroup graph_factories Graph Factory Functions
+/// @defgroup localized_factories Localized Item Factory Functions
 #endif /* SGL_ITEMS_HPP */
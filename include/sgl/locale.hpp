@@ -0,0 +1,146 @@
+/**
+ * @file sgl/locale.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::StringTable, which holds the strings of all languages, and sgl::Locale,
+ * which selects the language of the localized items in sgl/localized.hpp.
+ *
+ * @version 0.1
+ * @date 2023-03-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_LOCALE_HPP
+#define SGL_LOCALE_HPP
+#include "sgl/error.hpp"
+#include "sgl/string_view.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace sgl {
+
+  /// @headerfile locale.hpp "sgl/locale.hpp"
+
+  /**
+    @brief Table of the strings of all languages, indexed by language and string id.
+
+    A string id is an enumerator or integer which is the same in all languages. The table only
+    holds string_views, so the characters stay wherever the literals are, i.e. in flash on most
+    targets, and a constexpr table costs no RAM.
+
+    ```cpp
+    enum class str : size_t { volume, mute, off, on, count };
+
+    constexpr sgl::StringTable<char, 2, size_t(str::count)> strings{{
+        {"Volume"_sv, "Mute"_sv, "Off"_sv, "On"_sv},
+        {"Lautstaerke"_sv, "Stumm"_sv, "Aus"_sv, "Ein"_sv},
+    }};
+    ```
+
+    @tparam CharT character type
+    @tparam Languages number of languages
+    @tparam Strings number of strings per language
+   */
+  template <typename CharT, size_t Languages, size_t Strings>
+  struct StringTable {
+    static_assert(Languages > 0 and Strings > 0, "a string table can't be empty");
+
+    /// @return number of languages
+    static constexpr size_t languages() noexcept { return Languages; }
+
+    /// @return number of strings per language
+    static constexpr size_t size() noexcept { return Strings; }
+
+    /**
+      get a string.
+      @param language language index
+      @param id string id
+      @return the string, or an empty string_view if language or id is out of range
+     */
+    [[nodiscard]] constexpr sgl::string_view<CharT> get(size_t language, size_t id) const noexcept {
+      return language < Languages and id < Strings ? strings[language][id]
+                                                   : sgl::string_view<CharT>{};
+    }
+
+    sgl::string_view<CharT> strings[Languages][Strings]; ///< strings of each language
+  };
+
+  /**
+    @brief The current language of a StringTable.
+
+    Localized items, see sgl/localized.hpp, hold a pointer to a locale and the id of their string.
+    set_language() only swaps the pointer to the current language's strings and increments the
+    generation, so switching languages takes constant time, no matter how many items or languages
+    there are. Each localized item renders its text again when its page is entered or refreshed,
+    see Menu::refresh(), so only what is displayed is rendered right away.
+
+    The table must outlive the locale, and the locale must outlive the items using it.
+
+    @tparam CharT character type
+   */
+  template <typename CharT>
+  class Locale {
+  public:
+    /**
+      construct a locale of table.
+      @param table string table
+      @param language initial language, 0 if out of range
+     */
+    template <size_t Languages, size_t Strings>
+    constexpr explicit Locale(const StringTable<CharT, Languages, Strings>& table,
+                              size_t                                       language = 0) noexcept;
+
+    /**
+      switch the language in constant time.
+      @param language language index
+      @return sgl::error::out_of_range if language is out of range, else sgl::error::no_error
+     */
+    constexpr sgl::error set_language(size_t language) noexcept;
+
+    /// @return index of the current language
+    [[nodiscard]] constexpr size_t language() const noexcept;
+
+    /// @return number of languages
+    [[nodiscard]] constexpr size_t languages() const noexcept;
+
+    /// @return number of strings per language
+    [[nodiscard]] constexpr size_t size() const noexcept;
+
+    /**
+      get a string of the current language.
+      @tparam Id enumeration or integral type
+      @param id string id
+      @return the string, or an empty string_view if id is out of range
+     */
+    template <typename Id>
+    [[nodiscard]] constexpr sgl::string_view<CharT> get(Id id) const noexcept;
+
+    /// @return number of language switches so far. Items compare it to detect a switch.
+    [[nodiscard]] constexpr uint32_t generation() const noexcept;
+
+  private:
+    using Row = const sgl::string_view<CharT>* (*)(const void*, size_t) noexcept;
+
+    const void*                    table_;         ///< the StringTable
+    Row                            row_;           ///< gets the strings of a language from table_
+    const sgl::string_view<CharT>* current_;       ///< strings of the current language
+    size_t                         languages_;     ///< number of languages
+    size_t                         size_;          ///< number of strings per language
+    size_t                         language_{0};   ///< index of the current language
+    uint32_t                       generation_{0}; ///< number of language switches
+  };
+
+  /// @cond
+  template <typename CharT, size_t Languages, size_t Strings>
+  Locale(const StringTable<CharT, Languages, Strings>&) -> Locale<CharT>;
+
+  template <typename CharT, size_t Languages, size_t Strings>
+  Locale(const StringTable<CharT, Languages, Strings>&, size_t) -> Locale<CharT>;
+  /// @endcond
+} // namespace sgl
+
+#include "sgl/impl/locale_impl.hpp"
+#endif /* SGL_LOCALE_HPP */
@@ -0,0 +1,218 @@
+/**
+ * @file sgl/localized.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains the localized items sgl::LocalizedText and sgl::LocalizedEnum, whose texts
+ * come from a sgl::Locale, and their factory functions.
+ *
+ * @version 0.1
+ * @date 2023-03-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_LOCALIZED_HPP
+#define SGL_LOCALIZED_HPP
+#include "sgl/item_base.hpp"
+#include "sgl/locale.hpp"
+#include "sgl/smallest_type.hpp"
+
+namespace sgl {
+  /**
+    @ingroup item_types
+    @headerfile localized.hpp "sgl/localized.hpp"
+
+    This class implements an item which shows one string of a sgl::Locale, e.g. a label or the
+    text of a button. The item only stores the id of its string. Its text is rendered when the menu
+    is constructed, and again after a language switch when its page is entered or refreshed, see
+    Menu::refresh().
+
+    @tparam TextSize number of characters per line in the menu, at least the length of the longest
+    translation
+    @tparam CharT character type of the item
+   */
+  template <size_t TextSize, typename CharT>
+  class LocalizedText : public sgl::ItemBase<LocalizedText<TextSize, CharT>> {
+  public:
+    /// base class of this item
+    using Base = sgl::ItemBase<LocalizedText<TextSize, CharT>>;
+
+    /// string_view type used by this item
+    using StringView = typename Base::StringView;
+
+    /**
+      construct a localized text.
+      @tparam Id enumeration or integral type
+      @param locale locale, must outlive the item
+      @param id string id
+     */
+    template <typename Id>
+    constexpr LocalizedText(const sgl::Locale<CharT>& locale, Id id) noexcept;
+
+    /// @return string id
+    [[nodiscard]] constexpr size_t id() const noexcept;
+
+    /**
+      show another string of the locale.
+      @tparam Id enumeration or integral type
+      @param id string id
+     */
+    template <typename Id>
+    constexpr void set_id(Id id) noexcept;
+
+    /// render the text again if the language was switched since it was last rendered.
+    constexpr void refresh() noexcept;
+
+    /// renders the initial text. Called by the menu, see ItemBase::set_menu().
+    template <typename Menu>
+    constexpr void set_menu(Menu* menu) noexcept;
+
+  private:
+    constexpr void render() noexcept;
+
+    const sgl::Locale<CharT>* locale_;          ///< locale of the text
+    size_t                    id_;              ///< string id
+    uint32_t                  generation_{0};   ///< locale generation of the text
+    bool                      rendered_{false}; ///< true once the text was rendered
+  };
+
+  /**
+    @ingroup item_types
+    @headerfile localized.hpp "sgl/localized.hpp"
+
+    This class implements an enumerated item like sgl::Enum, whose enumerator strings come from a
+    sgl::Locale instead of a sgl::EnumMap. The strings of the enumerators are the consecutive ids
+    first_id to first_id + NumEnumerators - 1, so the item stores only the values, the first id and
+    the current index. A boolean item can be made with T = bool and the values {false, true}.
+
+    Like sgl::Enum, an input of up/right selects the next value and down/left the previous one.
+
+    @tparam T value type
+    @tparam NumEnumerators number of values
+    @tparam TextSize number of characters per line in the menu, at least the length of the longest
+    translation
+    @tparam CharT character type of the item
+   */
+  template <typename T, size_t NumEnumerators, size_t TextSize, typename CharT>
+  class LocalizedEnum : public sgl::ItemBase<LocalizedEnum<T, NumEnumerators, TextSize, CharT>> {
+  public:
+    static_assert(NumEnumerators > 0, "a LocalizedEnum needs at least one value");
+
+    /// value type of this item
+    using value_type = T;
+
+    /// base class of this item
+    using Base = sgl::ItemBase<LocalizedEnum<T, NumEnumerators, TextSize, CharT>>;
+
+    /// string_view type used by this item
+    using StringView = typename Base::StringView;
+
+    /**
+      construct a localized enum.
+      @tparam Id enumeration or integral type
+      @param locale locale, must outlive the item
+      @param values enumerated values
+      @param first_id string id of values[0]
+      @param start_index index of the initial value
+     */
+    template <typename Id>
+    constexpr LocalizedEnum(const sgl::Locale<CharT>& locale,
+                            const T (&values)[NumEnumerators],
+                            Id     first_id,
+                            size_t start_index = 0) noexcept;
+
+    /// @return number of enumerated values
+    [[nodiscard]] constexpr size_t num_values() const noexcept;
+
+    /// @return index of the current value
+    [[nodiscard]] constexpr size_t index() const noexcept;
+
+    /**
+      set the current value by index and render its string.
+      @param index zero based index, taken modulo NumEnumerators
+     */
+    constexpr void set_index(size_t index) noexcept;
+
+    /// @return current value
+    [[nodiscard]] constexpr T get_value() const noexcept;
+
+    /**
+      set the current value and render its string.
+      @param value value to set
+      @return sgl::error::invalid_value if value is not one of the enumerated values
+     */
+    [[nodiscard]] constexpr sgl::error set_value(T value) noexcept;
+
+    /**
+      get the string of the i-th value in the current language.
+      @param i index
+      @return StringView
+     */
+    [[nodiscard]] constexpr StringView string(size_t i) const noexcept;
+
+    /// @return string of the current value in the current language
+    [[nodiscard]] constexpr StringView current_string() const noexcept;
+
+    /// render the text again if the language was switched since it was last rendered.
+    constexpr void refresh() noexcept;
+
+    /// renders the initial text. Called by the menu, see ItemBase::set_menu().
+    template <typename Menu>
+    constexpr void set_menu(Menu* menu) noexcept;
+
+  private:
+    constexpr void render() noexcept;
+
+    constexpr static sgl::error default_handle_input(LocalizedEnum& item,
+                                                     sgl::input     input) noexcept;
+
+    const sgl::Locale<CharT>*            locale_;                   ///< locale of the strings
+    T                                    values_[NumEnumerators]{}; ///< enumerated values
+    size_t                               first_id_;                 ///< string id of values_[0]
+    sgl::smallest_type_t<NumEnumerators> index_{0};                 ///< index of current value
+    uint32_t                             generation_{0};            ///< locale generation of text
+    bool                                 rendered_{false};          ///< true once text rendered
+  };
+
+  /// @ingroup item_factories
+  /// @addtogroup localized_factories
+  /// @{
+
+  /**
+    create a localized text.
+    @tparam TextSize text size of the item
+    @tparam CharT character type
+    @tparam Id enumeration or integral type
+    @param locale locale, must outlive the item
+    @param id string id
+    @return LocalizedText<TextSize, CharT>
+   */
+  template <size_t TextSize, typename CharT, typename Id>
+  constexpr LocalizedText<TextSize, CharT> localized_text(const sgl::Locale<CharT>& locale,
+                                                          Id                        id) noexcept;
+
+  /**
+    create a localized enum.
+    @tparam TextSize text size of the item
+    @tparam T value type
+    @tparam NumEnumerators number of values
+    @tparam CharT character type
+    @tparam Id enumeration or integral type
+    @param locale locale, must outlive the item
+    @param values enumerated values
+    @param first_id string id of values[0]
+    @param start_index index of the initial value
+    @return LocalizedEnum<T, NumEnumerators, TextSize, CharT>
+   */
+  template <size_t TextSize, typename T, size_t NumEnumerators, typename CharT, typename Id>
+  constexpr LocalizedEnum<T, NumEnumerators, TextSize, CharT>
+      localized_enum(const sgl::Locale<CharT>& locale,
+                     const T (&values)[NumEnumerators],
+                     Id     first_id,
+                     size_t start_index = 0) noexcept;
+  /// @}
+} // namespace sgl
+
+#include "sgl/impl/localized_impl.hpp"
+#endif /* SGL_LOCALIZED_HPP */
@@ -14,14 +14,27 @@
  */
 #ifndef SGL_MENU_HPP
 #define SGL_MENU_HPP
+#include "sgl/action_queue.hpp"
 #include "sgl/callable.hpp"
+#include "sgl/config.h"
 #include "sgl/error.hpp"
 #include "sgl/input.hpp"
+#include "sgl/name_table.hpp"
 #include "sgl/named_tuple.hpp"
+#include "sgl/observer.hpp"
 #include "sgl/page.hpp"
+#include "sgl/path.hpp"
 #include "sgl/smallest_type.hpp"
 
 namespace sgl {
+  /// @cond
+  namespace detail {
+    template <typename... Pages>
+    constexpr size_t num_items(sgl::type_list<Pages...>) {
+      return (sgl::list_size_v<typename Pages::item_list> + ...);
+    }
+  } // namespace detail
+  /// @endcond
 
   /// @headerfile menu.hpp "sgl/menu.hpp"
 
@@ -116,10 +129,76 @@ namespace sgl {
       invoke tick() method for each item in the menu.
       @note Keep in mind that this function call can take a non negligible time to complete if you
       have a lot of tick handlers doing (maybe expensive) work, so don't call it in an IRQ!
+      Pending deferred actions are run first, unless the action queue is threaded, and then the
+      completion callbacks of all executed actions are called, see post().
+      If the menu is observed, every item tick is reported separately, see sgl::ObserverTraits.
       @see item_tick_handling
      */
     constexpr void tick() noexcept;
 
+    /**
+      refresh the items of the current page, i.e. render the text of localized items again after
+      a language switch, see sgl::Locale. The items of other pages are refreshed when their page
+      is entered, so only what is displayed is rendered.
+     */
+    constexpr void refresh() noexcept;
+
+    /**
+      tick items in round robin order until budget is spent.
+
+      The menu remembers the item after the last one ticked and continues there on the next call.
+      At least one item is ticked per call, even if budget is already spent after it, and no item is
+      ticked twice in one call. Every item is therefore ticked at least once every N calls, where N
+      is the total number of items in the menu, and the time spent per call is budget plus the
+      duration of the slowest tick handler.
+
+      Like tick(), pending deferred actions are run first, unless the action queue is threaded, and
+      their completion callbacks are called, see post(). The time they take counts against budget,
+      so a long action leaves less time for the items, but at least one item is still ticked.
+
+      ```cpp
+      // in a 1 ms task
+      menu.tick_for(std::chrono::microseconds(200), [] { return std::chrono::steady_clock::now(); });
+      ```
+
+      @tparam Duration type of budget
+      @tparam Clock callable type
+      @param budget time available for ticking
+      @param clock callable which returns the current time. The difference of two return values
+      must be comparable with budget.
+      @return number of items ticked
+     */
+    template <typename Duration, typename Clock>
+    constexpr size_t tick_for(Duration budget, Clock&& clock);
+
+    /// deferred action queue type, see sgl::ActionQueue
+    using ActionQueue_t = sgl::ActionQueue<SGL_ACTION_QUEUE_SIZE>;
+
+    /**
+      post an action to the menu's action queue. The action is executed by the next call to tick()
+      or tick_for(), or by a worker thread if the queue is threaded. The completion callback is
+      called by tick() or tick_for() after the action was executed. The queue is disabled unless
+      SGL_ACTION_QUEUE_SIZE is defined, see sgl::ActionQueue.
+      @tparam F action type, see ActionQueue::post()
+      @tparam C completion type, see ActionQueue::post()
+      @param action action to execute
+      @param completion callback which receives the result of the action
+      @return sgl::error::no_error in case of success
+      @return sgl::error::queue_full if the queue is full or disabled
+     */
+    template <typename F, typename C = typename ActionQueue_t::Completion>
+    sgl::error post(F&& action, C&& completion = {}) noexcept;
+
+    /**
+      get the menu's action queue, e.g. to run it from a worker thread.
+      @return reference to the action queue
+      @{
+     */
+    [[nodiscard]] constexpr ActionQueue_t& actions() noexcept { return actions_; }
+
+    [[nodiscard]] constexpr const ActionQueue_t& actions() const noexcept { return actions_; }
+    /// @}
+
     /**
       get the index of the currently active page
       @return size_t
@@ -147,6 +226,87 @@ namespace sgl {
     template <char... Cs>
     [[nodiscard]] constexpr sgl::error set_current_page(sgl::Name<Cs...> name) noexcept;
 
+    /**
+      set current page by name, with the name given at runtime.
+      @param name name of the page
+      @return sgl::error::page_not_found if no page is called name
+      @return sgl::error otherwise, see set_current_page(size_t)
+     */
+    [[nodiscard]] constexpr sgl::error set_current_page(sgl::string_view<char> name) noexcept;
+
+    /**
+      get the index of the page called name in constant time, see sgl::NameTable.
+      @param name page name
+      @return index of the page, or size() if no page is called name
+     */
+    [[nodiscard]] static constexpr size_t find_page(sgl::string_view<char> name) noexcept;
+
+    /**
+      apply f on the page called name. Like find_page(), the page is looked up in constant time.
+      f must be callable with every page type of the menu, i.e. a generic lambda.
+
+      ```cpp
+      // runtime lookup of "settings/contrast"
+      auto ec = menu.visit_page(page_name, [item_name](auto& page) {
+        return page.visit_item(item_name, [](auto& item) { ... });
+      });
+      ```
+
+      @tparam F functor type
+      @param name page name
+      @param f functor instance
+      @return sgl::error::page_not_found if no page is called name
+      @return f(page) if f returns an sgl::error, else sgl::error::no_error
+      @{
+     */
+    template <typename F>
+    constexpr sgl::error visit_page(sgl::string_view<char> name, F&& f);
+
+    template <typename F>
+    constexpr sgl::error visit_page(sgl::string_view<char> name, F&& f) const;
+    /// @}
+
+    /**
+      set the value of the item at path from a string. The page and item are looked up in constant
+      time, the value is parsed according to the item type, see sgl::PathTraits, and the item's
+      text is updated by its formatter.
+
+      ```cpp
+      auto ec = menu.set("settings/contrast"_sv, "42"_sv);
+      ```
+
+      @param path path of the form "page/item"
+      @param value value as string
+      @return sgl::error::no_error in case of success
+      @return sgl::error::invalid_input if path contains no '/'
+      @return sgl::error::page_not_found if the page does not exist
+      @return sgl::error::item_not_found if the item does not exist
+      @return sgl::error::not_editable if the item can't be set from a string
+      @return the error of parsing or setting the value otherwise
+     */
+    [[nodiscard]] sgl::error set(sgl::string_view<char>      path,
+                                 sgl::string_view<char_type> value) noexcept;
+
+    /**
+      batched form of set(). Every assignment is applied in order and its result is stored in its
+      ec member, a failed assignment does not stop the remaining ones.
+      @param assignments array of assignments
+      @param count number of assignments
+      @return number of failed assignments
+     */
+    size_t set(sgl::PathAssignment<char_type>* assignments, size_t count) noexcept;
+
+    /**
+      copy the text of the item at path into buffer. No null terminator is appended.
+      @param path path of the form "page/item"
+      @param buffer buffer to write into
+      @param len size of buffer
+      @return sgl::format_result with the number of characters written. The error codes are the
+      same as for set(), and sgl::error::buffer_too_small if the text does not fit into buffer.
+     */
+    [[nodiscard]] constexpr sgl::format_result
+        get(sgl::string_view<char> path, char_type* buffer, size_t len) const noexcept;
+
     /**
       get page by name
       @tparam Name name type
@@ -272,25 +432,34 @@ namespace sgl {
     /** @} */
 
   private:
+    template <typename>
+    friend class sgl::MenuState;
+
     [[nodiscard]] constexpr static sgl::error default_handle_input(Menu& menu,
                                                                    input input) noexcept;
 
-    template <size_t I, typename F>
-    constexpr decltype(auto) for_current_page_impl(F&& f);
-
-    template <size_t I, typename F>
-    constexpr decltype(auto) for_current_page_impl(F&& f) const;
-
-    template <size_t I>
-    [[nodiscard]] constexpr sgl::string_view<char> page_name_impl() const noexcept;
+    /// event of kind for the current page, see sgl::ObserverTraits.
+    [[nodiscard]] constexpr sgl::Event current_page_event(sgl::event_kind kind) const noexcept;
 
     [[nodiscard]] constexpr sgl::string_view<char> item_name_impl(size_t i) const noexcept;
 
     [[nodiscard]] constexpr sgl::string_view<char_type> item_text_impl(size_t i) const noexcept;
 
+    /// total number of items of all pages
+    static constexpr size_t num_items = sgl::detail::num_items(PageList{});
+
+    /// run pending deferred actions, unless the queue is threaded, and complete them.
+    constexpr void drain_actions() noexcept;
+
+    /// tick the item at the tick cursor and advance the cursor.
+    constexpr void tick_next() noexcept;
+
     PageTuple      pages_;                                      /// < pages owned by this menu
     InputHandler_t input_handler_{&default_handle_input};       /// < menu input handler
     sgl::smallest_type_t<sgl::list_size_v<PageList>> index_{0}; /// < index of current page
+    sgl::smallest_type_t<sgl::list_size_v<PageList>> tick_page_{0}; /// < page of tick_for() cursor
+    sgl::smallest_type_t<num_items>                  tick_item_{0}; /// < item of tick_for() cursor
+    ActionQueue_t                                    actions_{};    /// < deferred actions
   };
 
   /**
@@ -0,0 +1,151 @@
+/**
+ * @file sgl/menu_state.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::MenuState, the small per instance state of a menu, which allows many
+ * sessions to share one menu object.
+ *
+ * @version 0.1
+ * @date 2023-02-11
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_MENU_STATE_HPP
+#define SGL_MENU_STATE_HPP
+#include "sgl/array.hpp"
+#include "sgl/error.hpp"
+#include "sgl/fwd.hpp"
+#include "sgl/menu.hpp"
+#include "sgl/serialize.hpp"
+#include "sgl/smallest_type.hpp"
+
+#include <cstdint>
+
+namespace sgl {
+  /// @cond
+  namespace menu_state_impl {
+    /// true if the text of Item is part of a MenuState, i.e. if Item has no serialized value
+    template <typename Item>
+    inline constexpr bool stores_text_v = sgl::SerializeTraits<Item>::size == 0;
+
+    template <typename... Items>
+    constexpr size_t num_texts(sgl::type_list<Items...>) noexcept {
+      return ((stores_text_v<Items> ? 1 : 0) + ... + 0);
+    }
+
+    template <typename... Items>
+    constexpr size_t texts_size(sgl::type_list<Items...>) noexcept {
+      return ((stores_text_v<Items> ? Items::text_size : 0) + ... + 0);
+    }
+
+    /// number and total capacity of the stored texts of a menu
+    template <typename PageList>
+    struct texts;
+
+    template <typename... Pages>
+    struct texts<sgl::type_list<Pages...>> {
+      static constexpr size_t count = (num_texts(typename Pages::item_list{}) + ... + 0);
+      static constexpr size_t size = (texts_size(typename Pages::item_list{}) + ... + 0);
+    };
+  } // namespace menu_state_impl
+  /// @endcond
+
+  /// @headerfile menu_state.hpp "sgl/menu_state.hpp"
+
+  /**
+    @brief The mutable state of a menu, separated from the menu itself.
+
+    A menu object contains a lot of data which is the same for every user of the menu: the item
+    names, the enum maps, the formatters and the input handlers. Copying a menu copies all of it
+    and calls set_menu() on every page. If many instances of the same menu are needed, e.g. one per
+    connected client or per display, it is much cheaper to keep a single working menu and a
+    MenuState per instance, and swap the states in and out with save() and load().
+
+    A MenuState contains
+    - the index of the current page,
+    - the index of the current item and the edit mode flag of every page,
+    - the values of all items, encoded the same way as a snapshot of sgl::serialize() minus the
+      schema hash,
+    - the texts of all items without a value, e.g. buttons, page links and custom items, so that a
+      label changed at runtime by one instance is not seen by the others.
+
+    It is trivially copyable and its size is known at compile time, so creating or copying a state
+    is a plain memory copy. The texts take up text_size characters per item without a value.
+
+    ```cpp
+    sgl::MenuState<decltype(menu)> a(menu), b(menu);
+    ...
+    b.load(menu);           // switch to instance b
+    menu.handle_input(...);
+    b.save(menu);           // store the changes of instance b
+    a.load(menu);           // switch back to instance a
+    ```
+
+    @note Only the state listed above is stored. The text of an item with a value is formatted
+    from the value, so text set explicitly with set_text() on such an item is shared by all
+    instances.
+
+    @tparam Menu sgl::Menu type
+   */
+  template <typename Menu>
+  class MenuState {
+  public:
+    /// number of pages of Menu
+    static constexpr size_t num_pages = sgl::list_size_v<typename Menu::page_list>;
+
+    /// number of bytes the item values take up
+    static constexpr size_t values_size = sgl::serialize_impl::menu_schema<Menu>::payload_size;
+
+    /// number of items without a value, whose text is stored instead
+    static constexpr size_t num_texts = menu_state_impl::texts<typename Menu::page_list>::count;
+
+    /// number of characters the stored texts take up
+    static constexpr size_t texts_size = menu_state_impl::texts<typename Menu::page_list>::size;
+
+    /**
+      create a state from the current state of menu.
+      @param menu menu to take the state from
+     */
+    explicit MenuState(const Menu& menu) noexcept;
+
+    /**
+      store the current state of menu.
+      @param menu menu to take the state from
+     */
+    void save(const Menu& menu) noexcept;
+
+    /**
+      restore the state into menu. The current page and item are restored directly, i.e. neither the
+      on exit nor the on enter callbacks of the pages are called. Only items whose value differs
+      from the stored one are modified, so the texts of unchanged items are not formatted again.
+      Afterwards the restored current page is refreshed like by Menu::set_current_page(), so that
+      its localized items show the current language, see Menu::refresh().
+      @param menu menu to restore the state into
+      @return sgl::error::no_error in case of success
+      @return the error of the first item which rejected its value otherwise
+     */
+    sgl::error load(Menu& menu) const noexcept;
+
+    /// @return index of the current page stored in this state
+    [[nodiscard]] constexpr size_t current_page_index() const noexcept { return page_index_; }
+
+  private:
+    using page_index_type = sgl::smallest_type_t<num_pages>;
+    using item_index_type = uint16_t;
+    using char_type = typename Menu::char_type;
+    using text_size_type = sgl::smallest_type_t<texts_size>;
+
+    // the arrays have at least one element, sgl::Array<T, 0> is not supported.
+    page_index_type                                            page_index_{0};
+    sgl::Array<item_index_type, num_pages>                     item_index_{};
+    sgl::Array<bool, num_pages>                                edit_mode_{};
+    sgl::Array<uint8_t, values_size == 0 ? 1 : values_size>   values_{};
+    sgl::Array<char_type, texts_size == 0 ? 1 : texts_size>    texts_{};
+    sgl::Array<text_size_type, num_texts == 0 ? 1 : num_texts> text_sizes_{};
+  };
+} // namespace sgl
+
+#include "sgl/impl/menu_state_impl.hpp"
+#endif /* SGL_MENU_STATE_HPP */
@@ -7,7 +7,11 @@
 #define SGL_MENU_TESTER_HPP
 #include "sgl.hpp"
 
+#include <cstdint>
 #include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace sgl {
 
@@ -32,7 +36,7 @@ namespace sgl {
 
     InputPair<CharT> map[Size];
 
-    sgl::input get(sgl::string_view<CharT> string) {
+    sgl::input get(sgl::string_view<CharT> string) const {
       for (const auto& e : map) {
         if (string == e.string)
           return e.input;
@@ -41,6 +45,81 @@ namespace sgl {
     }
   };
 
+  /// input script of MenuTester::replay(), with all tokens already resolved to sgl::input values.
+  using ReplayScript = std::vector<sgl::input>;
+
+  /// format of the frames MenuTester::replay() records
+  enum class TraceFormat {
+    /**
+      one line with the page name, followed by one line per item. The current item is prefixed with
+      "--> ", or with "==> " in edit mode, the other items with four spaces. Frames are separated by
+      an empty line.
+     */
+    text,
+    /**
+      "SGLT" followed by one record per frame. A record consists of the page index, the current
+      item index, the edit mode (0 or 1) and the number of items as little endian uint32_t, followed
+      by the size of each item text as little endian uint32_t and its characters. Names are not
+      recorded, they are fixed for each page index.
+     */
+    binary
+  };
+
+  /// result of MenuTester::replay()
+  struct ReplayResult {
+    size_t inputs{0}; ///< number of inputs handled
+    size_t errors{0}; ///< number of inputs which did not return sgl::error::no_error
+    size_t frames{0}; ///< number of recorded frames
+  };
+
+  /// first difference between two text traces, see diff_traces() and MenuTester::compare()
+  struct TraceDiff {
+    bool        equal{true};         ///< true if the traces are equal
+    size_t      step{0};             ///< index of the first divergent frame, i.e. input
+    size_t      line{0};             ///< line in the frame, 0 is the page name, 1 the first item
+    bool        expected_end{false}; ///< true if the expected trace ended at step
+    bool        actual_end{false};   ///< true if the actual trace ended at step
+    std::string expected;            ///< divergent line of the expected trace
+    std::string actual;              ///< divergent line of the actual trace
+  };
+
+  /**
+    compare two text traces, see TraceFormat::text, line by line. Only the current line of each
+    trace is held in memory, so traces of any length can be compared.
+    @param expected expected trace, e.g. a golden file
+    @param actual actual trace
+    @return first difference, or a TraceDiff with equal set to true
+   */
+  inline TraceDiff diff_traces(std::istream& expected, std::istream& actual) {
+    TraceDiff diff;
+    while (true) {
+      diff.expected_end = not std::getline(expected, diff.expected);
+      diff.actual_end = not std::getline(actual, diff.actual);
+      if (diff.expected_end and diff.actual_end) {
+        diff.expected.clear();
+        diff.actual.clear();
+        return diff;
+      }
+      if (diff.expected_end or diff.actual_end or diff.expected != diff.actual) {
+        diff.equal = false;
+        if (diff.expected_end) {
+          diff.expected.clear();
+        }
+        if (diff.actual_end) {
+          diff.actual.clear();
+        }
+        return diff;
+      }
+      // frames are terminated by an empty line
+      if (diff.expected.empty()) {
+        ++diff.step;
+        diff.line = 0;
+      } else {
+        ++diff.line;
+      }
+    }
+  }
+
   /// This class provides an easy ways to test menus.
   /// @see menu_tester.cpp for a complete example on how to use this class.
   /// @tparam Menu menu type
@@ -104,16 +183,180 @@ namespace sgl {
           } else {
             std::cout << "    ";
           }
-          std::cout << name.to_view().data() << ": " << item.text().data() << std::endl;
+          std::cout << name.to_view().data() << ": " << item.text().data() << '\n';
           ++i;
         });
       });
-      std::cout << "---------------\n";
+      std::cout << "---------------" << std::endl;
+    }
+
+    /**
+      Resolve an input script to sgl::input values. Every line of the script is resolved like an
+      input to handle_input(): a line in the input map becomes its mapped input, an empty line
+      becomes sgl::input::enter, and any other line becomes one input per character. Each distinct
+      line is resolved once, no matter how often it is repeated in the script.
+      @param script input script, e.g. a std::ifstream
+      @return resolved script for replay()
+     */
+    ReplayScript load_script(std::istream& script) const {
+      ReplayScript                                  result;
+      std::unordered_map<std::string, ReplayScript> resolved;
+      std::string                                   line;
+      while (std::getline(script, line)) {
+        auto it = resolved.find(line);
+        if (it == resolved.end()) {
+          const auto inputs = resolve(sgl::string_view<char>(line.data(), line.size()));
+          it = resolved.emplace(line, inputs).first;
+        }
+        result.insert(result.end(), it->second.begin(), it->second.end());
+      }
+      return result;
+    }
+
+    /**
+      handle all inputs of script at full speed. If trace is not null, a frame of the current page
+      is recorded after each input. The trace is not flushed by this function. Unlike
+      handle_input(), inputs after a failed input are still handled.
+      @param script resolved script, see load_script()
+      @param trace stream which receives the frames, or nullptr to record nothing
+      @param format trace format
+      @return number of handled inputs, errors and recorded frames
+     */
+    ReplayResult replay(const ReplayScript& script,
+                        std::ostream*       trace = nullptr,
+                        TraceFormat         format = TraceFormat::text) {
+      ReplayResult result;
+      if (trace != nullptr and format == TraceFormat::binary) {
+        trace->write("SGLT", 4);
+      }
+      for (const auto i : script) {
+        if (menu_.handle_input(i) != sgl::error::no_error) {
+          ++result.errors;
+        }
+        ++result.inputs;
+        if (trace != nullptr) {
+          record(*trace, format);
+          ++result.frames;
+        }
+      }
+      return result;
+    }
+
+    /**
+      replay script and compare the frame after each input with a golden trace, which was recorded
+      with replay() in TraceFormat::text. Frames are compared as they are produced, so neither the
+      session nor the golden trace is held in memory. Comparison stops at the first difference.
+      @param script resolved script, see load_script()
+      @param golden expected trace
+      @return first difference, or a TraceDiff with equal set to true
+     */
+    TraceDiff compare(const ReplayScript& script, std::istream& golden) {
+      TraceDiff diff;
+      for (const auto i : script) {
+        static_cast<void>(menu_.handle_input(i));
+        frame_.clear();
+        render_text(frame_);
+        // compare the frame line by line, including the terminating empty line
+        size_t begin = 0;
+        for (diff.line = 0; begin < frame_.size(); ++diff.line) {
+          const size_t end = frame_.find('\n', begin);
+          if (not std::getline(golden, diff.expected)) {
+            diff.equal = false;
+            diff.expected_end = true;
+            diff.expected.clear();
+            diff.actual.assign(frame_, begin, end - begin);
+            return diff;
+          }
+          if (frame_.compare(begin, end - begin, diff.expected) != 0) {
+            diff.equal = false;
+            diff.actual.assign(frame_, begin, end - begin);
+            return diff;
+          }
+          begin = end + 1;
+        }
+        ++diff.step;
+      }
+      diff.line = 0;
+      if (std::getline(golden, diff.expected)) {
+        diff.equal = false;
+        diff.actual_end = true;
+        return diff;
+      }
+      diff.expected.clear();
+      return diff;
     }
 
+    /// @return the tested menu
+    const Menu& menu() const noexcept { return menu_; }
+
   private:
-    Menu              menu_;
+    ReplayScript resolve(sgl::string_view<char> input) const {
+      sgl::input i = map.get(input);
+      if (i != sgl::input::none) {
+        return {i};
+      }
+      if (input.size() == 0) {
+        return {sgl::input::enter};
+      }
+      ReplayScript result;
+      for (size_t k = 0; k < input.size(); ++k) {
+        result.push_back(sgl::to_input(input[k]));
+      }
+      return result;
+    }
+
+    static void write_u32(std::ostream& out, size_t value) {
+      const char bytes[4] = {static_cast<char>(value & 0xFF),
+                             static_cast<char>((value >> 8) & 0xFF),
+                             static_cast<char>((value >> 16) & 0xFF),
+                             static_cast<char>((value >> 24) & 0xFF)};
+      out.write(bytes, 4);
+    }
+
+    void record(std::ostream& out, TraceFormat format) {
+      if (format == TraceFormat::text) {
+        frame_.clear();
+        render_text(frame_);
+        out.write(frame_.data(), static_cast<std::streamsize>(frame_.size()));
+        return;
+      }
+      menu_.for_current_page([this, &out](const auto& page) {
+        write_u32(out, menu_.current_page_index());
+        write_u32(out, page.current_item_index());
+        write_u32(out, page.is_in_edit_mode() ? 1 : 0);
+        write_u32(out, page.size());
+        for (size_t i = 0; i < page.size(); ++i) {
+          const auto text = page.item_text(i);
+          write_u32(out, text.size());
+          out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+      });
+    }
+
+    // appends the current frame in TraceFormat::text to out
+    void render_text(std::string& out) const {
+      const auto name = menu_.page_name();
+      out.append(name.data(), name.size());
+      out.push_back('\n');
+      menu_.for_current_page([&out](const auto& page) {
+        const size_t current = page.current_item_index();
+        const bool   edit = page.is_in_edit_mode();
+        for (size_t i = 0; i < page.size(); ++i) {
+          const auto item_name = page.item_name(i);
+          const auto text = page.item_text(i);
+          out.append(i != current ? "    " : (edit ? "==> " : "--> "), 4);
+          out.append(item_name.data(), item_name.size());
+          out.append(": ", 2);
+          out.append(text.data(), text.size());
+          out.push_back('\n');
+        }
+      });
+      out.push_back('\n');
+    }
+
+    Menu                 menu_;
     InputMap<char, Size> map;
+    std::string          frame_; // reused buffer of the current text frame
   };
 } // namespace sgl
 #endif /* SGL_MENU_TESTER_HPP */
@@ -0,0 +1,120 @@
+/**
+ * @file sgl/name_table.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::NameTable, a compile time perfect hash table which maps the names of a
+ * type list of sgl::Name types to their index.
+ *
+ * @version 0.1
+ * @date 2023-01-28
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_NAME_TABLE_HPP
+#define SGL_NAME_TABLE_HPP
+#include "sgl/array.hpp"
+#include "sgl/error.hpp"
+#include "sgl/smallest_type.hpp"
+#include "sgl/string_view.hpp"
+#include "sgl/type_list.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace sgl {
+
+  /// @cond
+  namespace name_table_impl {
+    /// size of the slot table for N names
+    constexpr size_t table_size(size_t n) noexcept {
+      size_t m = 1;
+      while (m < n + n / 2 + 1) {
+        m <<= 1;
+      }
+      return m;
+    }
+
+    /// number of buckets for N names
+    constexpr size_t bucket_count(size_t n) noexcept { return n / 2 + 1; }
+
+    template <size_t N>
+    struct Table {
+      static constexpr size_t num_slots = table_size(N);
+      static constexpr size_t num_buckets = bucket_count(N);
+      static constexpr size_t empty = N;
+
+      sgl::Array<uint16_t, num_buckets>                   displacement{};
+      sgl::Array<sgl::smallest_type_t<N + 1>, num_slots> slots{};
+      bool                                                ok{false};
+    };
+
+    template <size_t N>
+    constexpr Table<N> build(const sgl::string_view<char> (&names)[N]) noexcept;
+  } // namespace name_table_impl
+  /// @endcond
+
+  /// @headerfile name_table.hpp "sgl/name_table.hpp"
+
+  /**
+    @brief Compile time perfect hash table of the names in NameList.
+
+    NameTable::find() maps a runtime string to the index of the name in NameList in constant time,
+    i.e. with one hash of the string and one string comparison. The table is built at compile time
+    with the hash and displace method: the names are distributed into buckets, and for each bucket
+    a displacement is searched which maps all names of the bucket to free slots.
+
+    ```cpp
+    constexpr auto a = NAME("a");
+    constexpr auto b = NAME("b");
+    using Table = sgl::NameTable<sgl::type_list<decltype(a), decltype(b)>>;
+    static_assert(Table::find("b"_sv) == 1);
+    static_assert(Table::find("c"_sv) == Table::npos);
+    ```
+
+    @tparam NameList sgl::type_list of sgl::Name types
+   */
+  template <typename NameList>
+  class NameTable;
+
+  template <typename... Names>
+  class NameTable<sgl::type_list<Names...>> {
+  public:
+    static_assert(sizeof...(Names) > 0, "sgl::NameTable needs at least one name");
+    static_assert(sizeof...(Names) < 0xFFFF, "sgl::NameTable supports up to 65534 names");
+
+    /// number of names in the table
+    static constexpr size_t size = sizeof...(Names);
+
+    /// returned by find() if the name is not in the table
+    static constexpr size_t npos = size;
+
+    /**
+      get the index of name.
+      @param name name to look up
+      @return index of name in NameList, or npos if name is not in NameList
+     */
+    [[nodiscard]] static constexpr size_t find(sgl::string_view<char> name) noexcept;
+
+    /**
+      get the name at index i.
+      @param i index, must be smaller than size
+      @return i-th name of NameList
+     */
+    [[nodiscard]] static constexpr sgl::string_view<char> name(size_t i) noexcept {
+      return names_[i];
+    }
+
+  private:
+    static constexpr sgl::string_view<char> names_[size] = {Names{}.to_view()...};
+
+    static constexpr name_table_impl::Table<size> table_ = name_table_impl::build(names_);
+
+    static_assert(table_.ok, "sgl::NameTable: no perfect hash found for these names");
+  };
+
+} // namespace sgl
+
+#include "sgl/impl/name_table_impl.hpp"
+#endif /* SGL_NAME_TABLE_HPP */
@@ -21,6 +21,15 @@
 #include "sgl/type_list.hpp"
 
 namespace sgl {
+  /// @cond
+  namespace tuple_detail {
+    template <typename Name, typename T>
+    std::true_type has_name(const NamedValue<Name, T>*) noexcept;
+
+    template <typename Name>
+    std::false_type has_name(const void*) noexcept;
+  } // namespace tuple_detail
+  /// @endcond
 
   /// @headerfile named_tuple.hpp "sgl/named_tuple.hpp"
 
@@ -278,6 +287,11 @@ namespace sgl {
 
   private:
     using This_t = NamedTuple<type_list<Names...>, type_list<Ts...>>;
+
+    /// true if Name is one of Names
+    template <typename Name>
+    static constexpr bool has_name =
+        decltype(tuple_detail::has_name<Name>(static_cast<const This_t*>(nullptr)))::value;
   };
 
   /// @cond
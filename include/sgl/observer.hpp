@@ -0,0 +1,105 @@
+/**
+ * @file sgl/observer.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::ObserverTraits, the compile time hook through which sgl::Menu reports
+ * the begin and end of input handling, ticks and page transitions.
+ *
+ * @version 0.1
+ * @date 2023-02-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_OBSERVER_HPP
+#define SGL_OBSERVER_HPP
+#include "sgl/string_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace sgl {
+
+  /// @headerfile observer.hpp "sgl/observer.hpp"
+
+  /// kind of an sgl::Event
+  enum class event_kind : uint8_t {
+    handle_input, ///< Menu::handle_input()
+    tick,         ///< Menu::tick()
+    on_enter,     ///< on enter callback of a page
+    on_exit,      ///< on exit callback of a page
+    item_tick     ///< tick of a single item during Menu::tick()
+  };
+
+  /**
+    Event passed to the begin and end functions of an observer. For events which do not refer to an
+    item, item is sgl::Event::npos and item_name is empty. Menu::tick() refers to no page either.
+   */
+  struct Event {
+    /// value of page and item if the event does not refer to one
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    sgl::event_kind        kind;      ///< what happened
+    size_t                 page;      ///< index of the page in the menu
+    size_t                 item;      ///< index of the item in the page
+    sgl::string_view<char> page_name; ///< name of the page
+    sgl::string_view<char> item_name; ///< name of the item
+  };
+
+  /**
+    Customization point which connects an observer to a menu type.
+
+    The primary template is disabled, in which case sgl::Menu contains no trace of the observer,
+    i.e. there is no runtime or size overhead. To observe a menu, specialize this struct for the menu
+    type before the first call to Menu::handle_input(), Menu::tick() or Menu::set_current_page():
+
+    ```cpp
+    template <>
+    struct sgl::ObserverTraits<MyMenu> {
+      static constexpr bool enabled = true;
+      static void begin(const sgl::Event& e) noexcept;
+      static void end(const sgl::Event& e) noexcept;
+    };
+    ```
+
+    Every begin() is followed by exactly one end() with the same event. Events nest, e.g. a page
+    link activated in Menu::handle_input() causes on exit and on enter events before the end of
+    the handle input event. See sgl::CycleHistogram for a ready made observer.
+
+    @tparam Menu sgl::Menu type
+   */
+  template <typename Menu>
+  struct ObserverTraits {
+    /// true if the menu is observed
+    static constexpr bool enabled = false;
+  };
+
+  /// @cond
+  namespace observer_impl {
+    /// calls f between the begin and end of the event returned by make_event, if Menu is
+    /// observed. Otherwise make_event is not called and this is just f().
+    template <typename Menu, typename MakeEvent, typename F>
+    constexpr decltype(auto) observe(MakeEvent&& make_event, F&& f) {
+      using Traits = sgl::ObserverTraits<Menu>;
+      if constexpr (!Traits::enabled) {
+        static_cast<void>(make_event);
+        return f();
+      } else if constexpr (std::is_void_v<decltype(f())>) {
+        const sgl::Event e = make_event();
+        Traits::begin(e);
+        f();
+        Traits::end(e);
+      } else {
+        const sgl::Event e = make_event();
+        Traits::begin(e);
+        auto result = f();
+        Traits::end(e);
+        return result;
+      }
+    }
+  } // namespace observer_impl
+  /// @endcond
+} // namespace sgl
+#endif /* SGL_OBSERVER_HPP */
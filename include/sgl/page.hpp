@@ -21,6 +21,7 @@
 #include "sgl/fwd.hpp"
 #include "sgl/input.hpp"
 #include "sgl/item_concepts.hpp"
+#include "sgl/name_table.hpp"
 #include "sgl/named_tuple.hpp"
 #include "sgl/smallest_type.hpp"
 #include "sgl/static_string.hpp"
@@ -119,6 +120,12 @@ namespace sgl {
     // the character type of the items
     using char_type = typename sgl::first_t<ItemList>::char_type;
 
+    /// type list of item names
+    using name_list = NameList;
+
+    /// type list of item types
+    using item_list = ItemList;
+
     /**
       Concrete input handler type. A page input handler is a callable with a call signature
       equal to sgl::error(Page&, sgl::input).[See here](markdown/concepts.md#input-handler) for
@@ -345,9 +352,48 @@ namespace sgl {
     template <char... Cs>
     constexpr const auto& operator[](sgl::Name<Cs...> name) const noexcept;
 
+    /**
+      get the index of the item called name in constant time, see sgl::NameTable.
+      @param name item name
+      @return index of the item, or size() if no item is called name
+     */
+    [[nodiscard]] static constexpr size_t find_item(sgl::string_view<char> name) noexcept;
+
+    /**
+      apply f on the item called name. Like find_item(), the item is looked up in constant time.
+      f must be callable with every item type of the page, i.e. a generic lambda.
+
+      ```cpp
+      auto ec = page.visit_item(name, [](auto& item) { return item.set_text(...); });
+      ```
+
+      @tparam F functor type
+      @param name item name
+      @param f functor instance
+      @return sgl::error::item_not_found if no item is called name
+      @return f(item) if f returns an sgl::error, else sgl::error::no_error
+      @{
+     */
+    template <typename F>
+    constexpr sgl::error visit_item(sgl::string_view<char> name, F&& f);
+
+    template <typename F>
+    constexpr sgl::error visit_item(sgl::string_view<char> name, F&& f) const;
+    /// @}
+
     /// invoke the tick handler of every item contained
     constexpr void tick() noexcept;
 
+    /// call refresh() on every item which has such a method, e.g. sgl::LocalizedText.
+    constexpr void refresh() noexcept;
+
+    /**
+      invoke the tick handler of the i-th item only. The item is selected through a jump table,
+      i.e. in constant time.
+      @param i item index, must be smaller than size()
+     */
+    constexpr void tick_item(size_t i) noexcept;
+
     /**
       get the name of the i-th item as a string_view. Returns an empty string_view if i is
       out of range.
@@ -376,18 +422,6 @@ namespace sgl {
     // default page action, does nothing
     [[nodiscard]] constexpr static sgl::error default_page_action(Page& page) noexcept;
 
-    template <size_t I, typename F>
-    constexpr decltype(auto) for_current_item_impl(F&& f);
-
-    template <size_t I, typename F>
-    constexpr decltype(auto) for_current_item_impl(F&& f) const;
-
-    template <size_t I>
-    constexpr sgl::string_view<char> item_name_impl(size_t i) const noexcept;
-
-    template <size_t I>
-    constexpr sgl::string_view<char_type> item_text_impl(size_t i) const noexcept;
-
     ItemTuple      items_;                                ///< storage for the items
     InputHandler_t input_handler_{&default_handle_input}; ///< page input handler
     PageAction_t   on_enter_{&default_page_action}; ///< action to execute when page is entered
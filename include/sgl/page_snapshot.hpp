@@ -0,0 +1,157 @@
+/**
+ * @file sgl/page_snapshot.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::PageView, a self contained copy of everything needed to draw the current
+ * page of a menu, and sgl::PageSnapshot, which publishes it to a render thread without locking.
+ *
+ * @version 0.1
+ * @date 2023-02-18
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_PAGE_SNAPSHOT_HPP
+#define SGL_PAGE_SNAPSHOT_HPP
+#include "sgl/array.hpp"
+#include "sgl/fwd.hpp"
+#include "sgl/menu.hpp"
+#include "sgl/static_string.hpp"
+#include "sgl/string_view.hpp"
+#include "sgl/triple_buffer.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace sgl {
+
+  /// @cond
+  namespace page_snapshot_impl {
+    template <typename Page>
+    struct page_info;
+
+    template <typename NameList, typename... Items>
+    struct page_info<sgl::Page<NameList, sgl::type_list<Items...>>> {
+      static constexpr size_t num_items = sizeof...(Items);
+
+      static constexpr size_t text_size = std::max({Items::text_size...});
+    };
+
+    template <typename Menu>
+    struct menu_info;
+
+    template <typename NameList, typename... Pages>
+    struct menu_info<sgl::Menu<NameList, sgl::type_list<Pages...>>> {
+      static constexpr size_t max_items = std::max({page_info<Pages>::num_items...});
+
+      static constexpr size_t text_size = std::max({page_info<Pages>::text_size...});
+    };
+  } // namespace page_snapshot_impl
+  /// @endcond
+
+  /// @headerfile page_snapshot.hpp "sgl/page_snapshot.hpp"
+
+  /**
+    @brief Copy of the current page of a menu of type Menu.
+
+    A PageView does not reference any part of the menu it was taken from, the names point to static
+    storage and the texts are copied. It can therefore be read while the menu is modified by
+    another thread.
+
+    @tparam Menu sgl::Menu type
+   */
+  template <typename Menu>
+  struct PageView {
+    /// maximum number of items of a page of Menu
+    static constexpr size_t max_items = page_snapshot_impl::menu_info<Menu>::max_items;
+
+    /// largest text size of all items of Menu
+    static constexpr size_t text_size = page_snapshot_impl::menu_info<Menu>::text_size;
+
+    /// character type of Menu
+    using char_type = typename Menu::char_type;
+
+    /// text type
+    using String = sgl::static_string<char_type, text_size>;
+
+    sgl::string_view<char>                        page_name{};      ///< name of the page
+    size_t                                        page_index{0};    ///< index of the page
+    size_t                                        size{0};          ///< number of items
+    size_t                                        current_item{0};  ///< index of current item
+    bool                                          edit_mode{false}; ///< page is in edit mode
+    sgl::Array<sgl::string_view<char>, max_items> names{};          ///< item names
+    sgl::Array<String, max_items>                 texts{};          ///< item texts
+    uint32_t                                      sequence{0};      ///< publish count
+  };
+
+  /**
+    copy the current page of menu into view.
+    @param menu menu to copy from
+    @param view view to copy into
+   */
+  template <typename NameList, typename PageList>
+  void capture(const sgl::Menu<NameList, PageList>&          menu,
+               sgl::PageView<sgl::Menu<NameList, PageList>>& view) noexcept;
+
+  /**
+    @brief Publishes the current page of a menu from the thread which drives the menu to a render
+    thread, without locks.
+
+    The menu itself is not thread safe: Menu::tick() and Menu::handle_input() modify the item texts
+    while a renderer reads them. With a PageSnapshot, only the control thread accesses the menu. It
+    calls publish() after every update, which copies the current page into a
+    sgl::TripleBuffer. The render thread calls read() and draws the returned view. Both calls are
+    wait free, so a slow renderer never stalls the control loop, and a view is always a
+    consistent copy of the page at the time of a publish().
+
+    ```cpp
+    sgl::PageSnapshot<decltype(menu)> snapshot(menu);
+
+    // control thread
+    menu.handle_input(input);
+    menu.tick();
+    snapshot.publish(menu);
+
+    // render thread
+    const auto& view = snapshot.read();
+    for (size_t i = 0; i < view.size; ++i) {
+      draw(view.texts[i], i == view.current_item);
+    }
+    ```
+
+    @tparam Menu sgl::Menu type
+   */
+  template <typename Menu>
+  class PageSnapshot {
+  public:
+    /// view type
+    using View = sgl::PageView<Menu>;
+
+    /**
+      construct the snapshot and publish the current page of menu.
+      @param menu menu
+     */
+    explicit PageSnapshot(const Menu& menu) noexcept;
+
+    /**
+      copy the current page of menu and make it visible to the reader. Only call from one thread.
+      @param menu menu
+     */
+    void publish(const Menu& menu) noexcept;
+
+    /**
+      get the most recently published view. The reference stays valid and unchanged until the next
+      call to read(). Only call from one thread.
+      @return latest view
+     */
+    const View& read() noexcept;
+
+  private:
+    sgl::TripleBuffer<View> buffer_;
+    uint32_t                sequence_{0};
+  };
+} // namespace sgl
+
+#include "sgl/impl/page_snapshot_impl.hpp"
+#endif /* SGL_PAGE_SNAPSHOT_HPP */
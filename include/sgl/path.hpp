@@ -0,0 +1,97 @@
+/**
+ * @file sgl/path.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::PathTraits and sgl::PathAssignment, which are used by Menu::set() and
+ * Menu::get() to access items by a path of the form "page/item".
+ *
+ * @version 0.1
+ * @date 2023-02-04
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_PATH_HPP
+#define SGL_PATH_HPP
+#include "sgl/error.hpp"
+#include "sgl/format.hpp"
+#include "sgl/fwd.hpp"
+#include "sgl/string_view.hpp"
+
+namespace sgl {
+
+  /// @headerfile path.hpp "sgl/path.hpp"
+
+  /**
+    A single assignment for the batched form of Menu::set(). The path and value are inputs, ec is
+    set by Menu::set() to the result of the assignment.
+    @tparam CharT character type of the value
+   */
+  template <typename CharT>
+  struct PathAssignment {
+    sgl::string_view<char>  path;                    ///< "page/item"
+    sgl::string_view<CharT> value;                   ///< value as string
+    sgl::error              ec{sgl::error::no_error}; ///< result of the assignment
+  };
+
+  /**
+    Customization point which describes how an item's value is set from a string by Menu::set().
+
+    The primary template describes an item which can't be set by a string, i.e. Menu::set()
+    returns sgl::error::not_editable for it. sgl specializes this struct for sgl::Boolean,
+    sgl::Enum, sgl::LocalizedEnum and sgl::Numeric. To make a custom item settable, specialize this
+    struct as follows:
+
+    ```cpp
+    template <>
+    struct sgl::PathTraits<MyItem> {
+      static constexpr bool settable = true;
+      static sgl::error set(MyItem& item, sgl::string_view<MyItem::char_type> value) noexcept;
+    };
+    ```
+
+    @tparam Item item type
+   */
+  template <typename Item>
+  struct PathTraits {
+    /// true if the item can be set by a string
+    static constexpr bool settable = false;
+  };
+
+  /// @cond
+  namespace path_impl {
+    /// separator between page and item name
+    inline constexpr char separator = '/';
+
+    /// splits "page/item" into its two names. Returns false if path contains no separator.
+    constexpr bool split(sgl::string_view<char>  path,
+                         sgl::string_view<char>& page,
+                         sgl::string_view<char>& item) noexcept {
+      for (size_t i = 0; i < path.size(); ++i) {
+        if (path[i] == separator) {
+          page = sgl::string_view<char>(path.data(), i);
+          item = sgl::string_view<char>(path.data() + i + 1, path.size() - i - 1);
+          return true;
+        }
+      }
+      return false;
+    }
+
+    template <typename Item, typename CharT>
+    sgl::error set(Item& item, sgl::string_view<CharT> value) noexcept {
+      using Traits = sgl::PathTraits<std::decay_t<Item>>;
+      if constexpr (std::is_const_v<Item> or !Traits::settable) {
+        static_cast<void>(item);
+        static_cast<void>(value);
+        return sgl::error::not_editable;
+      } else {
+        return Traits::set(item, value);
+      }
+    }
+  } // namespace path_impl
+  /// @endcond
+} // namespace sgl
+
+#include "sgl/impl/path_impl.hpp"
+#endif /* SGL_PATH_HPP */
@@ -34,8 +34,8 @@ namespace sgl::qt {
     page_stack_->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Minimum);
     page_stack_->setFocusPolicy(Qt::NoFocus);
 
-    for (auto& page : menu.root()->children()) {
-      auto* p = new DisplayPage((AbstractPageNode*)page, num_lines);
+    for (auto& page : menu.root()->pages()) {
+      auto* p = new DisplayPage(&page, num_lines);
       p->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Minimum);
       pages_.push_back(p);
       page_stack_->addWidget(p);
@@ -59,12 +59,12 @@ namespace sgl::qt {
   int Display::content_height() const { return height() - border_thickness_; }
 
   void Display::update_display() {
-    setUpdatesEnabled(false);
-    page_stack_->setCurrentIndex(menu_.active_index().page_index);
-    for (auto p : pages_) {
-      p->update_page();
-    }
-    setUpdatesEnabled(true);
+    // Only the current page is visible, the other pages are brought up to date when they become
+    // the current page. Updates are not disabled here, because re-enabling them repaints the whole
+    // display, even if only one label changed.
+    const size_t page_index = menu_.active_index().page_index;
+    page_stack_->setCurrentIndex(static_cast<int>(page_index));
+    pages_[page_index]->update_page();
   }
 
   void Display::paintEvent(QPaintEvent*) {
@@ -9,7 +9,8 @@
 namespace sgl::qt {
   DisplayItem::DisplayItem(AbstractItemNode* item, QWidget* parent)
       : QWidget(parent), item_{item}, text_label_{new QLabel(QString(item_->text().data()))},
-        index_label_{new QLabel(QString::number(item_->index() + 1) + '.')} {
+        index_label_{new QLabel(QString::number(item_->index() + 1) + '.')},
+        text_{item_->text()} {
     this->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Maximum);
     text_label_->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Maximum);
     index_label_->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Maximum);
@@ -22,20 +23,39 @@ namespace sgl::qt {
     layout->addWidget(text_label_, 0, Qt::AlignLeft);
     layout->setAlignment(Qt::AlignCenter);
 
-    this->set_active(item_->is_current());
+    this->setAutoFillBackground(true);
+    text_label_->setAutoFillBackground(true);
+    index_label_->setAutoFillBackground(true);
+    this->set_active(item_->is_current(), item_->is_current() and item_->get_page()->edit_mode());
   }
 
-  void DisplayItem::update_item() {
-    text_label_->setText(item_->text().data());
-    set_active(item_->is_current());
+  bool DisplayItem::update_item() {
+    // setText() and setPalette() schedule a repaint and possibly a relayout even if nothing
+    // changed, so only call them for actual changes.
+    bool       changed = false;
+    const auto text = item_->text();
+    if (text != text_) {
+      text_.assign(text.data(), text.size());
+      text_label_->setText(QString::fromUtf8(text.data(), static_cast<int>(text.size())));
+      changed = true;
+    }
+    const bool active = item_->is_current();
+    const bool edit = active and item_->get_page()->edit_mode();
+    if (active != active_ or edit != edit_) {
+      set_active(active, edit);
+      changed = true;
+    }
+    return changed;
   }
 
-  void DisplayItem::set_active(bool active) {
-    this->setAutoFillBackground(true);
-    text_label_->setAutoFillBackground(true);
-    index_label_->setAutoFillBackground(true);
+  void DisplayItem::set_active(bool active, bool edit) {
+    active_ = active;
+    edit_ = edit;
     QPalette pal = text_label_->palette();
-    if (active) {
+    if (edit) {
+      pal.setColor(QPalette::Window, Qt::green);
+      pal.setColor(QPalette::WindowText, Qt::black);
+    } else if (active) {
       pal.setColor(QPalette::Window, Qt::white);
       pal.setColor(QPalette::WindowText, Qt::black);
     } else {
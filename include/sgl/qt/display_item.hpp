@@ -8,6 +8,7 @@
 #include "sgl/qt/menu_tree.hpp"
 
 #include <QLabel>
+#include <string>
 
 namespace sgl::qt {
   class SGL_API DisplayItem : public QWidget {
@@ -15,14 +16,18 @@ namespace sgl::qt {
   public:
     DisplayItem(AbstractItemNode* item, QWidget* parent = nullptr);
 
-    void                 update_item();
-    void                 set_active(bool active);
+    /// updates the text and highlighting, returns true if any of them changed
+    bool                 update_item();
+    void                 set_active(bool active, bool edit = false);
     [[nodiscard]] size_t index() const;
 
   private:
     AbstractItemNode* item_{nullptr};
     QLabel*           text_label_{nullptr};
     QLabel*           index_label_{nullptr};
+    std::string       text_{};        ///< text currently shown by text_label_
+    bool              active_{false}; ///< item is highlighted as current item
+    bool              edit_{false};   ///< item is highlighted as being edited
   };
 
 } // namespace sgl::qt
@@ -14,10 +14,17 @@ namespace sgl::qt {
     pal.setColor(QPalette::WindowText, Qt::white);
     this->setPalette(pal);
 
-    // fill items_ with DisplayItems
+    // fill items_ with DisplayItems. Every item is added to the layout once, and only the items
+    // in the visible window are shown. Hidden widgets don't take up space in the layout.
     items_.reserve(page_->size());
     for (size_t i = 0; i < page_->size(); ++i) {
-      auto* item = new DisplayItem((AbstractItemNode*)(page_->children()[i]), this);
+      auto* item = new DisplayItem(page_->item(i), this);
+      item_layout_->addWidget(item, 0, Qt::AlignLeft);
+      if (i < line_count_) {
+        item->show();
+      } else {
+        item->hide();
+      }
       items_.push_back(item);
     }
     item_layout_->setAlignment(Qt::AlignLeft | Qt::AlignVCenter);
@@ -47,45 +54,38 @@ namespace sgl::qt {
   //   return min_size;
   // }
 
-  void DisplayPage::update_page() {
-    // remove all items from layout, still store pointers to them in items_
-    auto* item = item_layout_->takeAt(0);
-    while (item != nullptr) {
-      item->widget()->hide();
-      item = item_layout_->takeAt(0);
+  size_t DisplayPage::update_page() {
+    // the window of visible items only moves when the current item would leave it, so moving the
+    // cursor within the window neither shows nor hides any widget and doesn't cause a relayout.
+    const size_t idx = page_->current_index();
+    size_t       first = first_;
+    if (idx < first) {
+      first = idx;
+    } else if (idx >= first + line_count_) {
+      first = idx + 1 - line_count_;
     }
 
-    const size_t idx = page_->current_index();
-    // add all new item to be displayed in the layout with wrap around
-    if ((idx + line_count_) > page_->size()) {
-      // add widgets at end of items_
-      for (size_t i = idx; i < page_->size(); ++i) {
-        item_layout_->addWidget(items_[i], 0, Qt::AlignLeft);
-        items_[i]->show();
-        items_[i]->update_item();
-        // add widgets at front of items_
-      }
-      const auto lower_bound = (idx + line_count_) % page_->size();
-      for (size_t i = 0; i < lower_bound; ++i) {
-        item_layout_->addWidget(items_[i], 0, Qt::AlignLeft);
-        items_[i]->show();
-        items_[i]->update_item();
-      }
-      // hide all other items
-      for (size_t i = lower_bound; i < idx; ++i) {
-        items_[i]->hide();
+    if (first != first_) {
+      for (size_t i = first_; i < first_ + line_count_; ++i) {
+        if (i < first or i >= first + line_count_) {
+          items_[i]->hide();
+        }
       }
-    } else {
-      for (size_t i = 0; i < page_->size(); ++i) {
-        if (i >= idx and i < idx + line_count_) {
+      for (size_t i = first; i < first + line_count_; ++i) {
+        if (i < first_ or i >= first_ + line_count_) {
           items_[i]->show();
-          items_[i]->update_item();
-          item_layout_->addWidget(items_[i], 0, Qt::AlignLeft);
-        } else {
-          items_[i]->hide();
         }
       }
+      first_ = first;
+    }
+
+    size_t changed = 0;
+    for (size_t i = first_; i < first_ + line_count_; ++i) {
+      if (items_[i]->update_item()) {
+        ++changed;
+      }
     }
+    return changed;
   }
 
   DisplayPage::~DisplayPage() {
@@ -16,7 +16,9 @@ namespace sgl::qt {
   public:
     DisplayPage(AbstractPageNode* page, size_t line_count = 4, QWidget* parent = nullptr);
 
-    void update_page();
+    /// updates the visible items and scrolls if the current item is not visible, returns the number
+    /// of items which changed
+    size_t update_page();
 
     ~DisplayPage();
     // QSize minimumSizeHint() const override;
@@ -26,6 +28,7 @@ namespace sgl::qt {
     AbstractPageNode*                  page_{nullptr};
     std::vector<sgl::qt::DisplayItem*> items_;
     size_t                             line_count_{4};
+    size_t                             first_{0}; ///< index of the first visible item
     QSize                              min_size_;
   };
 } // namespace sgl::qt
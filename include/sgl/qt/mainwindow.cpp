@@ -5,6 +5,8 @@
 #include "sgl/qt/mainwindow.hpp"
 
 #include <QKeyEvent>
+#include <QTimer>
+#include <algorithm>
 #include <iostream>
 
 namespace sgl::qt {
@@ -13,7 +15,8 @@ namespace sgl::qt {
   static void        update_content(sgl::qt::AbstractMenuNode* menu, QTreeWidget* tree);
   QTreeWidget*
       make_tree(sgl::qt::AbstractMenuNode* menu, const QString& title, QWidget* parent = nullptr);
-  static void update_item_leaves(sgl::qt::AbstractPageNode* page, QTreeWidgetItem* page_item);
+  static void update_page_row(sgl::qt::AbstractMenuNode* menu, size_t i, QTreeWidgetItem* row);
+  static void update_item_row(sgl::qt::AbstractPageNode* page, size_t i, QTreeWidgetItem* row);
 
   void MainWindow::keyPressEvent(QKeyEvent* event) {
     sgl::input input{sgl::input::none};
@@ -98,6 +101,10 @@ namespace sgl::qt {
     this->setFixedSize(800, 600);
     this->setFocusPolicy(Qt::StrongFocus);
 
+    // the side tree is filled once, afterwards only rows with notified changes are refreshed.
+    update_content(tree_.root(), side_tree_);
+    tree_.root()->set_observer(this);
+
     this->update_window();
     setUpdatesEnabled(true);
   }
@@ -113,7 +120,7 @@ namespace sgl::qt {
   }
 
   void MainWindow::set_current_item(size_t i) {
-    tree_.root()->current_page()->set_current_item(i);
+    tree_.root()->set_current_item(i);
     this->update_window();
   }
 
@@ -122,13 +129,51 @@ namespace sgl::qt {
     this->set_current_item(i.item_index);
   }
 
-  void MainWindow::update_window() {
-    this->setUpdatesEnabled(false);
-    side_tree_->setUpdatesEnabled(false);
-    disp_->update_display();
-    update_content(tree_.root(), side_tree_);
-    side_tree_->setUpdatesEnabled(true);
-    this->setUpdatesEnabled(true);
+  void MainWindow::update_window() { disp_->update_display(); }
+
+  void MainWindow::current_page_changed(size_t old_page, size_t new_page) {
+    mark_dirty(old_page, page_row);
+    mark_dirty(new_page, page_row);
+  }
+
+  void MainWindow::page_state_changed(size_t page, size_t old_item, size_t new_item) {
+    // the page row shows the edit mode, the item rows which item is current
+    mark_dirty(page, page_row);
+    mark_dirty(page, old_item);
+    mark_dirty(page, new_item);
+  }
+
+  void MainWindow::item_text_changed(size_t page, size_t item) { mark_dirty(page, item); }
+
+  void MainWindow::mark_dirty(size_t page, size_t item) {
+    const auto found = std::find_if(dirty_rows_.begin(), dirty_rows_.end(), [=](MenuIndex row) {
+      return row.page_index == page and row.item_index == item;
+    });
+    if (found == dirty_rows_.end()) {
+      dirty_rows_.push_back({page, item});
+    }
+    if (not flush_pending_) {
+      // all changes of the current event loop iteration, e.g. of several queued key repeats, are
+      // applied together.
+      flush_pending_ = true;
+      QTimer::singleShot(0, this, &MainWindow::flush_tree);
+    }
+  }
+
+  void MainWindow::flush_tree() {
+    flush_pending_ = false;
+    auto* menu = tree_.root();
+    for (const auto& row : dirty_rows_) {
+      auto* page_item = side_tree_->topLevelItem(static_cast<int>(row.page_index));
+      if (row.item_index == page_row) {
+        update_page_row(menu, row.page_index, page_item);
+      } else {
+        update_item_row(menu->page(row.page_index),
+                        row.item_index,
+                        page_item->child(static_cast<int>(row.item_index)));
+      }
+    }
+    dirty_rows_.clear();
   }
 
   void MainWindow::itemDoubleClicked(QTreeWidgetItem* item, int column) {
@@ -169,49 +214,51 @@ namespace sgl::qt {
     const size_t size = menu->size();
     for (size_t i = 0; i < size; ++i) {
       auto* page_item = tree->topLevelItem(i);
-      auto  back_brush = tree->palette().window();
-      if (menu->current_index() == i) {
-        if (((AbstractPageNode*)menu->children()[i])->edit_mode())
-          back_brush.setColor(Qt::green);
-        else
-          back_brush.setColor(Qt::blue);
-      } else {
-        back_brush.setColor(Qt::GlobalColor::transparent);
+      auto* page = menu->page(i);
+      update_page_row(menu, i, page_item);
+      for (size_t j = 0; j < page->size(); ++j) {
+        update_item_row(page, j, page_item->child(j));
       }
+    }
+  }
 
-      page_item->setBackground(0, back_brush);
-      update_item_leaves((AbstractPageNode*)menu->children()[i], page_item);
+  static void update_page_row(sgl::qt::AbstractMenuNode* menu, size_t i, QTreeWidgetItem* row) {
+    auto back_brush = row->treeWidget()->palette().window();
+    if (menu->current_index() == i) {
+      if (menu->page(i)->edit_mode())
+        back_brush.setColor(Qt::green);
+      else
+        back_brush.setColor(Qt::blue);
+    } else {
+      back_brush.setColor(Qt::GlobalColor::transparent);
     }
+    row->setBackground(0, back_brush);
   }
 
-  static void update_item_leaves(sgl::qt::AbstractPageNode* page, QTreeWidgetItem* page_item) {
-    const size_t size = page->size();
-    auto         back_brush = page_item->treeWidget()->palette().window();
-    for (size_t i = 0; i < size; ++i) {
-      auto* item = page_item->child(i);
-      if (page->current_index() == i) {
-        if (page->edit_mode())
-          back_brush.setColor(Qt::green);
-        else
-          back_brush.setColor(Qt::blue);
-      } else {
-        back_brush.setColor(Qt::transparent);
-      }
-      item->setBackground(0, back_brush);
-      item->child(1)->setText(0, "Content: " + QString(page->children()[i]->text().data()));
+  static void update_item_row(sgl::qt::AbstractPageNode* page, size_t i, QTreeWidgetItem* row) {
+    auto back_brush = row->treeWidget()->palette().window();
+    if (page->current_index() == i) {
+      if (page->edit_mode())
+        back_brush.setColor(Qt::green);
+      else
+        back_brush.setColor(Qt::blue);
+    } else {
+      back_brush.setColor(Qt::transparent);
     }
+    row->setBackground(0, back_brush);
+    row->child(1)->setText(0, "Content: " + QString(page->item(i)->text().data()));
   }
 
   QTreeWidget* make_tree(sgl::qt::AbstractMenuNode* menu, const QString& title, QWidget* parent) {
     QTreeWidget* widget = new QTreeWidget(parent);
     widget->setColumnCount(1);
 
-    for (const auto& page : menu->children()) {
-      auto* tree_page = new QTreeWidgetItem(widget, QStringList(QString(page->name().data())));
-      for (const auto& item : page->children()) {
-        auto* new_item = new QTreeWidgetItem(tree_page, QStringList(QString(item->name().data())));
-        new QTreeWidgetItem(new_item, QStringList("Type: " + QString(item->type_name().data())));
-        new QTreeWidgetItem(new_item, QStringList("Content: " + QString(item->text().data())));
+    for (const auto& page : menu->pages()) {
+      auto* tree_page = new QTreeWidgetItem(widget, QStringList(QString(page.name().data())));
+      for (const auto& item : page.items()) {
+        auto* new_item = new QTreeWidgetItem(tree_page, QStringList(QString(item.name().data())));
+        new QTreeWidgetItem(new_item, QStringList("Type: " + QString(item.type_name().data())));
+        new QTreeWidgetItem(new_item, QStringList("Content: " + QString(item.text().data())));
       }
     }
     widget->setHeaderItem(
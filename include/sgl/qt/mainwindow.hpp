@@ -41,7 +41,7 @@ namespace sgl::qt {
     For more info on what the resulting gui looks like and how to interact with it, see
     [here](markdown/visualizer.md).
    */
-  class SGL_API MainWindow : public QMainWindow {
+  class SGL_API MainWindow : public QMainWindow, private MenuObserver {
     Q_OBJECT
   public:
     template <typename Menu>
@@ -67,12 +67,25 @@ namespace sgl::qt {
     void update_window();
     void init_ui(size_t num_lines);
 
-    sgl::qt::MenuTree tree_;
-    sgl::qt::Display* disp_;
-    VerticalSection*  side_section_;
-    QTreeWidget*      side_tree_;
-    Section*          log_section_;
-    QTextEdit*        log_text_;
+    // MenuObserver notifications only mark rows of the side tree as dirty. The dirty rows are
+    // refreshed once per event loop iteration by flush_tree().
+    void current_page_changed(size_t old_page, size_t new_page) override;
+    void page_state_changed(size_t page, size_t old_item, size_t new_item) override;
+    void item_text_changed(size_t page, size_t item) override;
+    void mark_dirty(size_t page, size_t item);
+    void flush_tree();
+
+    /// item index of a dirty page row
+    static constexpr size_t page_row = ~size_t{0};
+
+    sgl::qt::MenuTree      tree_;
+    sgl::qt::Display*      disp_;
+    VerticalSection*       side_section_;
+    QTreeWidget*           side_tree_;
+    Section*               log_section_;
+    QTextEdit*             log_text_;
+    std::vector<MenuIndex> dirty_rows_{};         ///< rows of the side tree to refresh
+    bool                   flush_pending_{false}; ///< flush_tree() is scheduled
   };
 
 } // namespace sgl::qt
@@ -4,107 +4,165 @@
 //          https://www.boost.org/LICENSE_1_0.txt)
 #include "sgl/qt/menu_tree.hpp"
 
-namespace sgl::qt {
-  Node::Node(std::string_view name, Node::Type type, Node* parent)
-      : parent_{parent}, name_(name), type_(type) {}
+#include <algorithm>
 
-  Node::Node(std::string_view name, std::vector<Node*> children, Node::Type type, Node* parent)
-      : parent_(parent), children_(std::move(children)), name_(name), type_(type) {
-    for (auto& child : children_) {
-      child->set_parent(this);
-    }
+namespace sgl::qt {
+  void Node::init(std::string_view  name,
+                  std::string_view  type_name,
+                  Node::Type        type,
+                  AbstractMenuNode* menu,
+                  size_t            parent,
+                  size_t            index,
+                  size_t            first_child,
+                  size_t            size) {
+    menu_ = menu;
+    name_ = name;
+    type_name_ = type_name;
+    parent_ = static_cast<uint32_t>(parent);
+    index_ = static_cast<uint32_t>(index);
+    first_child_ = static_cast<uint32_t>(first_child);
+    size_ = static_cast<uint32_t>(size);
+    type_ = type;
   }
 
-  Node::~Node() {
-    for (Node* child : children_) {
-      delete child;
-    }
-  }
+  size_t Node::index() const { return index_; }
 
-  Node* Node::parent() { return parent_; }
+  size_t Node::size() const { return size_; }
 
-  const Node* Node::parent() const { return parent_; }
+  std::string_view Node::name() const { return name_; }
 
-  void Node::set_parent(Node* p) {
-    assert(parent_ == nullptr);
-    parent_ = p;
-  }
+  std::string_view Node::type_name() const { return type_name_; }
 
-  size_t Node::index() const {
-    if (not parent_) {
-      return 0;
-    }
+  Node::Type Node::type() const { return type_; }
 
-    const auto& siblings = parent_->children_;
+  AbstractPageNode* AbstractItemNode::get_page() { return menu_->page(parent_); }
 
-    for (size_t i = 0; i < siblings.size(); ++i) {
-      if (siblings[i] == this) {
-        return i;
-      }
+  const AbstractPageNode* AbstractItemNode::get_page() const { return menu_->page(parent_); }
+
+  bool AbstractItemNode::is_current() const { return get_page()->current_index() == index_; }
+
+  bool AbstractItemNode::text_changed() {
+    const auto current = this->text();
+    if (current == std::string_view(last_text_, last_size_)) {
+      return false;
     }
-    return ~size_t{0};
+    // item texts never exceed Item::text_size, the clamp only guards the arena
+    last_size_ = static_cast<uint32_t>(current.size() < last_capacity_ ? current.size()
+                                                                        : last_capacity_);
+    std::copy_n(current.data(), last_size_, last_text_);
+    return true;
   }
 
-  Node::iterator Node::begin() { return children_.begin(); }
+  AbstractMenuNode* AbstractPageNode::get_menu() { return menu_; }
+
+  AbstractItemNode* AbstractPageNode::item(size_t i) { return menu_->items_ + first_child_ + i; }
+
+  const AbstractItemNode* AbstractPageNode::item(size_t i) const {
+    return menu_->items_ + first_child_ + i;
+  }
 
-  Node::iterator Node::end() { return children_.end(); }
+  NodeRange<AbstractItemNode> AbstractPageNode::items() {
+    return {menu_->items_ + first_child_, size_};
+  }
 
-  Node::const_iterator Node::begin() const { return children_.begin(); }
+  NodeRange<const AbstractItemNode> AbstractPageNode::items() const {
+    return {menu_->items_ + first_child_, size_};
+  }
 
-  Node::const_iterator Node::end() const { return children_.end(); }
+  AbstractItemNode* AbstractPageNode::current_item() { return item(current_index()); }
 
-  std::vector<Node*>& Node::children() { return children_; }
+  const AbstractItemNode* AbstractPageNode::current_item() const { return item(current_index()); }
 
-  const std::vector<Node*>& Node::children() const { return children_; }
+  AbstractPageNode* AbstractMenuNode::page(size_t i) { return pages_ + i; }
 
-  size_t Node::size() const { return children_.size(); }
+  const AbstractPageNode* AbstractMenuNode::page(size_t i) const { return pages_ + i; }
 
-  std::string_view Node::name() const { return name_; }
+  NodeRange<AbstractPageNode> AbstractMenuNode::pages() { return {pages_, size_}; }
 
-  std::string_view Node::text() const { return {}; }
+  NodeRange<const AbstractPageNode> AbstractMenuNode::pages() const { return {pages_, size_}; }
 
-  std::string_view Node::type_name() const { return {}; }
+  AbstractPageNode* AbstractMenuNode::current_page() { return page(current_index()); }
 
-  Node::Type Node::type() const { return type_; }
+  const AbstractPageNode* AbstractMenuNode::current_page() const { return page(current_index()); }
 
-  AbstractPageNode* AbstractItemNode::get_page() {
-    return dynamic_cast<AbstractPageNode*>(parent());
-  }
+  AbstractItemNode* AbstractMenuNode::current_item() { return current_page()->current_item(); }
 
-  const AbstractPageNode* AbstractItemNode::get_page() const {
-    return dynamic_cast<const AbstractPageNode*>(parent());
+  const AbstractItemNode* AbstractMenuNode::current_item() const {
+    return current_page()->current_item();
   }
 
-  bool AbstractItemNode::is_current() const { return get_page()->current_index() == this->index(); }
+  MenuIndex AbstractMenuNode::current_menu_index() const {
+    return {current_index(), current_page()->current_index()};
+  }
 
-  AbstractMenuNode* AbstractPageNode::get_menu() {
-    return dynamic_cast<AbstractMenuNode*>(parent());
+  sgl::error AbstractMenuNode::handle_input(sgl::input i) {
+    const State before = state();
+    const auto  error = do_handle_input(i);
+    notify(before);
+    return error;
   }
 
-  AbstractItemNode* AbstractPageNode::current_item() {
-    return dynamic_cast<AbstractItemNode*>(children()[current_index()]);
+  sgl::error AbstractMenuNode::set_current_page(size_t index) {
+    const State before = state();
+    const auto  error = do_set_current_page(index);
+    notify(before);
+    return error;
   }
 
-  const AbstractItemNode* AbstractPageNode::current_item() const {
-    return dynamic_cast<const AbstractItemNode*>(children()[current_index()]);
+  void AbstractMenuNode::set_current_item(size_t index) {
+    const State before = state();
+    current_page()->set_current_item(index);
+    notify(before);
   }
 
-  AbstractPageNode* AbstractMenuNode::current_page() {
-    return dynamic_cast<AbstractPageNode*>(children()[current_index()]);
+  void AbstractMenuNode::set_observer(MenuObserver* observer) { observer_ = observer; }
+
+  void AbstractMenuNode::set_arena(AbstractPageNode* pages, AbstractItemNode* items) {
+    pages_ = pages;
+    items_ = items;
   }
 
-  const AbstractPageNode* AbstractMenuNode::current_page() const {
-    return dynamic_cast<const AbstractPageNode*>(children()[current_index()]);
+  void AbstractMenuNode::reset_texts() {
+    for (auto& page : pages()) {
+      for (auto& item : page.items()) {
+        item.text_changed();
+      }
+    }
   }
 
-  AbstractItemNode* AbstractMenuNode::current_item() { return current_page()->current_item(); }
+  AbstractMenuNode::State AbstractMenuNode::state() const {
+    const auto* page = current_page();
+    return {current_index(), page->current_index(), page->edit_mode()};
+  }
 
-  const AbstractItemNode* AbstractMenuNode::current_item() const {
-    return current_page()->current_item();
+  void AbstractMenuNode::notify(const State& before) {
+    if (observer_ == nullptr) {
+      return;
+    }
+    // Only the pages which were current before or after the change can have been modified by it,
+    // so only their state and item texts are compared, not those of the whole menu.
+    const State after = state();
+    if (after.page != before.page) {
+      const auto* old_page = page(before.page);
+      observer_->current_page_changed(before.page, after.page);
+      observer_->page_state_changed(before.page, before.item, old_page->current_index());
+      observer_->page_state_changed(after.page, after.item, after.item);
+      notify_texts(before.page);
+      notify_texts(after.page);
+      return;
+    }
+    if (after.item != before.item or after.edit != before.edit) {
+      observer_->page_state_changed(after.page, before.item, after.item);
+    }
+    notify_texts(after.page);
   }
 
-  MenuIndex AbstractMenuNode::current_menu_index() const {
-    return {current_index(), current_page()->current_index()};
+  void AbstractMenuNode::notify_texts(size_t page) {
+    for (auto& item : this->page(page)->items()) {
+      if (item.text_changed()) {
+        observer_->item_text_changed(page, item.index());
+      }
+    }
   }
 
   MenuTree::MenuTree(MenuTree&& other) : root_(other.root_) { other.root_ = nullptr; }
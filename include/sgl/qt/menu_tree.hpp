@@ -6,7 +6,10 @@
 #define MENU_TREE_HPP
 #include "sgl.hpp"
 
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -61,86 +64,224 @@ namespace sgl::qt {
     static constexpr std::string_view value{"sgl::Menu"};
   };
 
+  /// @cond
+  namespace detail {
+    template <typename... Items>
+    constexpr size_t text_size(sgl::type_list<Items...>) {
+      return (Items::text_size + ... + 0);
+    }
+
+    template <typename... Pages>
+    constexpr size_t page_text_size(sgl::type_list<Pages...>) {
+      return (text_size(typename Pages::item_list{}) + ... + 0);
+    }
+  } // namespace detail
+  /// @endcond
+
+  /// number of pages and items of a menu, and the sum of the text sizes of its items
+  template <typename Menu>
+  struct menu_size;
+
+  template <typename NameList, typename PageList>
+  struct menu_size<sgl::Menu<NameList, PageList>> {
+    static constexpr size_t pages = sgl::list_size_v<PageList>;
+    static constexpr size_t items = sgl::detail::num_items(PageList{});
+    static constexpr size_t text = detail::page_text_size(PageList{});
+  };
+
   struct MenuIndex {
     size_t page_index;
     size_t item_index;
   };
 
-  class SGL_API Node {
+  class AbstractItemNode;
+  class AbstractPageNode;
+  class AbstractMenuNode;
+
+  template <typename Menu>
+  class MenuNode;
+
+  /// contiguous range of nodes, e.g. the pages of a menu or the items of a page
+  template <typename T>
+  class NodeRange {
   public:
-    enum class Type { none = 0, menu, page, item };
-    using iterator = typename std::vector<Node*>::iterator;
-    using const_iterator = typename std::vector<Node*>::const_iterator;
-    Node(std::string_view name, Node::Type type, Node* parent = nullptr);
-    Node(std::string_view   name,
-         std::vector<Node*> children,
-         Node::Type         type,
-         Node*              parent = nullptr);
-    Node(const Node&) = delete;
+    NodeRange(T* first, size_t size) : first_(first), size_(size) {}
 
-    virtual ~Node();
+    [[nodiscard]] T*     begin() const { return first_; }
+    [[nodiscard]] T*     end() const { return first_ + size_; }
+    [[nodiscard]] size_t size() const { return size_; }
+    T&                   operator[](size_t i) const { return first_[i]; }
 
-    Node*                     parent();
-    [[nodiscard]] const Node* parent() const;
+  private:
+    T*     first_;
+    size_t size_;
+  };
 
-    void set_parent(Node* p);
+  /**
+    Common part of the menu, page and item nodes.
 
-    [[nodiscard]] size_t index() const;
+    All nodes of a MenuTree are stored in one contiguous arena inside of the MenuNode, which is
+    sized from the number of pages and items of the menu type. Links between nodes are indices
+    into this arena instead of pointers, and the nodes are not polymorphic, except for the menu
+    node itself.
+   */
+  class SGL_API Node {
+  public:
+    enum class Type { none = 0, menu, page, item };
 
-    iterator                     begin();
-    iterator                     end();
-    [[nodiscard]] const_iterator begin() const;
-    [[nodiscard]] const_iterator end() const;
+    Node() = default;
+    Node(const Node&) = delete;
+    Node& operator=(const Node&) = delete;
 
-    std::vector<Node*>&                     children();
-    [[nodiscard]] const std::vector<Node*>& children() const;
+    /// index of this node in its parent, 0 for the menu node
+    [[nodiscard]] size_t index() const;
 
+    /// number of children, i.e. pages of a menu or items of a page
     [[nodiscard]] size_t size() const;
 
     [[nodiscard]] std::string_view name() const;
 
-    [[nodiscard]] virtual std::string_view text() const;
-
-    [[nodiscard]] virtual std::string_view type_name() const;
+    [[nodiscard]] std::string_view type_name() const;
 
     [[nodiscard]] Node::Type type() const;
 
-  private:
-    Node*              parent_{nullptr};
-    std::vector<Node*> children_{};
-    std::string_view   name_{};
-    Node::Type         type_{Type::none};
+  protected:
+    void init(std::string_view  name,
+              std::string_view  type_name,
+              Node::Type        type,
+              AbstractMenuNode* menu,
+              size_t            parent,
+              size_t            index,
+              size_t            first_child,
+              size_t            size);
+
+    AbstractMenuNode* menu_{nullptr};    ///< root node, owns the arena
+    std::string_view  name_{};           ///< name of the node
+    std::string_view  type_name_{};      ///< name of the menu, page or item type
+    uint32_t          parent_{0};        ///< index of the parent page of an item
+    uint32_t          index_{0};         ///< index in the parent
+    uint32_t          first_child_{0};   ///< arena index of the first item of a page
+    uint32_t          size_{0};          ///< number of children
+    Node::Type        type_{Type::none}; ///< kind of node
   };
 
-  class AbstractItemNode;
-  class AbstractPageNode;
-  class AbstractMenuNode;
+  /**
+    Receives change notifications of a MenuTree. Notifications are sent by the state changing
+    functions of AbstractMenuNode, i.e. handle_input(), set_current_page() and set_current_item().
+   */
+  class SGL_API MenuObserver {
+  public:
+    virtual ~MenuObserver() = default;
+
+    /// the current page of the menu changed from old_page to new_page
+    virtual void current_page_changed(size_t old_page, size_t new_page) = 0;
+
+    /// the current item or the edit mode of a page changed. old_item and new_item may be equal.
+    virtual void page_state_changed(size_t page, size_t old_item, size_t new_item) = 0;
+
+    /// the text of an item changed
+    virtual void item_text_changed(size_t page, size_t item) = 0;
+  };
 
   class SGL_API AbstractItemNode : public Node {
   public:
-    using Node::Node;
     AbstractPageNode*                     get_page();
     [[nodiscard]] const AbstractPageNode* get_page() const;
     bool                                  is_current() const;
+
+    [[nodiscard]] std::string_view text() const { return text_(item_); }
+
+    /// compares text() with the text of the last call and returns true if it changed
+    bool text_changed();
+
+  private:
+    template <typename Menu>
+    friend class MenuNode;
+
+    using TextFunction = std::string_view (*)(const void*);
+
+    template <typename Item>
+    void init(std::string_view  name,
+              AbstractMenuNode* menu,
+              size_t            page,
+              size_t            index,
+              Item&             item,
+              char*             last_text) {
+      Node::init(name, get_type_name<Item>::value, Type::item, menu, page, index, 0, 0);
+      item_ = &item;
+      last_text_ = last_text;
+      last_capacity_ = static_cast<uint32_t>(Item::text_size);
+      text_ = [](const void* p) -> std::string_view {
+        const auto& text = static_cast<const Item*>(p)->text();
+        return {text.data(), text.size()};
+      };
+    }
+
+    const void*  item_{nullptr};
+    TextFunction text_{nullptr};
+    char*        last_text_{nullptr}; ///< copy of the last text, Item::text_size chars in the arena
+    uint32_t     last_size_{0};       ///< size of the last text
+    uint32_t     last_capacity_{0};   ///< Item::text_size
   };
 
   class SGL_API AbstractPageNode : public Node {
   public:
-    using Node::Node;
-    [[nodiscard]] virtual size_t          current_index() const = 0;
-    [[nodiscard]] virtual bool            edit_mode() const = 0;
-    virtual void                          set_current_item(size_t i) = 0;
+    [[nodiscard]] size_t current_index() const { return current_index_(page_); }
+    [[nodiscard]] bool   edit_mode() const { return edit_mode_(page_); }
+    void                 set_current_item(size_t i) { set_current_item_(page_, i); }
+
     AbstractMenuNode*                     get_menu();
-    AbstractItemNode*                     current_item();
-    [[nodiscard]] const AbstractItemNode* current_item() const;
+    AbstractItemNode*                     item(size_t i);
+    [[nodiscard]] const AbstractItemNode* item(size_t i) const;
+    NodeRange<AbstractItemNode>           items();
+    [[nodiscard]] NodeRange<const AbstractItemNode> items() const;
+    AbstractItemNode*                               current_item();
+    [[nodiscard]] const AbstractItemNode*           current_item() const;
+
+  private:
+    template <typename Menu>
+    friend class MenuNode;
+
+    template <typename Page>
+    void init(std::string_view name,
+              AbstractMenuNode* menu,
+              size_t            index,
+              size_t            first_item,
+              Page&             page) {
+      Node::init(
+          name, get_type_name<Page>::value, Type::page, menu, 0, index, first_item, page.size());
+      page_ = &page;
+      current_index_ = [](const void* p) -> size_t {
+        return static_cast<const Page*>(p)->current_item_index();
+      };
+      edit_mode_ = [](const void* p) -> bool {
+        return static_cast<const Page*>(p)->is_in_edit_mode();
+      };
+      set_current_item_ = [](void* p, size_t i) { static_cast<Page*>(p)->set_current_item(i); };
+    }
+
+    void* page_{nullptr};
+    size_t (*current_index_)(const void*){nullptr};
+    bool (*edit_mode_)(const void*){nullptr};
+    void (*set_current_item_)(void*, size_t){nullptr};
   };
 
   class SGL_API AbstractMenuNode : public Node {
   public:
-    using Node::Node;
-    virtual sgl::error           handle_input(sgl::input i) = 0;
+    virtual ~AbstractMenuNode() = default;
+
+    sgl::error                   handle_input(sgl::input i);
     [[nodiscard]] virtual size_t current_index() const = 0;
-    virtual sgl::error           set_current_page(size_t index) = 0;
+    sgl::error                   set_current_page(size_t index);
+    void                         set_current_item(size_t index);
+
+    /// set the observer which is notified of changes, or nullptr to not send notifications
+    void set_observer(MenuObserver* observer);
+
+    AbstractPageNode*                               page(size_t i);
+    [[nodiscard]] const AbstractPageNode*           page(size_t i) const;
+    NodeRange<AbstractPageNode>                     pages();
+    [[nodiscard]] NodeRange<const AbstractPageNode> pages() const;
 
     AbstractPageNode*                     current_page();
     [[nodiscard]] const AbstractPageNode* current_page() const;
@@ -149,73 +290,97 @@ namespace sgl::qt {
     [[nodiscard]] const AbstractItemNode* current_item() const;
 
     [[nodiscard]] MenuIndex current_menu_index() const;
-  };
 
-  template <typename Item>
-  class ItemNode : public AbstractItemNode {
-  public:
-    ItemNode(std::string_view name, Item& item, Node* parent = nullptr)
-        : AbstractItemNode(name, Node::Type::item, parent), item_(item) {}
-
-    [[nodiscard]] std::string_view text() const override {
-      return {item_.text().data(), item_.text().size()};
-    }
-
-    [[nodiscard]] std::string_view type_name() const override { return get_type_name<Item>::value; }
-
-  private:
-    Item& item_;
-  };
+  protected:
+    AbstractMenuNode() = default;
 
-  template <typename Item>
-  ItemNode(std::string_view, Item&, Node*) -> ItemNode<Item>;
+    virtual sgl::error do_handle_input(sgl::input i) = 0;
+    virtual sgl::error do_set_current_page(size_t index) = 0;
 
-  template <typename Page>
-  class PageNode : public AbstractPageNode {
-  public:
-    PageNode(std::string_view name, Page& page, Node* parent)
-        : AbstractPageNode(name, Type::page,parent), page_(page) {
-      sgl::for_each_with_name(page_, [this](auto name, auto& item) {
-        this->children().push_back(
-            new ItemNode(std::string_view{name.to_view().data(), name.to_view().size()}, item, this));
-      });
-    }
+    /// sets the node arena. Called by the derived class once all nodes are initialized.
+    void set_arena(AbstractPageNode* pages, AbstractItemNode* items);
 
-    [[nodiscard]] size_t current_index() const override { return page_.current_item_index(); }
+    /// stores the current text of every item, so that only later changes are notified
+    void reset_texts();
 
-    [[nodiscard]] std::string_view type_name() const override { return get_type_name<Page>::value; }
+  private:
+    friend class AbstractPageNode;
 
-    [[nodiscard]] bool edit_mode() const override { return page_.is_in_edit_mode(); }
+    struct State {
+      size_t page;
+      size_t item;
+      bool   edit;
+    };
 
-    void set_current_item(size_t i) override { page_.set_current_item(i); }
+    [[nodiscard]] State state() const;
+    void                notify(const State& before);
+    void                notify_texts(size_t page);
 
-  private:
-    Page& page_;
+    AbstractPageNode* pages_{nullptr};    ///< first page node of the arena
+    AbstractItemNode* items_{nullptr};    ///< first item node of the arena
+    MenuObserver*     observer_{nullptr}; ///< receiver of change notifications
   };
 
-  template <typename Page>
-  PageNode(std::string_view, Page&, Node*) -> PageNode<Page>;
-
+  /**
+    Owns the menu and the arena of all page and item nodes. The arena consists of two arrays, one
+    with a node per page and one with a node per item, where the items of a page are adjacent, and
+    a character array which holds the last text of every item for AbstractItemNode::text_changed().
+    Building the tree therefore only allocates the MenuNode itself.
+   */
   template <typename Menu>
   class MenuNode : public AbstractMenuNode {
   public:
-    MenuNode(Menu menu) : AbstractMenuNode(std::string_view{}, Type::menu), menu_(std::move(menu)) {
-      sgl::for_each_with_name(menu_, [this](auto name, auto& page) {
-        this->children().push_back(
-            new PageNode(std::string_view{name.to_view().data(), name.to_view().size()}, page, this));
+    /// number of page nodes
+    static constexpr size_t page_count = menu_size<Menu>::pages;
+
+    /// number of item nodes
+    static constexpr size_t item_count = menu_size<Menu>::items;
+
+    /// number of characters of the last item texts
+    static constexpr size_t text_count = menu_size<Menu>::text;
+
+    MenuNode(Menu menu) : menu_(std::move(menu)) {
+      Node::init({}, get_type_name<Menu>::value, Type::menu, this, 0, 0, 0, page_count);
+      size_t page_index = 0;
+      size_t first_item = 0;
+      size_t first_char = 0;
+      sgl::for_each_with_name(menu_, [&](auto name, auto& page) {
+        pages_[page_index].init(to_std_view(name), this, page_index, first_item, page);
+        size_t item_index = 0;
+        sgl::for_each_with_name(page, [&](auto item_name, auto& item) {
+          items_[first_item + item_index].init(to_std_view(item_name),
+                                               this,
+                                               page_index,
+                                               item_index,
+                                               item,
+                                               texts_.data() + first_char);
+          first_char += std::decay_t<decltype(item)>::text_size;
+          ++item_index;
+        });
+        first_item += item_index;
+        ++page_index;
       });
+      this->set_arena(pages_.data(), items_.data());
+      this->reset_texts();
     }
 
     [[nodiscard]] size_t current_index() const override { return menu_.current_page_index(); }
 
-    [[nodiscard]] std::string_view type_name() const override { return get_type_name<Menu>::value; }
-
-    sgl::error handle_input(sgl::input i) override { return menu_.handle_input(i); }
+  protected:
+    sgl::error do_handle_input(sgl::input i) override { return menu_.handle_input(i); }
 
-    sgl::error set_current_page(size_t index) override { return menu_.set_current_page(index); }
+    sgl::error do_set_current_page(size_t index) override { return menu_.set_current_page(index); }
 
   private:
-    Menu menu_;
+    template <typename Name>
+    static std::string_view to_std_view(Name name) {
+      return {name.to_view().data(), name.to_view().size()};
+    }
+
+    Menu                                     menu_;
+    std::array<AbstractPageNode, page_count> pages_{};
+    std::array<AbstractItemNode, item_count> items_{};
+    std::array<char, text_count>             texts_{};
   };
 
   template <typename Menu>
@@ -0,0 +1,254 @@
+/**
+ * @file sgl/raster.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::TextRasterizer, which draws the current page of a menu into a caller
+ * provided 1 bit per pixel or RGB565 frame buffer, and only redraws character cells which changed.
+ *
+ * @version 0.1
+ * @date 2023-03-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_RASTER_HPP
+#define SGL_RASTER_HPP
+#include "sgl/font.hpp"
+#include "sgl/page_snapshot.hpp"
+#include "sgl/string_view.hpp"
+#include "sgl/text_layout.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sgl {
+
+  /// @headerfile raster.hpp "sgl/raster.hpp"
+
+  /**
+    @brief 1 bit per pixel format. Rows are stored top to bottom, every row starts on a new byte,
+    and the leftmost pixel of a byte is bit 7. A set bit is a lit pixel.
+   */
+  struct Mono1 {
+    /// storage type of the frame buffer
+    using storage_type = uint8_t;
+
+    /**
+      get the number of storage units of a row.
+      @param width width in pixels
+      @return row size in bytes
+     */
+    static constexpr size_t stride(size_t width) noexcept { return (width + 7) / 8; }
+
+    /**
+      write count pixels of a glyph row into a frame buffer row.
+      @param line frame buffer row
+      @param x first pixel
+      @param bits pixels, leftmost in bit 7
+      @param count number of pixels, 1 to 8
+     */
+    constexpr void
+        write(storage_type* line, size_t x, uint8_t bits, uint8_t count) const noexcept;
+  };
+
+  /**
+    @brief 16 bit RGB565 format. Rows are stored top to bottom, one uint16_t per pixel.
+   */
+  struct Rgb565 {
+    /// storage type of the frame buffer
+    using storage_type = uint16_t;
+
+    /**
+      get the number of storage units of a row.
+      @param width width in pixels
+      @return row size in pixels
+     */
+    static constexpr size_t stride(size_t width) noexcept { return width; }
+
+    /**
+      write count pixels of a glyph row into a frame buffer row.
+      @param line frame buffer row
+      @param x first pixel
+      @param bits pixels, leftmost in bit 7
+      @param count number of pixels, 1 to 8
+     */
+    constexpr void
+        write(storage_type* line, size_t x, uint8_t bits, uint8_t count) const noexcept;
+
+    uint16_t foreground{0xFFFF}; ///< color of lit pixels
+    uint16_t background{0x0000}; ///< color of unlit pixels
+  };
+
+  /**
+    @brief Caller provided frame buffer.
+
+    A pixel format is a type like sgl::Mono1 or sgl::Rgb565, i.e. it has a storage_type, a static
+    stride() function which returns the number of storage units per row, and a write() member which
+    writes up to 8 pixels of a glyph row.
+
+    @tparam Format pixel format
+   */
+  template <typename Format>
+  struct Bitmap {
+    typename Format::storage_type* data{nullptr}; ///< pixel data, Format::stride(width) * height
+    size_t                         width{0};      ///< width in pixels
+    size_t                         height{0};     ///< height in pixels
+    Format                         format{};      ///< pixel format
+  };
+
+  /**
+    @brief Draws the current page of a menu as a grid of Columns x Rows character cells.
+
+    Every page item is one line. The first column of a line is the cursor marker, which is '>' for
+    the current item, followed by the item text. In edit mode, the text of the current item is
+    drawn inverted. If a page has more items than Rows, the lines scroll with the current item.
+
+    Item texts are decoded as UTF-8, UTF-16 or UTF-32 depending on CharT, and laid out by display
+    width: a wide character, e.g. a CJK ideograph, takes two cells, combining marks take none, and
+    a text which does not fit ends with the ellipsis marker. The layout of every line is cached in
+    a sgl::TextLayout, so a line is only decoded again if its text changed.
+
+    update() lays out the text grid, draw() rasterizes every cell which differs from the last drawn
+    grid. A value change of one item therefore only redraws the few cells of its text, and a cursor
+    move only redraws the two marker cells, instead of the whole frame buffer.
+
+    ```cpp
+    uint8_t                    pixels[sgl::Mono1::stride(128) * 64]{};
+    sgl::Bitmap<sgl::Mono1>    bitmap{pixels, 128, 64};
+    sgl::TextRasterizer<21, 8> rasterizer;
+
+    menu.handle_input(input);
+    menu.tick();
+    if (rasterizer.render(menu, bitmap) != 0) {
+      display.write(pixels); // only if something changed
+    }
+    ```
+
+    A rasterizer keeps track of what it has drawn, so use one rasterizer per frame buffer. Call
+    invalidate() if the frame buffer was modified by something else.
+
+    @tparam Columns number of character cells per line, including the marker
+    @tparam Rows number of lines
+    @tparam CharT character type of the menu
+   */
+  template <size_t Columns, size_t Rows, typename CharT = char>
+  class TextRasterizer {
+  public:
+    static_assert(Columns > 1, "sgl::TextRasterizer needs at least two columns");
+    static_assert(Rows > 0, "sgl::TextRasterizer needs at least one row");
+
+    /// a character cell
+    struct Cell {
+      char32_t c{U' '};         ///< character
+      bool     inverted{false}; ///< draw inverted
+
+      /// compare two cells
+      constexpr bool operator==(const Cell& other) const noexcept {
+        return c == other.c and inverted == other.inverted;
+      }
+
+      /// compare two cells
+      constexpr bool operator!=(const Cell& other) const noexcept { return !(*this == other); }
+    };
+
+    /// number of character cells per line
+    static constexpr size_t columns = Columns;
+
+    /// number of lines
+    static constexpr size_t rows = Rows;
+
+    /// marker character of the current item
+    static constexpr char32_t cursor = U'>';
+
+    /// marker character of truncated text. The built in font has no U+2026, so '~' is used.
+    static constexpr char32_t ellipsis = U'~';
+
+    /**
+      construct a rasterizer. The first draw() draws every cell.
+      @param font font atlas, must outlive the rasterizer
+     */
+    constexpr explicit TextRasterizer(const sgl::Font& font = sgl::font_5x7) noexcept
+        : font_(&font) {}
+
+    /**
+      lay out the current page of menu.
+      @param menu menu
+     */
+    template <typename NameList, typename PageList>
+    constexpr void update(const sgl::Menu<NameList, PageList>& menu) noexcept;
+
+    /**
+      lay out a page view, e.g. the one returned by sgl::PageSnapshot::read() on a render thread.
+      @param view page view
+     */
+    template <typename Menu>
+    constexpr void update(const sgl::PageView<Menu>& view) noexcept;
+
+    /**
+      rasterize every cell which changed since the last draw().
+      @param bitmap frame buffer. Cells which are partially outside of it are clipped.
+      @return number of drawn cells
+     */
+    template <typename Format>
+    constexpr size_t draw(const sgl::Bitmap<Format>& bitmap) noexcept;
+
+    /**
+      update() and draw() in one call.
+      @param source menu or page view
+      @param bitmap frame buffer
+      @return number of drawn cells
+     */
+    template <typename Source, typename Format>
+    constexpr size_t render(const Source& source, const sgl::Bitmap<Format>& bitmap) noexcept {
+      update(source);
+      return draw(bitmap);
+    }
+
+    /// make the next draw() draw every cell.
+    constexpr void invalidate() noexcept { valid_ = false; }
+
+    /**
+      get a cell of the laid out grid.
+      @param column column
+      @param row row
+      @return cell
+     */
+    [[nodiscard]] constexpr const Cell& cell(size_t column, size_t row) const noexcept {
+      return cells_[row][column];
+    }
+
+    /// @return index of the item drawn in the first line
+    [[nodiscard]] constexpr size_t first_line() const noexcept { return top_; }
+
+  private:
+    /// scrolls the window so that current is visible.
+    constexpr void scroll(size_t size, size_t current) noexcept;
+
+    /// lays out one line.
+    constexpr void
+        set_line(size_t row, sgl::string_view<CharT> text, bool current, bool edit) noexcept;
+
+    /// clears the lines from row on.
+    constexpr void clear_lines(size_t row) noexcept;
+
+    /// rasterizes one cell.
+    template <typename Format>
+    constexpr void
+        draw_cell(const sgl::Bitmap<Format>& bitmap, size_t column, size_t row) noexcept;
+
+    /// caches the text layout of a line, i.e. of up to Columns - 1 cells and one overflowing
+    /// character
+    using Layout = sgl::TextLayout<CharT, Columns * sgl::max_code_units<CharT>>;
+
+    const sgl::Font* font_;
+    Cell             cells_[Rows][Columns]{};
+    Cell             drawn_[Rows][Columns]{};
+    Layout           layouts_[Rows]{};
+    size_t           top_{0};
+    bool             valid_{false};
+  };
+} // namespace sgl
+
+#include "sgl/impl/raster_impl.hpp"
+#endif /* SGL_RASTER_HPP */
@@ -0,0 +1,160 @@
+/**
+ * @file sgl/reflection.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::Reflection, a compile time generated flat table of all pages and items
+ * of a menu, which lets generic tools walk a menu with a plain loop instead of nested template
+ * iteration.
+ *
+ * @version 0.1
+ * @date 2023-03-11
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_REFLECTION_HPP
+#define SGL_REFLECTION_HPP
+#include "sgl/array.hpp"
+#include "sgl/error.hpp"
+#include "sgl/fwd.hpp"
+#include "sgl/input.hpp"
+#include "sgl/menu.hpp"
+#include "sgl/serialize.hpp"
+#include "sgl/string_view.hpp"
+
+#include <cstdint>
+
+namespace sgl {
+
+  /// @headerfile reflection.hpp "sgl/reflection.hpp"
+
+  /// kind of an item
+  enum class item_kind : uint8_t {
+    custom,      ///< any other item type
+    button,      ///< sgl::Button
+    boolean,     ///< sgl::Boolean
+    enumeration, ///< sgl::Enum and sgl::LocalizedEnum
+    numeric,     ///< sgl::Numeric
+    page_link    ///< sgl::PageLink
+  };
+
+  /// value type of an item. The values are the value encodings of sgl::SerializeTraits.
+  enum class value_type : uint8_t {
+    none = 0,             ///< item has no value
+    boolean = 1,          ///< bool
+    enumeration = 2,      ///< index of an enumerator
+    unsigned_integer = 3, ///< unsigned integer
+    signed_integer = 4,   ///< signed integer
+    floating_point = 5,   ///< float or double
+    unsigned_fixed = 6,   ///< sgl::unsigned_fixed
+    signed_fixed = 7      ///< sgl::signed_fixed
+  };
+
+  /**
+    Type erased operations on an item. There is one instance per item type, shared by all items of
+    that type. The item pointer must point to an item of that type, see sgl::ItemInfo::address.
+    @tparam CharT character type of the item
+   */
+  template <typename CharT>
+  struct ItemOps {
+    /// get the text of the item
+    sgl::string_view<CharT> (*text)(const void* item) noexcept;
+
+    /// call the items handle_input()
+    sgl::error (*handle_input)(void* item, sgl::input i) noexcept;
+
+    /// call the items tick()
+    void (*tick)(void* item) noexcept;
+
+    /// set the value of the item from a string, see sgl::PathTraits
+    sgl::error (*set)(void* item, sgl::string_view<CharT> value) noexcept;
+  };
+
+  /**
+    Entry of sgl::Reflection::items, describes a single item of a menu of type Menu.
+    @tparam Menu sgl::Menu type
+   */
+  template <typename Menu>
+  struct ItemInfo {
+    /// character type of the menu
+    using char_type = typename Menu::char_type;
+
+    /// function which returns the address of the item in a menu
+    using Address = void* (*)(Menu& menu) noexcept;
+
+    sgl::string_view<char>         page_name;         ///< name of the page
+    sgl::string_view<char>         item_name;         ///< name of the item
+    size_t                         page;              ///< index of the page in the menu
+    size_t                         item;              ///< index of the item in the page
+    sgl::item_kind                 kind;              ///< kind of the item
+    sgl::value_type                value;             ///< value type of the item
+    size_t                         value_size;        ///< size of the value in a snapshot
+    size_t                         text_size;         ///< capacity of the text of the item
+    Address                        address;           ///< get the address of the item
+    const sgl::ItemOps<char_type>* ops;               ///< operations of the item type
+
+    /**
+      get the byte offset of the item within menu. Pointer arithmetic is not allowed in constant
+      expressions, which is why the offset is computed from address at runtime.
+      @param menu menu instance
+      @return offset of the item in bytes
+     */
+    [[nodiscard]] size_t offset(Menu& menu) const noexcept {
+      return static_cast<size_t>(static_cast<char*>(address(menu)) -
+                                 reinterpret_cast<char*>(&menu));
+    }
+  };
+
+  /// Entry of sgl::Reflection::pages, describes a single page.
+  struct PageInfo {
+    sgl::string_view<char> name;       ///< name of the page
+    size_t                 first_item; ///< index of the first item of the page in the item table
+    size_t                 size;       ///< number of items of the page
+  };
+
+  /// @cond
+  namespace reflection_impl {
+    template <typename Menu>
+    struct tables;
+  } // namespace reflection_impl
+  /// @endcond
+
+  /**
+    @brief Flat compile time table of all pages and items of a menu.
+
+    The items are listed page by page in declaration order, i.e. the index of an item in the table
+    is the same as its id in a delta of sgl::serialize_delta(). The item operations are type
+    erased, so a tool which walks the menu through this table is compiled once per menu type, not
+    once per item type.
+
+    ```cpp
+    using R = sgl::Reflection<decltype(menu)>;
+    for (const auto& info : R::items) {
+      auto text = info.ops->text(info.address(menu));
+      print(info.page_name, info.item_name, text);
+    }
+    ```
+
+    @tparam Menu sgl::Menu type
+   */
+  template <typename Menu>
+  struct Reflection {
+    /// number of pages
+    static constexpr size_t num_pages = reflection_impl::tables<Menu>::num_pages;
+
+    /// number of items over all pages
+    static constexpr size_t num_items = reflection_impl::tables<Menu>::num_items;
+
+    /// one entry per page
+    static constexpr sgl::Array<sgl::PageInfo, num_pages> pages =
+        reflection_impl::tables<Menu>::pages();
+
+    /// one entry per item
+    static constexpr sgl::Array<sgl::ItemInfo<Menu>, num_items> items =
+        reflection_impl::tables<Menu>::items();
+  };
+} // namespace sgl
+
+#include "sgl/impl/reflection_impl.hpp"
+#endif /* SGL_REFLECTION_HPP */
@@ -0,0 +1,193 @@
+/**
+ * @file sgl/serialize.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::serialize(), sgl::deserialize(), their delta counterparts and the
+ * sgl::SerializeTraits customization point used to store the values of a menu's items in a
+ * compact binary snapshot.
+ *
+ * @version 0.1
+ * @date 2023-01-14
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_SERIALIZE_HPP
+#define SGL_SERIALIZE_HPP
+#include "sgl/error.hpp"
+#include "sgl/fwd.hpp"
+#include "sgl/menu.hpp"
+
+#include <cstdint>
+
+namespace sgl {
+
+  /// @headerfile serialize.hpp "sgl/serialize.hpp"
+
+  /**
+    @defgroup serialization Serialization
+
+    Functions to store and restore the values of a menu's items.
+
+    A **snapshot** is a fixed layout binary record of every value carrying item of a menu. It
+    starts with a 4 byte schema hash, followed by the values of all items in declaration order,
+    i.e. page by page and item by item. Items without a value, like buttons or page links, take up
+    no space. All multi byte values are stored in little endian byte order, so a snapshot can be
+    restored on a different machine as long as the menu type is the same. The schema hash is
+    computed at compile time from the page names, item names and value encodings, see
+    sgl::schema_hash_v.
+
+    ```cpp
+    uint8_t blob[sgl::snapshot_size_v<decltype(menu)>];
+    auto res = sgl::serialize(menu, blob, sizeof(blob));   // res.size == sizeof(blob)
+    ...
+    auto ec = sgl::deserialize(menu, blob, sizeof(blob));
+    ```
+
+    A **delta** only contains the values which changed compared to a previous snapshot. It
+    consists of the schema hash followed by records of the form [item id (2 bytes)][value]. The
+    item id is the zero based index of the item in declaration order over the whole menu, i.e.
+    the same id sgl::serialize() uses to order the values.
+
+    @{
+   */
+
+  /// This struct is returned by sgl::serialize() and sgl::serialize_delta(). It contains an
+  /// sgl::error value and the number of bytes written in case of success.
+  struct serialize_result {
+    sgl::error ec{sgl::error::no_error}; ///< serialization error
+    size_t     size{0};                  ///< number of bytes written
+  };
+
+  /**
+    Customization point which describes how the value of an item is stored in a snapshot.
+
+    The primary template describes an item without value, i.e. one which is not stored at all.
+    sgl specializes this struct for sgl::Boolean, sgl::Enum, sgl::LocalizedEnum and sgl::Numeric
+    (with arithmetic and fix point value types). To make a custom item serializable, specialize this
+    struct with the following members:
+
+    ```cpp
+    template <>
+    struct sgl::SerializeTraits<MyItem> {
+      static constexpr size_t  size = ...; // number of bytes the value takes up, not 0
+      static constexpr uint8_t tag = ...;  // value encoding, part of the schema hash
+      static void       write(const MyItem& item, uint8_t* out) noexcept;
+      static sgl::error read(MyItem& item, const uint8_t* in) noexcept;
+    };
+    ```
+
+    @tparam Item item type
+   */
+  template <typename Item>
+  struct SerializeTraits {
+    /// number of bytes the value of Item takes up in a snapshot.
+    static constexpr size_t size = 0;
+    /// identifies the encoding of the value. Part of the schema hash.
+    static constexpr uint8_t tag = 0;
+  };
+
+  /**
+    number of bytes a snapshot of a menu of type Menu takes up, including the schema hash.
+    @tparam Menu sgl::Menu type
+   */
+  template <typename Menu>
+  inline constexpr size_t snapshot_size_v = 0;
+
+  /**
+    upper bound for the size of a delta of a menu of type Menu, i.e. the size of a delta in which
+    every value changed.
+    @tparam Menu sgl::Menu type
+   */
+  template <typename Menu>
+  inline constexpr size_t max_delta_size_v = 0;
+
+  /**
+    compile time hash of the layout of a menu of type Menu. It changes if a page or item is
+    added, removed, renamed or if the value type of an item changes.
+    @tparam Menu sgl::Menu type
+   */
+  template <typename Menu>
+  inline constexpr uint32_t schema_hash_v = 0;
+
+  /**
+    write a snapshot of the values of menu into buffer.
+    @param menu menu to serialize
+    @param buffer buffer to write into
+    @param len size of buffer in bytes. Must be at least sgl::snapshot_size_v<Menu>.
+    @return sgl::serialize_result with ec == sgl::error::buffer_too_small if buffer is too small,
+    else sgl::error::no_error and size == sgl::snapshot_size_v<Menu>.
+   */
+  template <typename NameList, typename PageList>
+  sgl::serialize_result serialize(const sgl::Menu<NameList, PageList>& menu,
+                                  uint8_t*                             buffer,
+                                  size_t                               len) noexcept;
+
+  /**
+    restore the values of menu from a snapshot created with sgl::serialize().
+    @note the schema hash and the size of the snapshot are checked, in that order, before any item
+    is modified. If an
+    item rejects its value, e.g. an enum index out of range, the items before it have already been
+    restored.
+    @param menu menu to restore
+    @param buffer snapshot
+    @param len size of the snapshot in bytes
+    @return sgl::error::no_error in case of success
+    @return sgl::error::buffer_too_small if len is smaller than sgl::snapshot_size_v<Menu>
+    @return sgl::error::schema_mismatch if the snapshot was created by a different menu type
+    @return the error of the first item which rejected its value otherwise
+   */
+  template <typename NameList, typename PageList>
+  sgl::error deserialize(sgl::Menu<NameList, PageList>& menu,
+                         const uint8_t*                 buffer,
+                         size_t                         len) noexcept;
+
+  /**
+    write the values which differ from snapshot into buffer, and update snapshot accordingly.
+    Nothing is written if no value changed, i.e. the returned size is 0.
+
+    ```cpp
+    uint8_t last[sgl::snapshot_size_v<Menu>];
+    (void)sgl::serialize(menu, last, sizeof(last));
+    ...
+    uint8_t delta[sgl::max_delta_size_v<Menu>];
+    auto res = sgl::serialize_delta(menu, last, sizeof(last), delta, sizeof(delta));
+    ```
+
+    @param menu menu to serialize
+    @param snapshot snapshot of menu created with sgl::serialize(). Changed values are copied into
+    it, i.e. after a successful call it is equal to a fresh snapshot of menu. If the delta does not
+    fit into buffer, snapshot is left unchanged.
+    @param snapshot_len size of snapshot in bytes
+    @param buffer buffer to write the delta into
+    @param len size of buffer in bytes. sgl::max_delta_size_v<Menu> is always sufficient.
+    @return sgl::serialize_result
+   */
+  template <typename NameList, typename PageList>
+  sgl::serialize_result serialize_delta(const sgl::Menu<NameList, PageList>& menu,
+                                        uint8_t*                             snapshot,
+                                        size_t                               snapshot_len,
+                                        uint8_t*                             buffer,
+                                        size_t                               len) noexcept;
+
+  /**
+    apply a delta created with sgl::serialize_delta() to menu. An empty delta, i.e. len == 0, is
+    valid and does nothing.
+    @param menu menu to apply the delta to
+    @param buffer delta
+    @param len size of the delta in bytes
+    @return sgl::error::no_error in case of success
+    @return sgl::error::schema_mismatch if the delta was created by a different menu type
+    @return sgl::error::invalid_value if the delta is malformed
+    @return the error of the first item which rejected its value otherwise
+   */
+  template <typename NameList, typename PageList>
+  sgl::error deserialize_delta(sgl::Menu<NameList, PageList>& menu,
+                               const uint8_t*                 buffer,
+                               size_t                         len) noexcept;
+  /// @}
+} // namespace sgl
+
+#include "sgl/impl/serialize_impl.hpp"
+#endif /* SGL_SERIALIZE_HPP */
@@ -0,0 +1,139 @@
+/**
+ * @file sgl/settings_journal.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains the sgl::SettingsJournal class, an append only store for the values of a
+ * menu's items.
+ *
+ * @version 0.1
+ * @date 2023-01-21
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_SETTINGS_JOURNAL_HPP
+#define SGL_SETTINGS_JOURNAL_HPP
+#include "sgl/serialize.hpp"
+
+namespace sgl {
+
+  /// @headerfile settings_journal.hpp "sgl/settings_journal.hpp"
+
+  /**
+    @brief Append only journal of the values of a menu, stored on a block device like a flash
+    memory.
+
+    Instead of rewriting the whole settings blob on every edit, the journal only appends the
+    values which changed since the last call to record(). Each entry consists of the delta
+    records of sgl::serialize_delta(), i.e. [item id][value] pairs, where the item id is the
+    compile time index of the item in the menu. When the current block is full, the journal is
+    compacted: the next block is erased and a full snapshot of the menu is written to it. Blocks
+    are used round robin, which spreads the erase cycles over the whole device.
+
+    Block layout:
+      - magic (4 bytes), sequence number (4 bytes)
+      - snapshot of the menu, see sgl::serialize()
+      - entries: [payload length (2 bytes)][CRC-16 (2 bytes)][delta records]
+
+    On boot, restore() picks the valid block with the highest sequence number, restores its
+    snapshot and replays the entries after it. Erased memory (0xFF) marks the end of the journal,
+    an entry with a wrong CRC is treated as a torn write and ends the replay as well.
+
+    ```cpp
+    sgl::FileBlockDevice device("settings.bin", 512, 4);
+    sgl::SettingsJournal journal(menu, device);
+    (void)journal.restore(menu); // on boot
+    ...
+    (void)journal.record(menu);  // after each edit, or periodically from tick()
+    ```
+
+    The block device type must provide the following member functions:
+
+    ```cpp
+    size_t     block_size() const noexcept;  // size of an erase block in bytes
+    size_t     block_count() const noexcept; // number of erase blocks, at least 2
+    sgl::error read(size_t block, size_t offset, uint8_t* data, size_t len) noexcept;
+    sgl::error write(size_t block, size_t offset, const uint8_t* data, size_t len) noexcept;
+    sgl::error erase(size_t block) noexcept;  // sets all bytes of block to 0xFF
+    ```
+
+    The journal only writes to erased memory, i.e. it never writes to a byte twice without erasing
+    the block in between.
+
+    @tparam Menu sgl::Menu type
+    @tparam BlockDevice block device type
+   */
+  template <typename Menu, typename BlockDevice>
+  class SettingsJournal {
+  public:
+    /// size of the header at the start of each block
+    static constexpr size_t block_header_size = 8;
+
+    /// size of the header in front of each entry
+    static constexpr size_t entry_header_size = 4;
+
+    /// minimum block size of the block device
+    static constexpr size_t min_block_size = block_header_size + sgl::snapshot_size_v<Menu> +
+                                             entry_header_size + sgl::max_delta_size_v<Menu>;
+
+    /**
+      construct a journal for menu on device. The current values of menu are used as the last
+      persisted state until restore() is called.
+      @param menu menu
+      @param device block device
+     */
+    SettingsJournal(const Menu& menu, BlockDevice& device) noexcept;
+
+    /**
+      restore the values of menu from the device. If the device contains no valid journal for this
+      menu type, the device is formatted with the current values of menu.
+      @param menu menu to restore
+      @return sgl::error::no_error if the menu was restored or the device was formatted
+      @return sgl::error::buffer_too_small if the block size is smaller than min_block_size
+      @return sgl::error::invalid_input if the device has less than 2 blocks
+      @return sgl::error::storage_error if the device failed
+      @return the error of the first item which rejected its value otherwise
+     */
+    sgl::error restore(Menu& menu) noexcept;
+
+    /**
+      append the values of menu which changed since the last call to record(), restore() or
+      compact(). Compacts the journal if the current block is full. Does nothing if no value
+      changed.
+      @param menu menu to record
+      @return sgl::error::no_error in case of success
+      @return sgl::error::storage_error if the device failed. The next call to record() writes a
+      full snapshot.
+     */
+    sgl::error record(const Menu& menu) noexcept;
+
+    /**
+      write a full snapshot of menu into the next block.
+      @param menu menu to record
+      @return sgl::error::no_error in case of success
+      @return sgl::error::storage_error if the device failed
+     */
+    sgl::error compact(const Menu& menu) noexcept;
+
+    /// @return index of the block currently written to
+    [[nodiscard]] size_t current_block() const noexcept;
+
+    /// @return number of bytes used in the current block
+    [[nodiscard]] size_t bytes_used() const noexcept;
+
+  private:
+    sgl::error write_block(size_t block) noexcept;
+    sgl::error replay(Menu& menu, size_t block) noexcept;
+
+    BlockDevice* device_;
+    uint32_t     sequence_{0};
+    size_t       block_{0};
+    size_t       offset_{0};
+    bool         needs_compaction_{true};
+    uint8_t      snapshot_[sgl::snapshot_size_v<Menu>]{};
+  };
+} // namespace sgl
+
+#include "sgl/impl/settings_journal_impl.hpp"
+#endif /* SGL_SETTINGS_JOURNAL_HPP */
@@ -0,0 +1,134 @@
+/**
+ * @file sgl/text_layout.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains the display width functions for UTF-8, UTF-16 and UTF-32 text, and
+ * sgl::TextLayout, which caches the width and truncation point of a line until its text changes.
+ *
+ * @version 0.1
+ * @date 2023-03-25
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_TEXT_LAYOUT_HPP
+#define SGL_TEXT_LAYOUT_HPP
+#include "sgl/string_view.hpp"
+
+#include <cstddef>
+
+namespace sgl {
+  /// @headerfile text_layout.hpp "sgl/text_layout.hpp"
+
+  /// maximum number of code units of one code point with character type CharT
+  template <typename CharT>
+  inline constexpr size_t max_code_units = sizeof(CharT) == 1 ? 4 : (sizeof(CharT) == 2 ? 2 : 1);
+
+  /**
+    decode the code point at pos. char text is decoded as UTF-8, char16_t text as UTF-16 and
+    char32_t text as UTF-32. Invalid or incomplete sequences decode to U+FFFD and consume one code
+    unit.
+    @param text text to decode
+    @param pos position of the first code unit, is advanced past the code point
+    @return code point
+   */
+  template <typename CharT>
+  [[nodiscard]] constexpr char32_t decode(sgl::string_view<CharT> text, size_t& pos) noexcept;
+
+  /**
+    get the number of display columns of a code point: 0 for combining marks and zero width
+    characters, 2 for East Asian wide and fullwidth characters, e.g. CJK ideographs, Hangul and
+    fullwidth forms, and 1 for everything else. The tables are a compact subset of the Unicode
+    East Asian Width and general category data, code points below U+0300 are looked up without a
+    table.
+    @param c code point
+    @return 0, 1 or 2
+   */
+  [[nodiscard]] constexpr size_t display_width(char32_t c) noexcept;
+
+  /**
+    get the number of display columns of a text.
+    @param text text
+    @return sum of the display widths of its code points
+   */
+  template <typename CharT>
+  [[nodiscard]] constexpr size_t display_width(sgl::string_view<CharT> text) noexcept;
+
+  /**
+    @brief Layout of one line of text in a fixed number of display columns.
+   */
+  struct LineLayout {
+    size_t width{0};         ///< display width of the visible text, without the ellipsis
+    size_t units{0};         ///< number of code units of the visible text
+    size_t scanned{0};       ///< number of code units the layout depends on
+    bool   truncated{false}; ///< true if the text did not fit and is followed by an ellipsis
+  };
+
+  /**
+    lay out a line of text in columns display columns. If the whole text fits, it is visible.
+    Otherwise, the visible text is the longest prefix which leaves room for an ellipsis of
+    ellipsis_width columns. A wide character is never split. Only the code units up to the first
+    character which does not fit are decoded.
+    @param text text
+    @param columns number of display columns
+    @param ellipsis_width display width of the ellipsis
+    @return LineLayout
+   */
+  template <typename CharT>
+  [[nodiscard]] constexpr LineLayout
+      layout_line(sgl::string_view<CharT> text, size_t columns, size_t ellipsis_width = 1) noexcept;
+
+  /**
+    @brief Cache of the layout of one line of text, e.g. of one item.
+
+    update() lays out a text with sgl::layout_line() and keeps a copy of the code units the layout
+    depends on, i.e. LineLayout::scanned code units. The next update() only compares the text with
+    this copy, and decodes it again only if it changed. The copy is limited to Capacity code units,
+    so that a line of N columns is cached if Capacity is at least (N + 1) * max_code_units<CharT>.
+    Longer layouts, e.g. of text with many combining marks, are recomputed on every update().
+
+    ```cpp
+    sgl::TextLayout<char, 84> layout;
+    layout.update(item.text(), 20); // true, decoded
+    layout.update(item.text(), 20); // false, cached
+    ```
+
+    @tparam CharT character type
+    @tparam Capacity maximum number of cached code units
+   */
+  template <typename CharT, size_t Capacity>
+  class TextLayout {
+  public:
+    static_assert(Capacity > 0, "sgl::TextLayout needs a capacity of at least one code unit");
+
+    /**
+      lay out text, unless it and the arguments are the same as in the last call.
+      @param text text
+      @param columns number of display columns
+      @param ellipsis_width display width of the ellipsis
+      @return true if the text was laid out again, false if the cached layout was kept
+     */
+    constexpr bool
+        update(sgl::string_view<CharT> text, size_t columns, size_t ellipsis_width = 1) noexcept;
+
+    /// @return layout of the last update()
+    [[nodiscard]] constexpr const LineLayout& layout() const noexcept { return layout_; }
+
+    /// make the next update() lay out its text again.
+    constexpr void invalidate() noexcept { valid_ = false; }
+
+  private:
+    /// @return true if text is laid out like the cached text
+    [[nodiscard]] constexpr bool matches(sgl::string_view<CharT> text) const noexcept;
+
+    CharT      units_[Capacity]{};
+    LineLayout layout_{};
+    size_t     columns_{0};
+    size_t     ellipsis_width_{0};
+    bool       valid_{false};
+  };
+} // namespace sgl
+
+#include "sgl/impl/text_layout_impl.hpp"
+#endif /* SGL_TEXT_LAYOUT_HPP */
@@ -0,0 +1,94 @@
+/**
+ * @file sgl/triple_buffer.hpp
+ * @author Pelé Constam (pelectron1602@gmail.com)
+ * This file contains sgl::TripleBuffer, a wait free single producer single consumer buffer for
+ * handing the latest version of a value from one thread to another.
+ *
+ * @version 0.1
+ * @date 2023-02-18
+ *
+ *          Copyright Pele Constam 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef SGL_TRIPLE_BUFFER_HPP
+#define SGL_TRIPLE_BUFFER_HPP
+#include <atomic>
+#include <cstdint>
+
+namespace sgl {
+
+  /// @headerfile triple_buffer.hpp "sgl/triple_buffer.hpp"
+
+  /**
+    @brief Wait free buffer which passes the latest value of T from one writer to one reader.
+
+    The buffer holds three instances of T. The writer owns the back buffer, the reader owns the
+    front buffer, and the third one is exchanged between them with a single atomic operation. Neither
+    side ever waits for the other one: publish() never blocks, and front() always returns a complete
+    value, i.e. the most recently published one at the time of the last update().
+
+    ```cpp
+    // writer thread
+    buffer.back() = compute();
+    buffer.publish();
+
+    // reader thread
+    buffer.update();
+    use(buffer.front());
+    ```
+
+    @tparam T value type
+   */
+  template <typename T>
+  class TripleBuffer {
+  public:
+    /// default construct all three values.
+    TripleBuffer() noexcept = default;
+
+    /// initialize all three values with value.
+    explicit TripleBuffer(const T& value) noexcept : buffers_{value, value, value} {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /// @return the value the writer may modify. Only call from the writer thread.
+    T& back() noexcept { return buffers_[back_]; }
+
+    /// make the back buffer visible to the reader. Only call from the writer thread.
+    void publish() noexcept {
+      const uint8_t prev =
+          state_.exchange(static_cast<uint8_t>(back_ | dirty), std::memory_order_acq_rel);
+      back_ = prev & index_mask;
+    }
+
+    /**
+      fetch the most recently published value, if there is one. Only call from the reader thread.
+      @return true if a new value was published since the last call
+     */
+    bool update() noexcept {
+      if ((state_.load(std::memory_order_relaxed) & dirty) == 0) {
+        return false;
+      }
+      const uint8_t prev = state_.exchange(front_, std::memory_order_acq_rel);
+      front_ = prev & index_mask;
+      return true;
+    }
+
+    /// @return the value the reader may access. Only call from the reader thread.
+    const T& front() const noexcept { return buffers_[front_]; }
+
+  private:
+    static constexpr uint8_t index_mask = 0x03;
+    static constexpr uint8_t dirty = 0x04;
+
+    T buffers_[3]{};
+
+    // the writer and reader indices are on separate cache lines, so they do not contend.
+    alignas(64) uint8_t back_{0};
+    alignas(64) std::atomic<uint8_t> state_{1};
+    alignas(64) uint8_t front_{2};
+  };
+} // namespace sgl
+#endif /* SGL_TRIPLE_BUFFER_HPP */
@@ -8,6 +8,7 @@
 #include "sgl/limits.hpp"
 
 #include <type_traits>
+#include <utility>
 
 namespace sgl {
   ///@cond
@@ -57,16 +58,17 @@ namespace sgl {
   template <typename List>
   inline constexpr size_t list_size_v = list_size<List>::value;
 
-  template <typename T, typename T1, typename... Ts>
-  constexpr size_t index_of_impl(size_t i = 0) {
-    if constexpr (std::is_same_v<T, T1>) {
-      return i;
-    }
-    if constexpr (sizeof...(Ts) == 0) {
-      return sgl::numeric_limits<size_t>::max();
-    } else {
-      return index_of_impl<T, Ts...>(i + 1);
+  // index of the first T in Ts..., or size_t max. Evaluated as a loop over a flat array instead
+  // of recursing once per element.
+  template <typename T, typename... Ts>
+  constexpr size_t index_of_impl() noexcept {
+    constexpr bool matches[] = {std::is_same_v<T, Ts>..., false};
+    for (size_t i = 0; i < sizeof...(Ts); ++i) {
+      if (matches[i]) {
+        return i;
+      }
     }
+    return sgl::numeric_limits<size_t>::max();
   }
 
   template <typename T, typename List>
@@ -124,30 +126,28 @@ namespace sgl {
   template <size_t Size, typename List>
   struct type_at;
 
-  template <size_t Size>
-  struct index_out_of_range {
-    static_assert(Size != 0, "index out of range");
+  // type_at is resolved by overload resolution instead of recursion: indexed_types derives from
+  // indexed_type<I, T> for every element, and select_type<I> deduces T from the only base with
+  // index I.
+  template <size_t I, typename T>
+  struct indexed_type {
+    using type = T;
   };
 
-  template <size_t, typename...>
-  struct type_at_impl;
+  template <typename Indices, typename... Ts>
+  struct indexed_types;
 
-  template <size_t Size, typename T, typename... Ts>
-  struct type_at_impl<Size, T, Ts...> : type_at_impl<Size - 1, Ts...> {};
-
-  template <typename T, typename... Ts>
-  struct type_at_impl<0, T, Ts...> {
-    using type = T;
-  };
+  template <size_t... I, typename... Ts>
+  struct indexed_types<std::index_sequence<I...>, Ts...> : indexed_type<I, Ts>... {};
 
-  template <size_t Size>
-  struct type_at_impl<Size> {
-    static_assert(Size < 0, "type index out of range");
-  };
+  template <size_t I, typename T>
+  indexed_type<I, T> select_type(const indexed_type<I, T>&) noexcept;
 
   template <size_t Size, typename... Ts>
   struct type_at<Size, type_list<Ts...>> {
-    using type = typename type_at_impl<Size, Ts...>::type;
+    static_assert(Size < sizeof...(Ts), "type index out of range");
+    using type = typename decltype(select_type<Size>(
+        std::declval<indexed_types<std::index_sequence_for<Ts...>, Ts...>>()))::type;
   };
 
   template <size_t Size, typename List>
@@ -181,25 +181,21 @@ namespace sgl {
   static_assert(
       std::is_same_v<push_back_t<double, type_list<int, char>>, type_list<int, char, double>>);
 
-  template <typename List, size_t I>
+  template <typename List, typename Indices>
   struct pop_back_impl;
 
-  template <typename T, typename... Ts, size_t I>
-  struct pop_back_impl<type_list<T, Ts...>, I> {
-    using type = push_front_t<T, typename pop_back_impl<type_list<Ts...>, I - 1>::type>;
-  };
-
-  template <typename T>
-  struct pop_back_impl<type_list<T>, 1> {
-    using type = type_list<>;
+  template <typename... Ts, size_t... I>
+  struct pop_back_impl<type_list<Ts...>, std::index_sequence<I...>> {
+    using type = type_list<type_at_t<I, type_list<Ts...>>...>;
   };
 
   template <typename List>
   struct pop_back;
 
-  template <typename... Ts>
-  struct pop_back<type_list<Ts...>> {
-    using type = typename pop_back_impl<type_list<Ts...>, sizeof...(Ts)>::type;
+  template <typename T, typename... Ts>
+  struct pop_back<type_list<T, Ts...>> {
+    using type =
+        typename pop_back_impl<type_list<T, Ts...>, std::make_index_sequence<sizeof...(Ts)>>::type;
   };
 
   /// @brief pop last element of list and return the new list
@@ -257,15 +253,34 @@ namespace sgl {
   template <typename T, typename List>
   inline constexpr bool contains_v = contains<T, List>::value;
 
-  template <typename... Ts>
-  struct all_unique;
-
+  // all_unique derives unique_set from one unique_slot<I, T> per element. A T which occurs more
+  // than once makes the conversion to unique_tag<T> ambiguous, i.e. one conversion check per
+  // element instead of comparing every pair of elements.
   template <typename T>
-  struct all_unique<T> : std::true_type {};
+  struct unique_tag {};
 
-  template <typename T, typename... Rest>
-  struct all_unique<T, Rest...> {
-    static constexpr bool value = ((!std::is_same_v<T, Rest>)&&...) && all_unique<Rest...>::value;
+  template <size_t I, typename T>
+  struct unique_slot : unique_tag<T> {};
+
+  template <typename Indices, typename... Ts>
+  struct unique_set;
+
+  template <size_t... I, typename... Ts>
+  struct unique_set<std::index_sequence<I...>, Ts...> : unique_slot<I, Ts>... {};
+
+  template <typename T, typename Set>
+  auto is_unique_in(int)
+      -> decltype(static_cast<const unique_tag<T>*>(static_cast<const Set*>(nullptr)),
+                  std::true_type{});
+
+  template <typename T, typename Set>
+  std::false_type is_unique_in(...);
+
+  template <typename... Ts>
+  struct all_unique {
+    static constexpr bool value =
+        (decltype(is_unique_in<Ts, unique_set<std::index_sequence_for<Ts...>, Ts...>>(0))::value &&
+         ...);
   };
 
   template <typename... Ts>
@@ -0,0 +1,14 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Explicit instantiations of the templates declared extern in sgl/instantiate.hpp. Compiled into
+// the sgl static library if the instantiate meson option is set.
+#include "sgl.hpp"
+
+#if SGL_INSTANTIATE != 1
+  #error src/instantiate.cpp must be compiled with SGL_INSTANTIATE=1
+#endif
+
+SGL_INSTANTIATE_ALL()
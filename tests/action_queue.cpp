@@ -0,0 +1,149 @@
+#include "sgl.hpp"
+#include "sgl/action_queue.hpp"
+
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <thread>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  using Button = sgl::Button<20, char>;
+
+  sgl::error start(Button& button) noexcept;
+
+  auto make_menu() noexcept {
+    return sgl::Menu(NAME("main") <<= sgl::Page(
+                         NAME("start") <<= Button(
+                             "start"_sv,
+                             [](Button& button) noexcept { return start(button); },
+                             [](Button&) noexcept {})));
+  }
+
+  using Menu = decltype(make_menu());
+
+  Menu* menu_ptr = nullptr;
+  int   calibrations = 0;
+
+  sgl::error start(Button& button) noexcept {
+    static_cast<void>(button.set_text("running"_sv));
+    return menu_ptr->post(
+        []() noexcept {
+          ++calibrations;
+          return sgl::error::no_error;
+        },
+        [&button](sgl::error ec) noexcept {
+          static_cast<void>(button.set_text(ec == sgl::error::no_error ? "done"_sv : "failed"_sv));
+        });
+  }
+} // namespace
+
+TEST_CASE("ActionQueue") {
+  sgl::ActionQueue<4> queue;
+  int                 results[8]{};
+  int                 n = 0;
+
+  SECTION("post, run and complete in order") {
+    for (int i = 0; i < 4; ++i) {
+      REQUIRE(queue.post([i]() noexcept { return i == 2 ? sgl::error::invalid_value
+                                                        : sgl::error::no_error; },
+                         [&results, &n](sgl::error ec) noexcept {
+                           results[n++] = static_cast<int>(ec);
+                         }) == sgl::error::no_error);
+    }
+    REQUIRE(queue.pending() == 4);
+    REQUIRE(queue.post([]() noexcept { return sgl::error::no_error; }) == sgl::error::queue_full);
+
+    REQUIRE(queue.complete() == 0);
+    REQUIRE(queue.run(3) == 3);
+    REQUIRE(queue.pending() == 4);
+    REQUIRE(queue.complete() == 3);
+    REQUIRE(queue.pending() == 1);
+    REQUIRE(n == 3);
+    REQUIRE(results[0] == 0);
+    REQUIRE(results[2] == static_cast<int>(sgl::error::invalid_value));
+
+    // the ring wraps around
+    REQUIRE(queue.post([]() noexcept { return sgl::error::no_error; }) == sgl::error::no_error);
+    REQUIRE(queue.run() == 2);
+    REQUIRE(queue.complete() == 2);
+    REQUIRE(queue.pending() == 0);
+    REQUIRE(n == 4);
+  }
+
+  SECTION("disabled queue") {
+    sgl::ActionQueue<0> disabled;
+    REQUIRE(disabled.post([]() noexcept { return sgl::error::no_error; }) ==
+            sgl::error::queue_full);
+    REQUIRE(disabled.run() == 0);
+  }
+
+  SECTION("worker thread") {
+    constexpr int    count = 10000;
+    std::atomic_bool stop{false};
+    int              executed = 0;
+    int              completed = 0;
+
+    std::thread worker([&queue, &stop] {
+      while (!stop.load()) {
+        queue.run();
+      }
+      queue.run();
+    });
+    for (int i = 0; i < count;) {
+      if (queue.post(
+              [&executed]() noexcept {
+                ++executed;
+                return sgl::error::no_error;
+              },
+              [&completed](sgl::error) noexcept { ++completed; }) == sgl::error::no_error) {
+        ++i;
+      }
+      queue.complete();
+    }
+    while (queue.pending() != 0) {
+      queue.complete();
+    }
+    stop = true;
+    worker.join();
+    REQUIRE(completed == count);
+    REQUIRE(executed == count);
+  }
+}
+
+TEST_CASE("Menu::post") {
+  auto menu = make_menu();
+  menu_ptr = &menu;
+  calibrations = 0;
+  auto& button = menu[NAME("main")][NAME("start")];
+
+  REQUIRE(menu.handle_input(sgl::input::enter) == sgl::error::no_error);
+  REQUIRE(sgl::string_view<char>(button.text()) == "running"_sv);
+  REQUIRE(calibrations == 0);
+  REQUIRE(menu.actions().pending() == 1);
+
+  SECTION("tick runs and completes") {
+    menu.tick();
+    REQUIRE(calibrations == 1);
+    REQUIRE(menu.actions().pending() == 0);
+    REQUIRE(sgl::string_view<char>(button.text()) == "done"_sv);
+  }
+
+  SECTION("tick_for runs and completes within the budget") {
+    REQUIRE(menu.tick_for(0, [] { return 0; }) == 1);
+    REQUIRE(calibrations == 1);
+    REQUIRE(menu.actions().pending() == 0);
+    REQUIRE(sgl::string_view<char>(button.text()) == "done"_sv);
+  }
+
+  SECTION("threaded queue is only completed by tick") {
+    menu.actions().set_threaded(true);
+    menu.tick();
+    REQUIRE(calibrations == 0);
+    REQUIRE(menu.actions().run() == 1);
+    REQUIRE(sgl::string_view<char>(button.text()) == "running"_sv);
+    menu.tick();
+    REQUIRE(sgl::string_view<char>(button.text()) == "done"_sv);
+  }
+  menu_ptr = nullptr;
+}
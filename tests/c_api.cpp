@@ -0,0 +1,108 @@
+#include "sgl.hpp"
+#include "sgl/c_api.hpp"
+
+#include <catch2/catch.hpp>
+#include <string>
+
+namespace {
+  constexpr auto make_menu() noexcept {
+    return sgl::Menu(NAME("settings") <<= sgl::Page(NAME("a") <<= sgl::numeric<12, char>(0, 1),
+                                                    NAME("b") <<= sgl::numeric<12, char>(0, 1),
+                                                    NAME("c") <<= sgl::numeric<12, char>(0, 1),
+                                                    NAME("on") <<= sgl::Boolean(true)),
+                     NAME("info") <<= sgl::Page(NAME("enabled") <<= sgl::Boolean(false)));
+  }
+
+  std::string str(const char* data, size_t size) { return std::string(data, size); }
+} // namespace
+
+SGL_DEFINE_C_API(make_menu())
+
+TEST_CASE("c_api") {
+  sgl_menu* menu = sgl_menu_create();
+  REQUIRE(menu != nullptr);
+
+  SECTION("current page") {
+    sgl_page page;
+    sgl_current_page(menu, &page);
+    REQUIRE(str(page.name, page.name_size) == "settings");
+    REQUIRE(page.index == 0);
+    REQUIRE(page.size == 4);
+    REQUIRE(page.current_item == 0);
+    REQUIRE(page.edit_mode == 0);
+  }
+
+  SECTION("render") {
+    sgl_line lines[3];
+    REQUIRE(sgl_render(menu, lines, 0, 3) == 3);
+    REQUIRE(str(lines[0].name, lines[0].name_size) == "a");
+    REQUIRE(str(lines[0].text, lines[0].text_size) == "0");
+    REQUIRE(lines[0].flags == SGL_LINE_CURRENT);
+    REQUIRE(lines[1].flags == 0);
+    REQUIRE(lines[2].index == 2);
+
+    // the end of the page limits the number of lines
+    REQUIRE(sgl_render(menu, lines, 2, 3) == 2);
+    REQUIRE(str(lines[1].name, lines[1].name_size) == "on");
+    REQUIRE(str(lines[1].text, lines[1].text_size) == "TRUE");
+    REQUIRE(sgl_render(menu, lines, 4, 3) == 0);
+  }
+
+  SECTION("handle inputs") {
+    const sgl_input inputs[] = {static_cast<sgl_input>(sgl::input::down),
+                                static_cast<sgl_input>(sgl::input::enter),
+                                static_cast<sgl_input>(sgl::input::up),
+                                static_cast<sgl_input>(sgl::input::up)};
+    int             errors[4];
+    REQUIRE(sgl_handle_inputs(menu, inputs, 4, errors) == 0);
+    REQUIRE(errors[3] == 0);
+    REQUIRE(inputs[0] == SGL_INPUT_DOWN);
+    REQUIRE(inputs[1] == SGL_INPUT_ENTER);
+
+    sgl_line lines[2];
+    REQUIRE(sgl_render(menu, lines, 0, 2) == 2);
+    REQUIRE(lines[0].flags == 0);
+    REQUIRE(lines[1].flags == (SGL_LINE_CURRENT | SGL_LINE_EDIT));
+    REQUIRE(str(lines[1].text, lines[1].text_size) == "2");
+  }
+
+  SECTION("get and set") {
+    char   buffer[16];
+    size_t written = 0;
+    REQUIRE(sgl_set(menu, "settings/b", "42") == 0);
+    REQUIRE(sgl_get(menu, "settings/b", buffer, sizeof(buffer), &written) == 0);
+    REQUIRE(written == 2);
+    REQUIRE(std::string(buffer) == "42");
+    REQUIRE(sgl_get(menu, "settings/b", buffer, 2, &written) == SGL_ERROR_BUFFER_TOO_SMALL);
+    REQUIRE(buffer[0] == '\0');
+    REQUIRE(sgl_set(menu, "settings/x", "1") == SGL_ERROR_ITEM_NOT_FOUND);
+
+    const char* paths[] = {"settings/a", "nowhere/a", "info/enabled"};
+    const char* values[] = {"7", "1", "TRUE"};
+    int         errors[3];
+    REQUIRE(sgl_set_values(menu, paths, values, 3, errors) == 1);
+    REQUIRE(errors[0] == 0);
+    REQUIRE(errors[1] == SGL_ERROR_PAGE_NOT_FOUND);
+    REQUIRE(errors[2] == 0);
+    REQUIRE(sgl_get(menu, "info/enabled", buffer, sizeof(buffer), nullptr) == 0);
+    REQUIRE(std::string(buffer) == "TRUE");
+  }
+
+  SECTION("instances are independent") {
+    alignas(std::max_align_t) unsigned char storage[1024];
+    REQUIRE(sgl_menu_size() <= sizeof(storage));
+    REQUIRE(sgl_menu_init(storage + 1) == nullptr);
+    sgl_menu* other = sgl_menu_init(storage);
+    REQUIRE(other != nullptr);
+
+    REQUIRE(sgl_set(menu, "settings/a", "5") == 0);
+    char buffer[16];
+    REQUIRE(sgl_get(other, "settings/a", buffer, sizeof(buffer), nullptr) == 0);
+    REQUIRE(std::string(buffer) == "0");
+    sgl_menu_deinit(other);
+  }
+
+  sgl_menu_destroy(menu);
+  // like free(), destroying NULL does nothing
+  sgl_menu_destroy(nullptr);
+}
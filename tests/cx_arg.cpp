@@ -4,6 +4,7 @@
 //          https://www.boost.org/LICENSE_1_0.txt)
 //
 #include "sgl/cx_arg.hpp"
+#include "sgl/numeric.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -38,3 +39,10 @@ TEST_CASE("cx_arg float test") {
 
   STATIC_REQUIRE(f1.string == f3.string);
 }
+
+TEST_CASE("cx_arg with wide character numeric") {
+  static constexpr auto arg = 62.53_double;
+  sgl::Numeric<arg.string.capacity(), char16_t, double> num(arg, 1.0);
+  REQUIRE(num.get_value() == arg.value);
+  REQUIRE(sgl::string_view<char16_t>(num.text()) == sgl::string_view<char16_t>(u"62.53"));
+}
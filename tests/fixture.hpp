@@ -0,0 +1,46 @@
+#ifndef SGL_TESTS_FIXTURE_HPP
+#define SGL_TESTS_FIXTURE_HPP
+#include "sgl.hpp"
+
+#include <utility>
+
+/// The menu shared by the reflection, path, menu state, serialization and journal tests: a
+/// settings page and an info page which link to each other. Each test adds the items it needs.
+namespace fixture {
+  enum class Mode { slow, normal, fast };
+
+  inline constexpr auto settings = NAME("settings");
+  inline constexpr auto info = NAME("info");
+
+  // NAME() can not be used in a template.
+  inline constexpr auto enabled = NAME("enabled");
+  inline constexpr auto mode = NAME("mode");
+  inline constexpr auto to_info = NAME("to info");
+  inline constexpr auto to_settings = NAME("to settings");
+
+  /// the settings page: "enabled", "mode", the named items and "to info".
+  template <typename... NamedItems>
+  constexpr auto settings_page(NamedItems&&... named_items) noexcept {
+    return sgl::Page(enabled <<= sgl::Boolean(true),
+                     mode <<= sgl::make_enum(
+                         Mode::slow, "slow", Mode::normal, "normal", Mode::fast, "fast"),
+                     std::forward<NamedItems>(named_items)...,
+                     to_info <<= sgl::pagelink(info, "info"));
+  }
+
+  /// the info page: "to settings" and the named items.
+  template <typename... NamedItems>
+  constexpr auto info_page(NamedItems&&... named_items) noexcept {
+    return sgl::Page(to_settings <<= sgl::pagelink(settings, "settings"),
+                     std::forward<NamedItems>(named_items)...);
+  }
+
+  /// the menu, starts on the settings page.
+  template <typename SettingsPage, typename InfoPage>
+  constexpr auto make_menu(SettingsPage&& settings_page, InfoPage&& info_page) noexcept {
+    return sgl::Menu(settings <<= std::forward<SettingsPage>(settings_page),
+                     info <<= std::forward<InfoPage>(info_page));
+  }
+} // namespace fixture
+
+#endif /* SGL_TESTS_FIXTURE_HPP */
@@ -0,0 +1,167 @@
+#include "sgl.hpp"
+#include "sgl/graph.hpp"
+
+#include <catch2/catch.hpp>
+#include <limits>
+#include <string>
+
+namespace {
+  // index of the block glyph at position i of a char sparkline
+  int glyph(const std::string& text, size_t i) {
+    return static_cast<unsigned char>(text[3 * i + 2]) - 0x81;
+  }
+
+  template <typename Graph>
+  std::string str(const Graph& g) {
+    return std::string(g.text().data(), g.text().size());
+  }
+} // namespace
+
+TEST_CASE("Graph") {
+  auto g = sgl::graph<4, 16, char>(0, 8);
+  REQUIRE(g.size() == 0);
+  REQUIRE(g.text().size() == 0);
+  REQUIRE(g.min() == 0);
+  REQUIRE(g.mean() == 0);
+
+  SECTION("sparkline and value") {
+    g.push(0);
+    g.push(4);
+    REQUIRE(str(g) == "\xE2\x96\x81\xE2\x96\x85 4");
+    g.push(7);
+    g.push(8);
+    REQUIRE(g.text().size() == 12 + 2);
+    REQUIRE(glyph(str(g), 0) == 0);
+    REQUIRE(glyph(str(g), 1) == 4);
+    REQUIRE(glyph(str(g), 2) == 7);
+    REQUIRE(glyph(str(g), 3) == 7);
+
+    // full: the glyphs shift left
+    g.push(-3);
+    const auto text = str(g);
+    REQUIRE(text.size() == 12 + 3);
+    REQUIRE(glyph(text, 0) == 4);
+    REQUIRE(glyph(text, 2) == 7);
+    REQUIRE(glyph(text, 3) == 0);
+    REQUIRE(text.substr(12) == " -3");
+  }
+
+  SECTION("statistics") {
+    const int values[] = {5, 1, 7, 3, 2, 2, 9, 0, 4};
+    for (size_t n = 0; n < sizeof(values) / sizeof(values[0]); ++n) {
+      g.push(values[n]);
+      // compare with a full scan of the last 4 values
+      const size_t first = n >= 3 ? n - 3 : 0;
+      int          lo = values[first], hi = values[first], sum = 0;
+      for (size_t k = first; k <= n; ++k) {
+        lo = values[k] < lo ? values[k] : lo;
+        hi = values[k] > hi ? values[k] : hi;
+        sum += values[k];
+      }
+      REQUIRE(g.min() == lo);
+      REQUIRE(g.max() == hi);
+      REQUIRE(g.mean() == sum / static_cast<int>(n - first + 1));
+      REQUIRE(g.latest() == values[n]);
+      REQUIRE(g.sample(0) == values[first]);
+    }
+    REQUIRE(g.size() == 4);
+  }
+
+  SECTION("set range and clear") {
+    g.push(2);
+    g.push(6);
+    g.set_range(0, 4);
+    REQUIRE(glyph(str(g), 0) == 4);
+    REQUIRE(glyph(str(g), 1) == 7);
+    REQUIRE(str(g).substr(6) == " 6");
+    g.clear();
+    REQUIRE(g.size() == 0);
+    REQUIRE(g.text().size() == 0);
+    g.push(1);
+    REQUIRE(g.min() == 1);
+  }
+
+  SECTION("value is left out if it does not fit") {
+    auto small = sgl::graph<2, 7, char>(0, 8);
+    small.push(1);
+    small.push(100);
+    REQUIRE(small.text().size() == 6);
+    small.push(3);
+    REQUIRE(str(small).substr(6) == "");
+  }
+
+  SECTION("levels are rounded down") {
+    g.set_range(0, 13);
+    for (int v = 1; v < 13; ++v) {
+      g.push(v);
+      REQUIRE(glyph(str(g), g.size() - 1) == v * 8 / 13);
+    }
+  }
+
+  SECTION("full range of the value type") {
+    auto full = sgl::graph<3, 9, char>(std::numeric_limits<int>::min(),
+                                       std::numeric_limits<int>::max());
+    full.push(std::numeric_limits<int>::min() + 1);
+    full.push(0);
+    full.push(std::numeric_limits<int>::max() - 1);
+    REQUIRE(glyph(str(full), 0) == 0);
+    REQUIRE(glyph(str(full), 1) == 4);
+    REQUIRE(glyph(str(full), 2) == 7);
+
+    auto wide = sgl::graph<1, 3, char>(std::numeric_limits<long long>::min(),
+                                       std::numeric_limits<long long>::max());
+    wide.push(std::numeric_limits<long long>::max() / 4 + 1);
+    REQUIRE(glyph(str(wide), 0) == 5);
+  }
+
+  SECTION("floating point") {
+    auto f = sgl::graph<3, 16, char>(0.0f, 1.0f);
+    f.push(0.5f);
+    f.push(0.25f);
+    REQUIRE(glyph(str(f), 0) == 4);
+    REQUIRE(glyph(str(f), 1) == 2);
+    REQUIRE(str(f).substr(6) == " 0.25");
+    REQUIRE(f.mean() == Approx(0.375f));
+  }
+
+  SECTION("an outlier does not distort the mean after it left the window") {
+    auto d = sgl::graph<4, 64, char>(0.0, 10.0);
+    d.push(1e17);
+    for (int i = 0; i < 4; ++i) {
+      d.push(1.0);
+    }
+    REQUIRE(d.mean() == 1.0);
+    for (int i = 0; i < 8; ++i) {
+      d.push(0.5);
+      d.push(1e17);
+      d.push(-1e17);
+    }
+    for (int i = 0; i < 4; ++i) {
+      d.push(2.0);
+    }
+    REQUIRE(d.mean() == 2.0);
+  }
+
+  SECTION("wide characters") {
+    auto w = sgl::graph<3, 8, char32_t>(0, 8);
+    w.push(4);
+    w.push(2);
+    REQUIRE(w.text()[0] == U'\u2585');
+    REQUIRE(w.text()[1] == U'\u2583');
+    REQUIRE(w.text()[2] == U' ');
+    REQUIRE(w.text()[3] == U'2');
+  }
+}
+
+TEST_CASE("Graph in menu") {
+  auto menu =
+      sgl::Menu(NAME("page") <<= sgl::Page(NAME("graph") <<= sgl::graph<8, 32, char>(0, 100)));
+  auto& g = menu[NAME("page")][NAME("graph")];
+  g.set_tick_handler([](auto& graph) noexcept { graph.push(static_cast<int>(graph.size()) * 10); });
+  for (int i = 0; i < 10; ++i) {
+    menu.tick();
+  }
+  REQUIRE(g.size() == 8);
+  REQUIRE(g.latest() == 80);
+  REQUIRE(g.min() == 20);
+}
@@ -0,0 +1,117 @@
+#include "sgl.hpp"
+#include "sgl/localized.hpp"
+#include "sgl/menu_state.hpp"
+#include "sgl/serialize.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  enum class str : size_t { volume, mute, off, on, low, mid, high, count };
+
+  constexpr sgl::StringTable<char, 3, static_cast<size_t>(str::count)> strings{{
+      {"Volume"_sv, "Mute"_sv, "Off"_sv, "On"_sv, "Low"_sv, "Mid"_sv, "High"_sv},
+      {"Lautstaerke"_sv, "Stumm"_sv, "Aus"_sv, "Ein"_sv, "Leise"_sv, "Mittel"_sv, "Laut"_sv},
+      {"Volume"_sv, "Muet"_sv, "Non"_sv, "Oui"_sv, "Bas"_sv, "Moyen"_sv, "Haut"_sv},
+  }};
+
+  enum class Level { low, mid, high };
+} // namespace
+
+TEST_CASE("Locale") {
+  sgl::Locale locale(strings);
+  REQUIRE(locale.languages() == 3);
+  REQUIRE(locale.size() == 7);
+  REQUIRE(locale.get(str::mute) == "Mute"_sv);
+  REQUIRE(locale.get(100) == ""_sv);
+
+  REQUIRE(locale.set_language(1) == sgl::error::no_error);
+  REQUIRE(locale.language() == 1);
+  REQUIRE(locale.generation() == 1);
+  REQUIRE(locale.get(str::mute) == "Stumm"_sv);
+  REQUIRE(locale.set_language(3) == sgl::error::out_of_range);
+  REQUIRE(locale.language() == 1);
+  // switching to the current language is not a switch
+  REQUIRE(locale.set_language(1) == sgl::error::no_error);
+  REQUIRE(locale.generation() == 1);
+  REQUIRE(strings.get(2, 1) == "Muet"_sv);
+}
+
+TEST_CASE("Localized items") {
+  sgl::Locale locale(strings);
+  const Level levels[] = {Level::low, Level::mid, Level::high};
+  auto        menu = sgl::Menu(
+      NAME("audio") <<= sgl::Page(
+          NAME("title") <<= sgl::localized_text<12>(locale, str::volume),
+          NAME("mute") <<= sgl::localized_enum<12>(locale, {false, true}, str::off),
+          NAME("level") <<= sgl::localized_enum<12>(locale, levels, str::low, 1)),
+      NAME("other") <<= sgl::Page(NAME("title") <<= sgl::localized_text<12>(locale, str::mute)));
+
+  // the texts are rendered when the menu is constructed
+  REQUIRE(menu.item_text(0) == "Volume"_sv);
+  REQUIRE(menu.item_text(1) == "Off"_sv);
+  REQUIRE(menu.item_text(2) == "Mid"_sv);
+
+  SECTION("language switch re-renders the current page on refresh") {
+    REQUIRE(locale.set_language(1) == sgl::error::no_error);
+    REQUIRE(menu.item_text(0) == "Volume"_sv);
+    menu.refresh();
+    REQUIRE(menu.item_text(0) == "Lautstaerke"_sv);
+    REQUIRE(menu.item_text(1) == "Aus"_sv);
+    REQUIRE(menu.item_text(2) == "Mittel"_sv);
+
+    // other pages are rendered when they are entered
+    REQUIRE(menu[NAME("other")][NAME("title")].text() == sgl::static_string<char, 12>("Mute"));
+    REQUIRE(menu.set_current_page(1) == sgl::error::no_error);
+    REQUIRE(menu.item_text(0) == "Stumm"_sv);
+  }
+
+  SECTION("values") {
+    auto& level = menu[NAME("audio")][NAME("level")];
+    REQUIRE(level.get_value() == Level::mid);
+    REQUIRE(level.set_value(Level::high) == sgl::error::no_error);
+    REQUIRE(menu.item_text(2) == "High"_sv);
+    REQUIRE(level.handle_input(sgl::input::up) == sgl::error::no_error);
+    REQUIRE(level.get_value() == Level::low);
+
+    auto& mute = menu[NAME("audio")][NAME("mute")];
+    REQUIRE(mute.handle_input(sgl::input::down) == sgl::error::no_error);
+    REQUIRE(mute.get_value());
+    REQUIRE(menu.item_text(1) == "On"_sv);
+  }
+
+  SECTION("loading a state refreshes the current page") {
+    const sgl::MenuState<decltype(menu)> state(menu);
+    REQUIRE(locale.set_language(1) == sgl::error::no_error);
+    REQUIRE(state.load(menu) == sgl::error::no_error);
+    REQUIRE(menu.item_text(0) == "Lautstaerke"_sv);
+    REQUIRE(menu.item_text(2) == "Mittel"_sv);
+  }
+
+  SECTION("set by path in the current language") {
+    REQUIRE(locale.set_language(2) == sgl::error::no_error);
+    REQUIRE(menu.set("audio/level"_sv, "Haut"_sv) == sgl::error::no_error);
+    REQUIRE(menu[NAME("audio")][NAME("level")].get_value() == Level::high);
+    REQUIRE(menu.item_text(2) == "Haut"_sv);
+    REQUIRE(menu.set("audio/level"_sv, "High"_sv) == sgl::error::invalid_value);
+  }
+}
+
+TEST_CASE("Localized enum snapshot does not depend on the language") {
+  sgl::Locale locale(strings);
+  auto        make = [&locale] {
+    return sgl::Menu(NAME("audio") <<= sgl::Page(
+                         NAME("mute") <<= sgl::localized_enum<12>(locale, {false, true}, str::off)));
+  };
+  auto menu = make();
+  REQUIRE(menu[NAME("audio")][NAME("mute")].set_value(true) == sgl::error::no_error);
+  uint8_t    buffer[64];
+  const auto res = sgl::serialize(menu, buffer, sizeof(buffer));
+  REQUIRE(res.ec == sgl::error::no_error);
+
+  REQUIRE(locale.set_language(1) == sgl::error::no_error);
+  auto other = make();
+  REQUIRE(sgl::deserialize(other, buffer, res.size) == sgl::error::no_error);
+  REQUIRE(other.item_text(0) == "Ein"_sv);
+}
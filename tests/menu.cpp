@@ -190,6 +190,25 @@ TEST_CASE("sgl::Menu") {
     REQUIRE(input_handled2);
     REQUIRE_FALSE(input_handled1);
   }
+  SECTION("find_page(), visit_page() and set_current_page(string_view)") {
+    REQUIRE(menu.find_page("page1"_sv) == 0);
+    REQUIRE(menu.find_page("page2"_sv) == 1);
+    REQUIRE(menu.find_page("page3"_sv) == menu.size());
+
+    size_t item_index = 0;
+    REQUIRE(menu.visit_page("page2"_sv, [&item_index](const auto& page) {
+      item_index = page.find_item("int item 2"_sv);
+    }) == sgl::error::no_error);
+    REQUIRE(item_index == 4);
+    REQUIRE(menu.visit_page("page3"_sv, [](auto&) {}) == sgl::error::page_not_found);
+
+    REQUIRE(menu.set_current_page("page2"_sv) == sgl::error::no_error);
+    REQUIRE(menu.current_page_index() == 1);
+    REQUIRE(page1_exited);
+    REQUIRE(page2_entered);
+    REQUIRE(menu.set_current_page("page3"_sv) == sgl::error::page_not_found);
+    REQUIRE(menu.current_page_index() == 1);
+  }
   SECTION("get_page() and operator[]") {
     REQUIRE(&menu[page1] == &menu.get_page<0>());
     REQUIRE(&menu[page2] == &menu.get_page<1>());
@@ -250,4 +269,53 @@ TEST_CASE("sgl::Menu") {
     REQUIRE(p1_visited);
     REQUIRE(p2_visited);
   }
+  SECTION("post() without an action queue") {
+    // SGL_ACTION_QUEUE_SIZE is 0 by default, see action_queue.cpp for the enabled queue.
+    STATIC_REQUIRE(decltype(menu)::ActionQueue_t::capacity == 0);
+    REQUIRE(menu.post([]() noexcept { return sgl::error::no_error; }) == sgl::error::queue_full);
+    REQUIRE(menu.actions().pending() == 0);
+    menu.tick();
+  }
+
+  SECTION("tick_for") {
+    constexpr size_t num_items = 12;
+    int              counts[num_items]{};
+    size_t           k = 0;
+    menu.for_each_page([&counts, &k](auto& page) {
+      page.for_each_item([&counts, &k](auto& item) {
+        item.set_tick_handler([count = &counts[k]](auto&) noexcept { ++*count; });
+        ++k;
+      });
+    });
+    REQUIRE(k == num_items);
+    auto all_equal = [&counts](int n) {
+      for (auto c : counts) {
+        if (c != n) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    // time does not advance: one full round, no item twice
+    REQUIRE(menu.tick_for(10, [] { return 0; }) == num_items);
+    REQUIRE(all_equal(1));
+
+    // no budget: one item per call, round robin over both pages
+    for (size_t i = 0; i < num_items; ++i) {
+      REQUIRE(menu.tick_for(0, [] { return 0; }) == 1);
+      REQUIRE(counts[i] == 2);
+    }
+    REQUIRE(all_equal(2));
+
+    // every clock read advances the time by one: three items fit into a budget of three
+    int time = 0;
+    REQUIRE(menu.tick_for(3, [&time] { return time++; }) == 3);
+    REQUIRE(counts[0] == 3);
+    REQUIRE(counts[2] == 3);
+    REQUIRE(counts[3] == 2);
+    REQUIRE(menu.tick_for(3, [&time] { return time++; }) == 3);
+    REQUIRE(counts[5] == 3);
+    REQUIRE(counts[6] == 2);
+  }
 }
@@ -0,0 +1,116 @@
+#include "fixture.hpp"
+#include "sgl.hpp"
+#include "sgl/menu_state.hpp"
+
+#include <catch2/catch.hpp>
+#include <type_traits>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  constexpr auto make_menu() noexcept {
+    return fixture::make_menu(
+        fixture::settings_page(NAME("gain") <<= sgl::numeric<16, char>(1.0, 1.0)),
+        fixture::info_page(NAME("count") <<= sgl::numeric<12, char>(1, 2)));
+  }
+
+  using fixture::info;
+  using fixture::settings;
+
+  using Menu = decltype(make_menu());
+  using State = sgl::MenuState<Menu>;
+} // namespace
+
+TEST_CASE("MenuState") {
+  STATIC_REQUIRE(std::is_trivially_copyable_v<State>);
+  STATIC_REQUIRE(State::num_pages == 2);
+  STATIC_REQUIRE(State::values_size == sgl::snapshot_size_v<Menu> - 4);
+
+  auto  menu = make_menu();
+  State a(menu);
+
+  REQUIRE(menu[settings][NAME("enabled")].set_value(false) == sgl::error::no_error);
+  REQUIRE(menu[settings][NAME("gain")].set_value(3.5) == sgl::error::no_error);
+  REQUIRE(menu[info][NAME("count")].set_value(7) == sgl::error::no_error);
+  menu[settings].set_current_item(2);
+  menu[settings].set_edit_mode();
+  menu[info].set_current_item(1);
+  REQUIRE(menu.set_current_page(1) == sgl::error::no_error);
+  State b(menu);
+  REQUIRE(b.current_page_index() == 1);
+
+  SECTION("load restores values and positions") {
+    REQUIRE(a.load(menu) == sgl::error::no_error);
+    REQUIRE(menu.current_page_index() == 0);
+    REQUIRE(menu[settings].current_item_index() == 0);
+    REQUIRE_FALSE(menu[settings].is_in_edit_mode());
+    REQUIRE(menu[info].current_item_index() == 0);
+    REQUIRE(menu[settings][NAME("enabled")].get_value());
+    REQUIRE(menu[settings][NAME("gain")].get_value() == 1.0);
+    REQUIRE(menu[info][NAME("count")].get_value() == 1);
+    REQUIRE(sgl::string_view<char>(menu[info][NAME("count")].text()) == "1"_sv);
+
+    REQUIRE(b.load(menu) == sgl::error::no_error);
+    REQUIRE(menu.current_page_index() == 1);
+    REQUIRE(menu[settings].current_item_index() == 2);
+    REQUIRE(menu[settings].is_in_edit_mode());
+    REQUIRE(menu[info].current_item_index() == 1);
+    REQUIRE_FALSE(menu[settings][NAME("enabled")].get_value());
+    REQUIRE(menu[settings][NAME("gain")].get_value() == 3.5);
+    REQUIRE(menu[info][NAME("count")].get_value() == 7);
+    REQUIRE(sgl::string_view<char>(menu[info][NAME("count")].text()) == "7"_sv);
+  }
+
+  SECTION("load does not call on enter/exit and skips unchanged items") {
+    bool entered = false;
+    bool exited = false;
+    menu[settings].set_on_enter([&entered](auto&) noexcept -> sgl::error {
+      entered = true;
+      return sgl::error::no_error;
+    });
+    menu[info].set_on_exit([&exited](auto&) noexcept -> sgl::error {
+      exited = true;
+      return sgl::error::no_error;
+    });
+    // text which is not derived from the value survives if the value is the same
+    REQUIRE(menu[settings][NAME("mode")].set_text("custom"_sv) == sgl::error::no_error);
+
+    REQUIRE(a.load(menu) == sgl::error::no_error);
+    REQUIRE(menu.current_page_index() == 0);
+    REQUIRE_FALSE(entered);
+    REQUIRE_FALSE(exited);
+    REQUIRE(sgl::string_view<char>(menu[settings][NAME("mode")].text()) == "custom"_sv);
+  }
+
+  SECTION("save and copy") {
+    State c = a;
+    menu[settings][NAME("mode")].set_index(2);
+    REQUIRE(menu[settings][NAME("mode")].set_text(menu[settings][NAME("mode")].current_string()) ==
+            sgl::error::no_error);
+    c.save(menu);
+    REQUIRE(a.load(menu) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("mode")].index() == 0);
+    REQUIRE(c.load(menu) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("mode")].index() == 2);
+    REQUIRE(sgl::string_view<char>(menu[settings][NAME("mode")].text()) == "fast"_sv);
+  }
+}
+
+TEST_CASE("MenuState stores the texts of items without a value") {
+  auto menu = sgl::Menu(NAME("page") <<=
+                        sgl::Page(NAME("start") <<= sgl::Button<12, char>("start"_sv),
+                                  NAME("count") <<= sgl::numeric<12, char>(1, 2)));
+  using S = sgl::MenuState<decltype(menu)>;
+  STATIC_REQUIRE(S::num_texts == 1);
+  STATIC_REQUIRE(S::texts_size == 12);
+  auto& start = menu[NAME("page")][NAME("start")];
+
+  S a(menu);
+  REQUIRE(start.set_text("running"_sv) == sgl::error::no_error);
+  S b(menu);
+
+  REQUIRE(a.load(menu) == sgl::error::no_error);
+  REQUIRE(sgl::string_view<char>(start.text()) == "start"_sv);
+  REQUIRE(b.load(menu) == sgl::error::no_error);
+  REQUIRE(sgl::string_view<char>(start.text()) == "running"_sv);
+}
@@ -0,0 +1,122 @@
+#include "sgl/menu_tester.hpp"
+
+#include <catch2/catch.hpp>
+#include <sstream>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  constexpr auto make_menu() noexcept {
+    return sgl::Menu(NAME("page") <<= sgl::Page(NAME("a") <<= sgl::numeric<12, char>(0, 1),
+                                                NAME("b") <<= sgl::Boolean(false)));
+  }
+
+  auto make_tester() {
+    return sgl::MenuTester(make_menu(),
+                           {{sgl::input::up, "up"_sv},
+                            {sgl::input::down, "down"_sv},
+                            {sgl::input::enter, "enter"_sv}});
+  }
+} // namespace
+
+TEST_CASE("MenuTester replay") {
+  auto tester = make_tester();
+
+  SECTION("load script") {
+    std::istringstream script("down\nup\n\n12\ndown\n");
+    const auto         inputs = tester.load_script(script);
+    REQUIRE(inputs == sgl::ReplayScript{sgl::input::down,
+                                        sgl::input::up,
+                                        sgl::input::enter,
+                                        sgl::to_input('1'),
+                                        sgl::to_input('2'),
+                                        sgl::input::down});
+  }
+
+  SECTION("replay without trace") {
+    std::istringstream script("enter\nup\nup\nup\nenter\ndown\n");
+    const auto         result = tester.replay(tester.load_script(script));
+    REQUIRE(result.inputs == 6);
+    REQUIRE(result.errors == 0);
+    REQUIRE(result.frames == 0);
+    REQUIRE(tester.menu().item_text(0) == "3"_sv);
+    REQUIRE(tester.menu().for_current_page([](const auto& p) { return p.current_item_index(); }) ==
+            1);
+  }
+
+  SECTION("text trace") {
+    std::istringstream script("enter\nup\n");
+    std::ostringstream trace;
+    const auto         result = tester.replay(tester.load_script(script), &trace);
+    REQUIRE(result.frames == 2);
+    REQUIRE(trace.str() == "page\n==> a: 0\n    b: FALSE\n\npage\n==> a: 1\n    b: FALSE\n\n");
+  }
+
+  SECTION("binary trace") {
+    std::istringstream script("down\n");
+    std::ostringstream trace;
+    tester.replay(tester.load_script(script), &trace, sgl::TraceFormat::binary);
+    const std::string expected("SGLT"
+                               "\0\0\0\0"
+                               "\1\0\0\0"
+                               "\0\0\0\0"
+                               "\2\0\0\0"
+                               "\1\0\0\0"
+                               "0"
+                               "\5\0\0\0"
+                               "FALSE",
+                               4 + 4 * 4 + 4 + 1 + 4 + 5);
+    REQUIRE(trace.str() == expected);
+  }
+}
+
+TEST_CASE("MenuTester golden frames") {
+  auto               tester = make_tester();
+  std::istringstream script("enter\nup\nenter\ndown\n");
+  const auto         inputs = tester.load_script(script);
+  std::stringstream  golden;
+  tester.replay(inputs, &golden);
+
+  SECTION("equal session") {
+    auto       other = make_tester();
+    const auto diff = other.compare(inputs, golden);
+    REQUIRE(diff.equal);
+    REQUIRE(diff.step == 4);
+  }
+
+  SECTION("divergent session") {
+    auto               other = make_tester();
+    std::istringstream other_script("enter\nup\nup\nenter\n");
+    const auto         diff = other.compare(other.load_script(other_script), golden);
+    REQUIRE_FALSE(diff.equal);
+    REQUIRE(diff.step == 2);
+    REQUIRE(diff.line == 1);
+    REQUIRE(diff.expected == "--> a: 1");
+    REQUIRE(diff.actual == "==> a: 2");
+  }
+
+  SECTION("shorter session") {
+    auto       other = make_tester();
+    const auto diff = other.compare(sgl::ReplayScript(inputs.begin(), inputs.end() - 1), golden);
+    REQUIRE_FALSE(diff.equal);
+    REQUIRE(diff.step == 3);
+    REQUIRE(diff.actual_end);
+    REQUIRE(diff.expected == "page");
+  }
+
+  SECTION("diff traces") {
+    auto              other = make_tester();
+    std::stringstream actual;
+    other.replay(sgl::ReplayScript(inputs.begin(), inputs.end() - 1), &actual);
+    const auto diff = sgl::diff_traces(golden, actual);
+    REQUIRE_FALSE(diff.equal);
+    REQUIRE(diff.step == 3);
+    REQUIRE(diff.line == 0);
+    REQUIRE(diff.actual_end);
+    REQUIRE_FALSE(diff.expected_end);
+
+    std::stringstream golden2(golden.str());
+    std::stringstream actual2(golden.str());
+    REQUIRE(sgl::diff_traces(golden2, actual2).equal);
+  }
+}
@@ -0,0 +1,65 @@
+#include "sgl/name.hpp"
+#include "sgl/name_table.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  constexpr auto n1 = NAME("contrast");
+  constexpr auto n2 = NAME("brightness");
+  constexpr auto n3 = NAME("volume");
+  constexpr auto n4 = NAME("a");
+  constexpr auto n5 = NAME("b");
+  constexpr auto n6 = NAME("settings/contrast");
+
+  using Table = sgl::NameTable<sgl::type_list<decltype(n1),
+                                              decltype(n2),
+                                              decltype(n3),
+                                              decltype(n4),
+                                              decltype(n5),
+                                              decltype(n6)>>;
+
+  using SingleTable = sgl::NameTable<sgl::type_list<decltype(n1)>>;
+
+  template <size_t N>
+  using Index = sgl::
+      Name<'i', 't', 'e', 'm', static_cast<char>('0' + N / 10), static_cast<char>('0' + N % 10)>;
+
+  template <size_t... I>
+  constexpr auto make_big_table(std::index_sequence<I...>) {
+    return sgl::NameTable<sgl::type_list<Index<I>...>>{};
+  }
+
+  using BigTable = decltype(make_big_table(std::make_index_sequence<100>{}));
+} // namespace
+
+TEST_CASE("sgl::NameTable") {
+  static_assert(Table::size == 6);
+  static_assert(Table::npos == 6);
+  static_assert(Table::find("contrast"_sv) == 0);
+  static_assert(Table::find("settings/contrast"_sv) == 5);
+
+  REQUIRE(Table::find("contrast"_sv) == 0);
+  REQUIRE(Table::find("brightness"_sv) == 1);
+  REQUIRE(Table::find("volume"_sv) == 2);
+  REQUIRE(Table::find("a"_sv) == 3);
+  REQUIRE(Table::find("b"_sv) == 4);
+  REQUIRE(Table::find("settings/contrast"_sv) == 5);
+
+  REQUIRE(Table::find(""_sv) == Table::npos);
+  REQUIRE(Table::find("c"_sv) == Table::npos);
+  REQUIRE(Table::find("contras"_sv) == Table::npos);
+  REQUIRE(Table::find("contrast "_sv) == Table::npos);
+
+  REQUIRE(SingleTable::find("contrast"_sv) == 0);
+  REQUIRE(SingleTable::find("volume"_sv) == SingleTable::npos);
+
+  char name[] = "item00";
+  for (size_t i = 0; i < 100; ++i) {
+    name[4] = static_cast<char>('0' + i / 10);
+    name[5] = static_cast<char>('0' + i % 10);
+    REQUIRE(BigTable::find(sgl::string_view<char>(name, 6)) == i);
+  }
+  REQUIRE(BigTable::find("item100"_sv) == BigTable::npos);
+}
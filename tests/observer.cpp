@@ -0,0 +1,149 @@
+#include "sgl.hpp"
+#include "sgl/cycle_histogram.hpp"
+
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  constexpr auto make_menu() noexcept {
+    return sgl::Menu(NAME("main") <<= sgl::Page(NAME("flag") <<= sgl::Boolean(true),
+                                                NAME("to other") <<=
+                                                sgl::pagelink(NAME("other"), "other")),
+                     NAME("other") <<= sgl::Page(NAME("to main") <<=
+                                                 sgl::pagelink(NAME("main"), "main")));
+  }
+
+  constexpr auto make_timed_menu() noexcept {
+    return sgl::Menu(NAME("first") <<= sgl::Page(NAME("a") <<= sgl::Boolean(true),
+                                                 NAME("b") <<= sgl::Boolean(true)),
+                     NAME("second") <<= sgl::Page(NAME("c") <<= sgl::Boolean(true)));
+  }
+
+  using Menu = decltype(make_menu());
+  using TimedMenu = decltype(make_timed_menu());
+
+  std::vector<std::string> events;
+
+  std::string to_string(const sgl::Event& e) {
+    constexpr const char* kinds[] = {"handle_input", "tick", "on_enter", "on_exit", "item_tick"};
+    std::string           str = kinds[static_cast<size_t>(e.kind)];
+    str += ' ';
+    str.append(e.page_name.data(), e.page_name.size());
+    if (e.item != sgl::Event::npos) {
+      str += '/';
+      str.append(e.item_name.data(), e.item_name.size());
+      str += ' ' + std::to_string(e.page) + ' ' + std::to_string(e.item);
+    }
+    return str;
+  }
+
+  // every call advances the time by 10, so the duration of an event is 10 plus 20 per nested event.
+  struct FakeClock {
+    static inline uint64_t time = 0;
+
+    static uint64_t now() noexcept { return time += 10; }
+  };
+
+  sgl::CycleHistogram<TimedMenu, FakeClock> histogram;
+} // namespace
+
+template <>
+struct sgl::ObserverTraits<Menu> {
+  static constexpr bool enabled = true;
+
+  static void begin(const sgl::Event& e) noexcept { events.push_back("begin " + to_string(e)); }
+
+  static void end(const sgl::Event& e) noexcept { events.push_back("end " + to_string(e)); }
+};
+
+template <>
+struct sgl::ObserverTraits<TimedMenu> {
+  static constexpr bool enabled = true;
+
+  static void begin(const sgl::Event& e) noexcept { histogram.begin(e); }
+
+  static void end(const sgl::Event& e) noexcept { histogram.end(e); }
+};
+
+TEST_CASE("ObserverTraits") {
+  STATIC_REQUIRE_FALSE(sgl::ObserverTraits<int>::enabled);
+  auto menu = make_menu();
+  events.clear();
+
+  SECTION("tick") {
+    menu.tick();
+    REQUIRE(events == std::vector<std::string>{"begin tick ",
+                                               "begin item_tick main/flag 0 0",
+                                               "end item_tick main/flag 0 0",
+                                               "begin item_tick main/to other 0 1",
+                                               "end item_tick main/to other 0 1",
+                                               "begin item_tick other/to main 1 0",
+                                               "end item_tick other/to main 1 0",
+                                               "end tick "});
+  }
+
+  SECTION("handle_input with page transition") {
+    menu[NAME("main")].set_current_item(1);
+    events.clear();
+    REQUIRE(menu.handle_input(sgl::input::enter) == sgl::error::no_error);
+    REQUIRE(menu.current_page_index() == 1);
+    REQUIRE(events == std::vector<std::string>{"begin handle_input main",
+                                               "begin on_exit main",
+                                               "end on_exit main",
+                                               "begin on_enter other",
+                                               "end on_enter other",
+                                               "end handle_input main"});
+  }
+}
+
+TEST_CASE("CycleHistogram") {
+  using Histogram = sgl::CycleHistogram<TimedMenu, FakeClock>;
+  STATIC_REQUIRE(Histogram::size == 2 + 2 * 2 + 3);
+
+  auto menu = make_timed_menu();
+  histogram.clear();
+  menu.tick();
+  menu.tick();
+  REQUIRE(menu.set_current_page(1) == sgl::error::no_error);
+
+  const sgl::Event tick{sgl::event_kind::tick, sgl::Event::npos, sgl::Event::npos, {}, {}};
+  REQUIRE(histogram.stats(tick).count == 2);
+  REQUIRE(histogram.stats(tick).min == 70);
+  REQUIRE(histogram.stats(tick).max == 70);
+
+  const sgl::Event item_c{sgl::event_kind::item_tick, 1, 0, {}, {}};
+  const auto&      c = histogram.stats(item_c);
+  REQUIRE(c.count == 2);
+  REQUIRE(c.total == 20);
+  REQUIRE(c.buckets[4] == 2); // 10 is in [8, 16)
+  REQUIRE(c.page_name == "second"_sv);
+  REQUIRE(c.item_name == "c"_sv);
+
+  const sgl::Event enter{sgl::event_kind::on_enter, 1, sgl::Event::npos, {}, {}};
+  REQUIRE(histogram.stats(enter).count == 1);
+
+  size_t entries = 0;
+  histogram.for_each([&entries](sgl::event_kind, const sgl::CycleStats&) { ++entries; });
+  REQUIRE(entries == 6); // tick, three items, on exit of page 0 and on enter of page 1
+
+  SECTION("dump") {
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+    histogram.dump(file);
+    std::rewind(file);
+    std::string text;
+    char        buffer[256];
+    while (std::fgets(buffer, sizeof(buffer), file) != nullptr) {
+      text += buffer;
+    }
+    std::fclose(file);
+    REQUIRE(text.find("tick          count=2 min=70 mean=70 max=70 [2^7]=2\n") !=
+            std::string::npos);
+    REQUIRE(text.find("item_tick    second/c count=2 min=10 mean=10 max=10 [2^4]=2\n") !=
+            std::string::npos);
+  }
+}
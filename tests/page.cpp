@@ -74,6 +74,20 @@ TEST_CASE("Page") {
     page.set_current_item(i1);
     REQUIRE_FALSE(page.is_in_edit_mode());
   }
+  SECTION("find_item() and visit_item()") {
+    REQUIRE(page.find_item("bool item 1"_sv) == 0);
+    REQUIRE(page.find_item("double item 2"_sv) == 1);
+    REQUIRE(page.find_item("double item"_sv) == page.size());
+
+    bool visited = false;
+    REQUIRE(page.visit_item("double item 2"_sv, [&visited](auto& item) {
+      visited = true;
+      return item.set_text("2.0"_sv);
+    }) == sgl::error::no_error);
+    REQUIRE(visited);
+    REQUIRE(sgl::string_view<char>(page[i2].text()) == "2.0"_sv);
+    REQUIRE(page.visit_item("bool item 2"_sv, [](auto&) {}) == sgl::error::item_not_found);
+  }
   SECTION("edit mode") {
     REQUIRE_FALSE(page.is_in_edit_mode());
     page.set_edit_mode();
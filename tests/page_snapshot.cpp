@@ -0,0 +1,104 @@
+#include "sgl.hpp"
+#include "sgl/page_snapshot.hpp"
+
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <string>
+#include <thread>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  constexpr auto make_menu() noexcept {
+    return sgl::Menu(NAME("counters") <<= sgl::Page(NAME("a") <<= sgl::numeric<12, char>(0, 1),
+                                                    NAME("b") <<= sgl::numeric<12, char>(0, 1),
+                                                    NAME("c") <<= sgl::numeric<12, char>(0, 1),
+                                                    NAME("d") <<= sgl::numeric<12, char>(0, 1)),
+                     NAME("info") <<= sgl::Page(NAME("enabled") <<= sgl::Boolean(true)));
+  }
+
+  constexpr auto counters = NAME("counters");
+  constexpr auto info = NAME("info");
+
+  using Menu = decltype(make_menu());
+
+  void set_all(Menu& menu, int value) {
+    menu[counters].for_each_item([value](auto& item) {
+      REQUIRE(item.set_value(value) == sgl::error::no_error);
+    });
+  }
+} // namespace
+
+TEST_CASE("PageSnapshot") {
+  STATIC_REQUIRE(sgl::PageView<Menu>::max_items == 4);
+  STATIC_REQUIRE(sgl::PageView<Menu>::text_size == 12);
+
+  auto                     menu = make_menu();
+  sgl::PageSnapshot<Menu> snapshot(menu);
+
+  SECTION("read returns the published page") {
+    const auto& view = snapshot.read();
+    REQUIRE(view.sequence == 1);
+    REQUIRE(view.page_name == "counters"_sv);
+    REQUIRE(view.page_index == 0);
+    REQUIRE(view.size == 4);
+    REQUIRE(view.current_item == 0);
+    REQUIRE_FALSE(view.edit_mode);
+    REQUIRE(view.names[2] == "c"_sv);
+    REQUIRE(sgl::string_view<char>(view.texts[2]) == "0"_sv);
+
+    // changes are not visible before publish()
+    set_all(menu, 5);
+    menu[counters].set_current_item(3);
+    menu[counters].set_edit_mode();
+    REQUIRE(sgl::string_view<char>(snapshot.read().texts[3]) == "0"_sv);
+
+    snapshot.publish(menu);
+    const auto& next = snapshot.read();
+    REQUIRE(next.sequence == 2);
+    REQUIRE(next.current_item == 3);
+    REQUIRE(next.edit_mode);
+    REQUIRE(sgl::string_view<char>(next.texts[3]) == "5"_sv);
+
+    REQUIRE(menu.set_current_page(info) == sgl::error::no_error);
+    snapshot.publish(menu);
+    const auto& info_view = snapshot.read();
+    REQUIRE(info_view.page_name == "info"_sv);
+    REQUIRE(info_view.size == 1);
+    REQUIRE(info_view.names[0] == "enabled"_sv);
+    REQUIRE(sgl::string_view<char>(info_view.texts[0]) == "TRUE"_sv);
+  }
+
+  SECTION("concurrent publish and read") {
+    // the writer sets every item to the same value and publishes. The reader must never see a
+    // mix of two updates. Run this with -fsanitize=thread to check for data races.
+    constexpr int    iterations = 20000;
+    std::atomic_bool reader_failed{false};
+
+    std::thread reader([&snapshot, &reader_failed] {
+      uint32_t last = 0;
+      while (last != iterations + 1) {
+        const auto& view = snapshot.read();
+        if (view.sequence < last) {
+          reader_failed = true;
+        }
+        last = view.sequence;
+        const std::string expected = std::to_string(view.sequence - 1);
+        for (size_t i = 0; i < view.size; ++i) {
+          if (std::string(view.texts[i].data(), view.texts[i].size()) != expected or
+              view.current_item != (view.sequence - 1) % 4) {
+            reader_failed = true;
+          }
+        }
+      }
+    });
+
+    for (int i = 1; i <= iterations; ++i) {
+      menu[counters].for_each_item([i](auto& item) { static_cast<void>(item.set_value(i)); });
+      menu[counters].set_current_item(static_cast<size_t>(i % 4));
+      snapshot.publish(menu);
+    }
+    reader.join();
+    REQUIRE_FALSE(reader_failed);
+  }
+}
@@ -0,0 +1,142 @@
+#include "fixture.hpp"
+#include "sgl.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  constexpr auto make_menu() noexcept {
+    return fixture::make_menu(
+        fixture::settings_page(
+            NAME("contrast") <<= sgl::numeric<12, char>(0, 1),
+            NAME("size") <<= sgl::numeric<12, char>(0u, 1u),
+            NAME("level") <<= sgl::numeric<12, char>(uint8_t{0}, uint8_t{1})),
+        fixture::info_page(NAME("gain") <<= sgl::numeric<16, char>(1.0f, 1.0f),
+                           NAME("offset") <<= sgl::numeric<16, char>(1.0, 1.0)));
+  }
+
+  using fixture::info;
+  using fixture::settings;
+} // namespace
+
+TEST_CASE("Menu::set() and Menu::get()") {
+  auto menu = make_menu();
+  char buffer[16]{};
+
+  SECTION("set") {
+    REQUIRE(menu.set("settings/contrast"_sv, "42"_sv) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("contrast")].get_value() == 42);
+    REQUIRE(sgl::string_view<char>(menu[settings][NAME("contrast")].text()) == "42"_sv);
+
+    REQUIRE(menu.set("settings/contrast"_sv, "-7"_sv) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("contrast")].get_value() == -7);
+
+    REQUIRE(menu.set("settings/size"_sv, "-7"_sv) == sgl::error::format_error);
+    REQUIRE(menu.set("settings/size"_sv, "7"_sv) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("size")].get_value() == 7u);
+
+    REQUIRE(menu.set("settings/enabled"_sv, "false"_sv) == sgl::error::no_error);
+    REQUIRE_FALSE(menu[settings][NAME("enabled")].get_value());
+    REQUIRE(menu.set("settings/enabled"_sv, "1"_sv) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("enabled")].get_value());
+    REQUIRE(menu.set("settings/enabled"_sv, "yes"_sv) == sgl::error::invalid_value);
+
+    REQUIRE(menu.set("settings/mode"_sv, "fast"_sv) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("mode")].index() == 2);
+    REQUIRE(sgl::string_view<char>(menu[settings][NAME("mode")].text()) == "fast"_sv);
+    REQUIRE(menu.set("settings/mode"_sv, "faster"_sv) == sgl::error::invalid_value);
+
+    REQUIRE(menu.set("info/gain"_sv, "2.5"_sv) == sgl::error::no_error);
+    REQUIRE(menu[info][NAME("gain")].get_value() == 2.5f);
+    REQUIRE(menu.set("info/offset"_sv, "-0.25"_sv) == sgl::error::no_error);
+    REQUIRE(menu[info][NAME("offset")].get_value() == -0.25);
+    REQUIRE(menu.set("info/offset"_sv, "abc"_sv) == sgl::error::format_error);
+  }
+
+  SECTION("set integers out of range") {
+    REQUIRE(menu.set("settings/contrast"_sv, "99999999999"_sv) == sgl::error::out_of_range);
+    REQUIRE(menu.set("settings/contrast"_sv, "2147483648"_sv) == sgl::error::out_of_range);
+    REQUIRE(menu.set("settings/contrast"_sv, "-2147483649"_sv) == sgl::error::out_of_range);
+    REQUIRE(menu[settings][NAME("contrast")].get_value() == 0);
+    REQUIRE(menu.set("settings/contrast"_sv, "2147483647"_sv) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("contrast")].get_value() == 2147483647);
+    REQUIRE(menu.set("settings/contrast"_sv, "-2147483648"_sv) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("contrast")].get_value() == -2147483647 - 1);
+
+    REQUIRE(menu.set("settings/level"_sv, "300"_sv) == sgl::error::out_of_range);
+    REQUIRE(menu.set("settings/level"_sv, "256"_sv) == sgl::error::out_of_range);
+    REQUIRE(menu[settings][NAME("level")].get_value() == 0);
+    REQUIRE(menu.set("settings/level"_sv, "255"_sv) == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("level")].get_value() == 255);
+
+    // no digits
+    REQUIRE(menu.set("settings/contrast"_sv, "-"_sv) == sgl::error::invalid_value);
+    REQUIRE(menu.set("settings/contrast"_sv, ""_sv) == sgl::error::invalid_value);
+  }
+
+  SECTION("set errors") {
+    REQUIRE(menu.set("settings"_sv, "1"_sv) == sgl::error::invalid_input);
+    REQUIRE(menu.set("setting/contrast"_sv, "1"_sv) == sgl::error::page_not_found);
+    REQUIRE(menu.set("settings/brightness"_sv, "1"_sv) == sgl::error::item_not_found);
+    REQUIRE(menu.set("settings/to info"_sv, "1"_sv) == sgl::error::not_editable);
+  }
+
+  SECTION("get") {
+    REQUIRE(menu.set("settings/contrast"_sv, "123"_sv) == sgl::error::no_error);
+    auto res = menu.get("settings/contrast"_sv, buffer, sizeof(buffer));
+    REQUIRE(res.ec == sgl::error::no_error);
+    REQUIRE(sgl::string_view<char>(buffer, res.size) == "123"_sv);
+
+    res = menu.get("settings/mode"_sv, buffer, sizeof(buffer));
+    REQUIRE(res.ec == sgl::error::no_error);
+    REQUIRE(sgl::string_view<char>(buffer, res.size) == "slow"_sv);
+
+    res = menu.get("settings/mode"_sv, buffer, 3);
+    REQUIRE(res.ec == sgl::error::buffer_too_small);
+    REQUIRE(res.size == 0);
+
+    REQUIRE(menu.get("info/volume"_sv, buffer, sizeof(buffer)).ec == sgl::error::item_not_found);
+    REQUIRE(menu.get("info"_sv, buffer, sizeof(buffer)).ec == sgl::error::invalid_input);
+  }
+
+  SECTION("batched set") {
+    sgl::PathAssignment<char> assignments[] = {
+        {"settings/contrast"_sv, "5"_sv},
+        {"settings/mode"_sv, "normal"_sv},
+        {"settings/volume"_sv, "3"_sv},
+        {"info/gain"_sv, "x"_sv},
+        {"settings/enabled"_sv, "0"_sv},
+    };
+    REQUIRE(menu.set(assignments, 5) == 2);
+    REQUIRE(assignments[0].ec == sgl::error::no_error);
+    REQUIRE(assignments[1].ec == sgl::error::no_error);
+    REQUIRE(assignments[2].ec == sgl::error::item_not_found);
+    REQUIRE(assignments[3].ec == sgl::error::format_error);
+    REQUIRE(assignments[4].ec == sgl::error::no_error);
+    REQUIRE(menu[settings][NAME("contrast")].get_value() == 5);
+    REQUIRE(menu[settings][NAME("mode")].index() == 1);
+    REQUIRE_FALSE(menu[settings][NAME("enabled")].get_value());
+  }
+}
+
+TEST_CASE("Menu::set() with char16_t") {
+  using sv = sgl::string_view<char16_t>;
+  auto menu = sgl::Menu(NAME("page") <<=
+                        sgl::Page(NAME("float") <<= sgl::numeric<16, char16_t>(1.0f, 1.0f),
+                                  NAME("double") <<= sgl::numeric<16, char16_t>(1.0, 1.0),
+                                  NAME("int") <<= sgl::numeric<16, char16_t>(0, 1)));
+  auto& page = menu[NAME("page")];
+
+  REQUIRE(menu.set("page/float"_sv, sv(u"2.5")) == sgl::error::no_error);
+  REQUIRE(page[NAME("float")].get_value() == 2.5f);
+  REQUIRE(menu.set("page/double"_sv, sv(u"-0.25")) == sgl::error::no_error);
+  REQUIRE(page[NAME("double")].get_value() == -0.25);
+  REQUIRE(menu.set("page/int"_sv, sv(u"-12")) == sgl::error::no_error);
+  REQUIRE(page[NAME("int")].get_value() == -12);
+
+  // non ASCII code units are never part of a number
+  REQUIRE(menu.set("page/float"_sv, sv(u"2.5°")) == sgl::error::invalid_value);
+  REQUIRE(menu.set("page/double"_sv, sv(u"x")) == sgl::error::format_error);
+  REQUIRE(page[NAME("float")].get_value() == 2.5f);
+}
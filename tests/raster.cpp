@@ -0,0 +1,226 @@
+#include "sgl.hpp"
+#include "sgl/raster.hpp"
+
+#include <catch2/catch.hpp>
+#include <vector>
+
+namespace {
+  constexpr auto make_menu() noexcept {
+    return sgl::Menu(NAME("counters") <<= sgl::Page(NAME("a") <<= sgl::numeric<12, char>(0, 1),
+                                                    NAME("b") <<= sgl::numeric<12, char>(0, 1),
+                                                    NAME("c") <<= sgl::numeric<12, char>(0, 1),
+                                                    NAME("d") <<= sgl::numeric<12, char>(0, 1)),
+                     NAME("info") <<= sgl::Page(NAME("enabled") <<= sgl::Boolean(true)));
+  }
+
+  constexpr auto counters = NAME("counters");
+  constexpr auto info = NAME("info");
+
+  using Menu = decltype(make_menu());
+
+  bool pixel(const std::vector<uint8_t>& pixels, size_t width, size_t x, size_t y) {
+    return (pixels[y * sgl::Mono1::stride(width) + x / 8] >> (7 - x % 8)) & 1u;
+  }
+
+  /// check that every pixel of the frame buffer matches the laid out grid
+  template <size_t C, size_t R>
+  void check_pixels(const sgl::TextRasterizer<C, R>& rasterizer,
+                    const std::vector<uint8_t>&      pixels,
+                    size_t                           width,
+                    size_t                           height) {
+    const auto& font = sgl::font_5x7;
+    for (size_t y = 0; y < height; ++y) {
+      for (size_t x = 0; x < width; ++x) {
+        const auto&   cell = rasterizer.cell(x / font.cell_width, y / font.cell_height);
+        const uint8_t bits = font.row(cell.c, y % font.cell_height);
+        bool          lit = (bits >> (7 - x % font.cell_width)) & 1u;
+        if (cell.inverted) {
+          lit = !lit;
+        }
+        INFO("x = " << x << ", y = " << y);
+        REQUIRE(pixel(pixels, width, x, y) == lit);
+      }
+    }
+  }
+} // namespace
+
+TEST_CASE("Font") {
+  using sgl::font_5x7;
+  STATIC_REQUIRE(font_5x7.glyph_width == 5);
+  STATIC_REQUIRE(font_5x7.glyph_height == 7);
+  STATIC_REQUIRE(font_5x7.cell_width == 6);
+  STATIC_REQUIRE(font_5x7.cell_height == 8);
+  STATIC_REQUIRE(font_5x7.count == 95);
+  // 'A' transposed: .XXX. / X...X / X...X / X...X / XXXXX / X...X / X...X
+  STATIC_REQUIRE(font_5x7.row(U'A', 0) == 0b01110000);
+  STATIC_REQUIRE(font_5x7.row(U'A', 1) == 0b10001000);
+  STATIC_REQUIRE(font_5x7.row(U'A', 4) == 0b11111000);
+  STATIC_REQUIRE(font_5x7.row(U'A', 6) == 0b10001000);
+  // spacing row and unknown characters
+  STATIC_REQUIRE(font_5x7.row(U'A', 7) == 0);
+  STATIC_REQUIRE_FALSE(font_5x7.contains(U'\n'));
+  STATIC_REQUIRE(font_5x7.row(U'ä', 0) == font_5x7.row(U'?', 0));
+
+  constexpr uint8_t columns[][3] = {{0x1F, 0x11, 0x1F}, {0x00, 0x1F, 0x00}};
+  constexpr auto    digits = sgl::make_font(columns, 5, U'0', 0);
+  STATIC_REQUIRE(digits.cell_width == 3);
+  STATIC_REQUIRE(digits.row(U'0', 0) == 0b11100000);
+  STATIC_REQUIRE(digits.row(U'0', 2) == 0b10100000);
+  STATIC_REQUIRE(digits.row(U'1', 3) == 0b01000000);
+
+  // the default fallback '?' is not in the font, unknown characters are blank
+  STATIC_REQUIRE(digits.row(U'x', 0) == 0);
+  // at most 8 rows are stored
+  constexpr uint8_t tall[][1] = {{0xFF}};
+  STATIC_REQUIRE(sgl::make_font(tall, 10).glyph_height == 8);
+}
+
+TEST_CASE("TextRasterizer with 8 pixel wide glyphs") {
+  // 'A' is a filled 8x8 block, the cell is 9 pixels wide because of the spacing.
+  constexpr uint8_t columns[][8] = {{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+  constexpr auto    blocks = sgl::make_font(columns, 8, U'A');
+  STATIC_REQUIRE(blocks.cell_width == 9);
+
+  using Button = sgl::Button<3, char>;
+  auto menu = sgl::Menu(
+      NAME("page") <<= sgl::Page(NAME("a") <<= Button(sgl::string_view<char>("AAx"))));
+  constexpr size_t          width = 36;
+  std::vector<uint8_t>      pixels(sgl::Mono1::stride(width) * 9, 0xAA);
+  sgl::TextRasterizer<4, 1> rasterizer(blocks);
+  REQUIRE(rasterizer.render(menu, sgl::Bitmap<sgl::Mono1>{pixels.data(), width, 9}) == 4);
+  for (size_t x = 0; x < width; ++x) {
+    // the marker '>' and 'x' are not in the font, the spacing column of every cell is blank
+    const bool lit = x >= 9 and x < 27 and x % 9 != 8;
+    for (size_t y = 0; y < 9; ++y) {
+      INFO("x = " << x << ", y = " << y);
+      REQUIRE(pixel(pixels, width, x, y) == (lit and y < 8));
+    }
+  }
+}
+
+TEST_CASE("Mono1 and Rgb565 write") {
+  SECTION("Mono1 across a byte boundary") {
+    uint8_t    line[3] = {0xFF, 0x00, 0xFF};
+    sgl::Mono1 format;
+    format.write(line, 6, 0b10110000, 5);
+    REQUIRE(line[0] == 0b11111110);
+    REQUIRE(line[1] == 0b11000000);
+    REQUIRE(line[2] == 0xFF);
+    format.write(line, 8, 0, 8);
+    REQUIRE(line[0] == 0b11111110);
+    REQUIRE(line[1] == 0);
+    REQUIRE(line[2] == 0xFF);
+  }
+  SECTION("Rgb565") {
+    uint16_t    line[8]{};
+    sgl::Rgb565 format{0xF800, 0x001F};
+    format.write(line, 2, 0b10100000, 4);
+    REQUIRE(line[1] == 0);
+    REQUIRE(line[2] == 0xF800);
+    REQUIRE(line[3] == 0x001F);
+    REQUIRE(line[4] == 0xF800);
+    REQUIRE(line[5] == 0x001F);
+    REQUIRE(line[6] == 0);
+  }
+}
+
+TEST_CASE("TextRasterizer") {
+  // 20 pixels wide, so that cells straddle byte boundaries and the last cell is clipped.
+  constexpr size_t width = 20;
+  constexpr size_t height = 16;
+
+  auto                      menu = make_menu();
+  std::vector<uint8_t>      pixels(sgl::Mono1::stride(width) * height);
+  sgl::Bitmap<sgl::Mono1>   bitmap{pixels.data(), width, height};
+  sgl::TextRasterizer<4, 2> rasterizer;
+  constexpr size_t          cells = decltype(rasterizer)::columns * decltype(rasterizer)::rows;
+
+  REQUIRE(rasterizer.render(menu, bitmap) == cells);
+  REQUIRE(rasterizer.cell(0, 0).c == U'>');
+  REQUIRE(rasterizer.cell(1, 0).c == U'0');
+  REQUIRE(rasterizer.cell(2, 0).c == U' ');
+  REQUIRE(rasterizer.cell(0, 1).c == U' ');
+  check_pixels(rasterizer, pixels, width, height);
+
+  // top left cell is the cursor marker
+  const uint8_t marker[] = {0x40, 0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00};
+  for (size_t y = 0; y < 8; ++y) {
+    REQUIRE((pixels[y * sgl::Mono1::stride(width)] & 0xFC) == marker[y]);
+  }
+
+  SECTION("nothing changed") { REQUIRE(rasterizer.render(menu, bitmap) == 0); }
+
+  SECTION("value change redraws only its cells") {
+    REQUIRE(menu[counters][NAME("a")].set_value(12) == sgl::error::no_error);
+    REQUIRE(rasterizer.render(menu, bitmap) == 2);
+    REQUIRE(rasterizer.cell(2, 0).c == U'2');
+    check_pixels(rasterizer, pixels, width, height);
+  }
+
+  SECTION("cursor move redraws the markers") {
+    REQUIRE(menu.handle_input(sgl::input::down) == sgl::error::no_error);
+    REQUIRE(rasterizer.render(menu, bitmap) == 2);
+    REQUIRE(rasterizer.cell(0, 1).c == U'>');
+    check_pixels(rasterizer, pixels, width, height);
+  }
+
+  SECTION("edit mode inverts the text") {
+    menu[counters].set_edit_mode();
+    REQUIRE(rasterizer.render(menu, bitmap) == 3);
+    REQUIRE(rasterizer.cell(1, 0).inverted);
+    REQUIRE_FALSE(rasterizer.cell(0, 0).inverted);
+    REQUIRE_FALSE(rasterizer.cell(1, 1).inverted);
+    check_pixels(rasterizer, pixels, width, height);
+  }
+
+  SECTION("scrolling") {
+    menu[counters].set_current_item(3);
+    REQUIRE(rasterizer.render(menu, bitmap) == 2);
+    REQUIRE(rasterizer.first_line() == 2);
+    REQUIRE(rasterizer.cell(0, 1).c == U'>');
+    menu[counters].set_current_item(2);
+    rasterizer.update(menu);
+    REQUIRE(rasterizer.first_line() == 2);
+    menu[counters].set_current_item(0);
+    rasterizer.update(menu);
+    REQUIRE(rasterizer.first_line() == 0);
+  }
+
+  SECTION("page change clears unused lines") {
+    REQUIRE(menu.set_current_page(info) == sgl::error::no_error);
+    rasterizer.update(menu);
+    REQUIRE(rasterizer.cell(1, 0).c == U'T');
+    // "TRUE" does not fit into three cells
+    REQUIRE(rasterizer.cell(2, 0).c == U'R');
+    REQUIRE(rasterizer.cell(3, 0).c == decltype(rasterizer)::ellipsis);
+    REQUIRE(rasterizer.cell(1, 1).c == U' ');
+    REQUIRE(rasterizer.draw(bitmap) == 4);
+    check_pixels(rasterizer, pixels, width, height);
+  }
+
+  SECTION("invalidate") {
+    rasterizer.invalidate();
+    REQUIRE(rasterizer.draw(bitmap) == cells);
+  }
+
+  SECTION("page view") {
+    sgl::PageSnapshot<Menu>   snapshot(menu);
+    sgl::TextRasterizer<4, 2> other;
+    std::vector<uint8_t>      other_pixels(pixels.size());
+    REQUIRE(other.render(snapshot.read(), sgl::Bitmap<sgl::Mono1>{other_pixels.data(),
+                                                                  width,
+                                                                  height}) == cells);
+    REQUIRE(other_pixels == pixels);
+  }
+
+  SECTION("Rgb565 matches Mono1") {
+    std::vector<uint16_t>     colors(width * height);
+    sgl::TextRasterizer<4, 2> other;
+    other.render(menu, sgl::Bitmap<sgl::Rgb565>{colors.data(), width, height});
+    for (size_t y = 0; y < height; ++y) {
+      for (size_t x = 0; x < width; ++x) {
+        REQUIRE((colors[y * width + x] == 0xFFFF) == pixel(pixels, width, x, y));
+      }
+    }
+  }
+}
@@ -0,0 +1,84 @@
+#include "fixture.hpp"
+#include "sgl.hpp"
+#include "sgl/reflection.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  constexpr auto make_menu() noexcept {
+    return fixture::make_menu(
+        fixture::settings_page(NAME("gain") <<= sgl::numeric<16, char>(1.0, 1.0),
+                               NAME("count") <<= sgl::numeric<12, char>(1u, 2u)),
+        fixture::info_page(NAME("level") <<= sgl::numeric<12, char>(-1, 1),
+                           NAME("verbose") <<= sgl::Boolean(false)));
+  }
+
+  using Menu = decltype(make_menu());
+  using R = sgl::Reflection<Menu>;
+} // namespace
+
+TEST_CASE("Reflection") {
+  STATIC_REQUIRE(R::num_pages == 2);
+  STATIC_REQUIRE(R::num_items == 8);
+  STATIC_REQUIRE(R::pages[1].name == "info"_sv);
+  STATIC_REQUIRE(R::pages[1].first_item == 5);
+  STATIC_REQUIRE(R::pages[1].size == 3);
+  STATIC_REQUIRE(R::items[0].kind == sgl::item_kind::boolean);
+  STATIC_REQUIRE(R::items[1].kind == sgl::item_kind::enumeration);
+  STATIC_REQUIRE(R::items[1].value == sgl::value_type::enumeration);
+  STATIC_REQUIRE(R::items[2].value == sgl::value_type::floating_point);
+  STATIC_REQUIRE(R::items[2].value_size == sizeof(double));
+  STATIC_REQUIRE(R::items[2].text_size == 16);
+  STATIC_REQUIRE(R::items[3].value == sgl::value_type::unsigned_integer);
+  STATIC_REQUIRE(R::items[4].kind == sgl::item_kind::page_link);
+  STATIC_REQUIRE(R::items[4].value == sgl::value_type::none);
+  STATIC_REQUIRE(R::items[6].page == 1);
+  STATIC_REQUIRE(R::items[6].item == 1);
+  STATIC_REQUIRE(R::items[6].page_name == "info"_sv);
+  STATIC_REQUIRE(R::items[6].item_name == "level"_sv);
+  STATIC_REQUIRE(R::items[6].value == sgl::value_type::signed_integer);
+
+  auto menu = make_menu();
+
+  SECTION("address and offset") {
+    REQUIRE(R::items[3].address(menu) == &menu[NAME("settings")][NAME("count")]);
+    REQUIRE(R::items[6].address(menu) == &menu[NAME("info")][NAME("level")]);
+    size_t last = 0;
+    for (const auto& info : R::items) {
+      REQUIRE(info.offset(menu) < sizeof(Menu));
+      REQUIRE(info.offset(menu) >= last);
+      last = info.offset(menu);
+    }
+  }
+
+  SECTION("type erased operations") {
+    const auto& level = R::items[6];
+    REQUIRE(level.ops->text(level.address(menu)) == "-1"_sv);
+    REQUIRE(level.ops->set(level.address(menu), "42"_sv) == sgl::error::no_error);
+    REQUIRE(menu[NAME("info")][NAME("level")].get_value() == 42);
+    REQUIRE(level.ops->text(level.address(menu)) == "42"_sv);
+
+    const auto& link = R::items[4];
+    REQUIRE(link.ops->set(link.address(menu), "x"_sv) == sgl::error::not_editable);
+    REQUIRE(link.ops->text(link.address(menu)) == "info"_sv);
+
+    // the operations are shared by all items of a type
+    STATIC_REQUIRE(R::items[0].ops == R::items[7].ops);
+  }
+}
+
+TEST_CASE("Reflection of a char16_t menu") {
+  using sv = sgl::string_view<char16_t>;
+  auto wide_menu = sgl::Menu(NAME("page") <<=
+                             sgl::Page(NAME("gain") <<= sgl::numeric<16, char16_t>(1.0f, 1.0f),
+                                       NAME("offset") <<= sgl::numeric<16, char16_t>(1.0, 1.0)));
+  using W = sgl::Reflection<decltype(wide_menu)>;
+  STATIC_REQUIRE(W::items[0].value == sgl::value_type::floating_point);
+  STATIC_REQUIRE(W::items[1].value_size == sizeof(double));
+
+  const auto& gain = W::items[0];
+  REQUIRE(gain.ops->set(gain.address(wide_menu), sv(u"0.5")) == sgl::error::no_error);
+  REQUIRE(wide_menu[NAME("page")][NAME("gain")].get_value() == 0.5f);
+}
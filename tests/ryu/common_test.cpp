@@ -118,4 +118,24 @@ TEST_CASE("CommonTest", "[ryu][common]") {
     EXPECT_EQ(0x7FF0000000000000, ryu::cx::to_bits(std::numeric_limits<double>::infinity()));
     EXPECT_EQ(0xFFF0000000000000, ryu::cx::to_bits(-std::numeric_limits<double>::infinity()));
   }
+
+#if defined(RYU_HAS_CONSTEXPR_BIT_CAST)
+  SECTION("cx to_bits with bit_cast") {
+    STATIC_REQUIRE(ryu::cx::to_bits(-0.0f) == 0x80000000u);
+    STATIC_REQUIRE(ryu::cx::to_bits(-0.0) == 0x8000000000000000u);
+    STATIC_REQUIRE(ryu::cx::to_bits(1e-45f) == 0x00000001u);
+    STATIC_REQUIRE(ryu::cx::to_bits(5e-324) == 0x0000000000000001u);
+    // every exponent, with a few mantissas each
+    for (uint32_t bits = 0; bits < 0xFF800000u; bits += 0x00400001u) {
+      float f{};
+      memcpy(&f, &bits, sizeof(f));
+      EXPECT_EQ(ryu::to_bits(f), ryu::cx::to_bits(f));
+    }
+    for (uint64_t bits = 0; bits < 0xFFF0000000000000u; bits += 0x0008000000000001u) {
+      double d{};
+      memcpy(&d, &bits, sizeof(d));
+      EXPECT_EQ(ryu::to_bits(d), ryu::cx::to_bits(d));
+    }
+  }
+#endif
 }
@@ -0,0 +1,36 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+#include "cx_test_util.hpp"
+#include "ryu/ryu.hpp"
+
+#include <catch2/catch.hpp>
+
+static constexpr bool test_f2fixed(const char* expected, float f, uint32_t precision) {
+  char buf[256]{0};
+  auto size = ryu::cx::f2fixed_buffered_n(f, precision, buf);
+  return cmp(expected, buf, size);
+}
+
+static constexpr bool test_f2exp(const char* expected, float f, uint32_t precision) {
+  char buf[256]{0};
+  auto size = ryu::cx::f2exp_buffered_n(f, precision, buf);
+  return cmp(expected, buf, size);
+}
+
+TEST_CASE("cx::f2fixed_buffered", "[ryu][f2s_fixed][compile_time]") {
+  STATIC_REQUIRE(test_f2fixed("0.000", 0.0f, 3));
+  STATIC_REQUIRE(test_f2fixed("1.10000002384185791016", 1.1f, 20));
+  STATIC_REQUIRE(test_f2fixed("0.12", 0.125f, 2));
+  STATIC_REQUIRE(test_f2fixed("-10.0", -9.99f, 1));
+  STATIC_REQUIRE(test_f2fixed("340282346638528859811704183484516925440", 3.40282347e+38f, 0));
+}
+
+TEST_CASE("cx::f2exp_buffered", "[ryu][f2s_exponential][compile_time]") {
+  STATIC_REQUIRE(test_f2exp("0.00e+00", 0.0f, 2));
+  STATIC_REQUIRE(test_f2exp("1.0000000149e-01", 0.1f, 10));
+  STATIC_REQUIRE(test_f2exp("3.40282347e+38", 3.40282347e+38f, 8));
+  STATIC_REQUIRE(test_f2exp("1e+01", 9.5f, 0));
+}
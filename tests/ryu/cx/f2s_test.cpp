@@ -31,7 +31,11 @@ static constexpr bool test_f2s(const char* expected, double d) {
 TEST_CASE("cx::f2s_buffered", "[ryu][f2s][compile_time") {
   SECTION("Basic") {
     CX_ASSERT_F2S("0E0", 0.0);
+#if defined(RYU_HAS_CONSTEXPR_BIT_CAST)
+    CX_ASSERT_F2S("-0E0", -0.0);
+#else
     // CX_ASSERT_F2S("-0E0", -0.0); cant differentiate positive and negative zero in cx::to_bits
+#endif
     CX_ASSERT_F2S("1E0", 1.0);
     CX_ASSERT_F2S("-1E0", -1.0);
     REQUIRE(test_f2s("NaN", NAN)); // cannot be constexpr
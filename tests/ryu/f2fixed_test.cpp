@@ -0,0 +1,130 @@
+//          Copyright Pele Constam 2022.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "ryu/ryu.hpp"
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+static float
+    ieeeParts2Float(const bool sign, const uint32_t ieeeExponent, const uint32_t ieeeMantissa) {
+  const uint32_t bits = ((uint32_t)sign << 31) | (ieeeExponent << 23) | ieeeMantissa;
+  float          f{0};
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+static std::string f2fixed(float f, uint32_t precision) {
+  char buf[512]{0};
+  auto size = ryu::f2fixed_buffered_n(f, precision, buf);
+  REQUIRE(size < 512);
+  return std::string(buf, size);
+}
+
+static std::string f2exp(float f, uint32_t precision) {
+  char buf[512]{0};
+  auto size = ryu::f2exp_buffered_n(f, precision, buf);
+  REQUIRE(size < 512);
+  return std::string(buf, size);
+}
+
+// f2fixed and f2exp must produce the same output as d2fixed and d2exp of the value as double.
+static void test_same_as_double(float f, uint32_t precision) {
+  char buf[512]{0};
+  auto size = ryu::d2fixed_buffered_n(static_cast<double>(f), precision, buf);
+  REQUIRE(f2fixed(f, precision) == std::string(buf, size));
+  size = ryu::d2exp_buffered_n(static_cast<double>(f), precision, buf);
+  REQUIRE(f2exp(f, precision) == std::string(buf, size));
+}
+
+TEST_CASE("f2fixed_buffered", "[ryu][f2s_fixed]") {
+  SECTION("Zero") {
+    REQUIRE(f2fixed(0.0f, 3) == "0.000");
+    REQUIRE(f2fixed(0.0f, 0) == "0");
+    REQUIRE(f2fixed(-0.0f, 1) == "-0.0");
+  }
+
+  SECTION("MinMax") {
+    REQUIRE(f2fixed(ieeeParts2Float(false, 0, 1), 149) ==
+            "0.0000000000000000000000000000000000000000000014012984643248170709237295832899161312"
+            "8026194187651577175706828388979108268586060148663818836212158203125");
+    REQUIRE(f2fixed(ieeeParts2Float(false, 0, 1), 3) == "0.000");
+    REQUIRE(f2fixed(ieeeParts2Float(false, 254, 0x7FFFFF), 0) ==
+            "340282346638528859811704183484516925440");
+  }
+
+  SECTION("RoundToEven") {
+    REQUIRE(f2fixed(0.125f, 2) == "0.12");
+    REQUIRE(f2fixed(0.375f, 2) == "0.38");
+    REQUIRE(f2fixed(2.5f, 0) == "2");
+    REQUIRE(f2fixed(3.5f, 0) == "4");
+    REQUIRE(f2fixed(0.748046875f, 1) == "0.7");
+  }
+
+  SECTION("Carrying") {
+    REQUIRE(f2fixed(0.9999f, 3) == "1.000");
+    REQUIRE(f2fixed(299.9f, 0) == "300");
+    REQUIRE(f2fixed(-9.99f, 1) == "-10.0");
+  }
+
+  SECTION("Precision") {
+    REQUIRE(f2fixed(1.1f, 20) == "1.10000002384185791016");
+    REQUIRE(f2fixed(0.1f, 10) == "0.1000000015");
+    REQUIRE(f2fixed(3.14159265f, 7) == "3.1415927");
+  }
+}
+
+TEST_CASE("f2exp_buffered", "[ryu][f2s_exponential]") {
+  SECTION("Zero") {
+    REQUIRE(f2exp(0.0f, 2) == "0.00e+00");
+    REQUIRE(f2exp(0.0f, 0) == "0e+00");
+  }
+
+  SECTION("MinMax") {
+    REQUIRE(f2exp(ieeeParts2Float(false, 0, 1), 3) == "1.401e-45");
+    REQUIRE(f2exp(ieeeParts2Float(false, 254, 0x7FFFFF), 0) == "3e+38");
+    REQUIRE(f2exp(ieeeParts2Float(false, 254, 0x7FFFFF), 8) == "3.40282347e+38");
+  }
+
+  SECTION("Precision") {
+    REQUIRE(f2exp(0.1f, 10) == "1.0000000149e-01");
+    REQUIRE(f2exp(3.14159265f, 7) == "3.1415927e+00");
+    REQUIRE(f2exp(9.5f, 0) == "1e+01");
+    REQUIRE(f2exp(8.5f, 0) == "8e+00");
+  }
+}
+
+TEST_CASE("f2fixed and f2exp match the double versions", "[ryu][f2s_fixed][f2s_exponential]") {
+  SECTION("Special") {
+    test_same_as_double(ieeeParts2Float(false, 255, 0), 3);
+    test_same_as_double(ieeeParts2Float(true, 255, 0), 3);
+    test_same_as_double(ieeeParts2Float(false, 255, 0x400000), 3);
+  }
+
+  SECTION("AllBinaryExponents") {
+    for (uint32_t e = 0; e < 255; ++e) {
+      for (const uint32_t m : {0u, 1u, 0x400000u, 0x7FFFFFu, 0x2AAAAAu}) {
+        for (const uint32_t precision : {0u, 1u, 6u, 9u, 17u, 40u, 160u}) {
+          test_same_as_double(ieeeParts2Float(e % 2 == 0, e, m), precision);
+        }
+      }
+    }
+  }
+
+  SECTION("Halfway") {
+    // k + 1/2^n has a trailing 5, which tests the round to even logic.
+    for (uint32_t k = 0; k < 64; ++k) {
+      for (uint32_t n = 1; n < 12; ++n) {
+        const float f = static_cast<float>(k) + 1.0f / static_cast<float>(1u << n);
+        for (uint32_t precision = 0; precision < 12; ++precision) {
+          test_same_as_double(f, precision);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,126 @@
+#include "fixture.hpp"
+#include "sgl.hpp"
+#include "sgl/serialize.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace sgl::string_view_literals;
+
+namespace {
+  constexpr auto settings_page() noexcept {
+    return fixture::settings_page(NAME("gain") <<= sgl::numeric<16, char>(1.0, 1.0),
+                                  NAME("offset") <<= sgl::numeric<16, char>(1.0f, 1.0f),
+                                  NAME("count") <<= sgl::numeric<12, char>(1, 2));
+  }
+
+  constexpr auto make_menu() noexcept {
+    return fixture::make_menu(settings_page(),
+                              fixture::info_page(NAME("verbose") <<= sgl::Boolean(false)));
+  }
+
+  constexpr auto make_other_menu() noexcept {
+    return fixture::make_menu(
+        settings_page(), fixture::info_page(NAME("verbose") <<= sgl::numeric<12, char>(0, 1)));
+  }
+
+  using fixture::info;
+  using fixture::settings;
+} // namespace
+
+TEST_CASE("sgl::serialize") {
+  using Menu = decltype(make_menu());
+  static_assert(sgl::snapshot_size_v<Menu> == 4 + 1 + 1 + 8 + 4 + 4 + 1);
+  static_assert(sgl::max_delta_size_v<Menu> == sgl::snapshot_size_v<Menu> + 6 * 2);
+  static_assert(sgl::schema_hash_v<Menu> != sgl::schema_hash_v<decltype(make_other_menu())>);
+
+  auto    menu = make_menu();
+  uint8_t blob[sgl::snapshot_size_v<Menu>]{};
+
+  SECTION("round trip") {
+    auto res = sgl::serialize(menu, blob, sizeof(blob));
+    REQUIRE(res.ec == sgl::error::no_error);
+    REQUIRE(res.size == sizeof(blob));
+
+    auto other = make_menu();
+    REQUIRE(other[settings][NAME("enabled")].set_value(false) == sgl::error::no_error);
+    other[settings][NAME("mode")].set_index(2);
+    REQUIRE(other[settings][NAME("gain")].set_value(2.5) == sgl::error::no_error);
+    REQUIRE(other[settings][NAME("offset")].set_value(0.5f) == sgl::error::no_error);
+    REQUIRE(other[settings][NAME("count")].set_value(-42) == sgl::error::no_error);
+    REQUIRE(other[info][NAME("verbose")].set_value(true) == sgl::error::no_error);
+
+    REQUIRE(sgl::serialize(other, blob, sizeof(blob)).ec == sgl::error::no_error);
+    REQUIRE(sgl::deserialize(menu, blob, sizeof(blob)) == sgl::error::no_error);
+
+    REQUIRE_FALSE(menu[settings][NAME("enabled")].get_value());
+    REQUIRE(menu[settings][NAME("mode")].index() == 2);
+    REQUIRE(sgl::string_view<char>(menu[settings][NAME("mode")].text()) == "fast"_sv);
+    REQUIRE(menu[settings][NAME("gain")].get_value() == 2.5);
+    REQUIRE(menu[settings][NAME("offset")].get_value() == 0.5f);
+    REQUIRE(menu[settings][NAME("count")].get_value() == -42);
+    REQUIRE(sgl::string_view<char>(menu[settings][NAME("count")].text()) == "-42"_sv);
+    REQUIRE(menu[info][NAME("verbose")].get_value());
+  }
+
+  SECTION("errors") {
+    REQUIRE(sgl::serialize(menu, blob, sizeof(blob) - 1).ec == sgl::error::buffer_too_small);
+    REQUIRE(sgl::serialize(menu, blob, sizeof(blob)).ec == sgl::error::no_error);
+    REQUIRE(sgl::deserialize(menu, blob, sizeof(blob) - 1) == sgl::error::buffer_too_small);
+
+    auto other = make_other_menu();
+    REQUIRE(sgl::deserialize(other, blob, sizeof(blob)) == sgl::error::schema_mismatch);
+
+    blob[5] = 3; // enum index out of range
+    REQUIRE(sgl::deserialize(menu, blob, sizeof(blob)) == sgl::error::invalid_value);
+  }
+
+  SECTION("delta") {
+    uint8_t delta[sgl::max_delta_size_v<Menu>]{};
+    REQUIRE(sgl::serialize(menu, blob, sizeof(blob)).ec == sgl::error::no_error);
+
+    auto res = sgl::serialize_delta(menu, blob, sizeof(blob), delta, sizeof(delta));
+    REQUIRE(res.ec == sgl::error::no_error);
+    REQUIRE(res.size == 0);
+
+    REQUIRE(menu[settings][NAME("count")].set_value(7) == sgl::error::no_error);
+    REQUIRE(menu[info][NAME("verbose")].set_value(true) == sgl::error::no_error);
+    res = sgl::serialize_delta(menu, blob, sizeof(blob), delta, sizeof(delta));
+    REQUIRE(res.ec == sgl::error::no_error);
+    REQUIRE(res.size == 4 + (2 + 4) + (2 + 1));
+    // item ids count every item of the menu, including page links
+    REQUIRE(delta[4] == 4);
+    REQUIRE(delta[10] == 7);
+
+    // the snapshot has been updated
+    REQUIRE(sgl::serialize_delta(menu, blob, sizeof(blob), delta, sizeof(delta)).size == 0);
+
+    REQUIRE(menu[settings][NAME("count")].set_value(8) == sgl::error::no_error);
+    REQUIRE(sgl::serialize_delta(menu, blob, sizeof(blob), delta, 4 + 2).ec ==
+            sgl::error::buffer_too_small);
+
+    // the first record fits but the second doesn't: the snapshot must not mark it as sent
+    REQUIRE(menu[info][NAME("verbose")].set_value(false) == sgl::error::no_error);
+    uint8_t retry[sgl::max_delta_size_v<Menu>]{};
+    REQUIRE(sgl::serialize_delta(menu, blob, sizeof(blob), retry, 4 + (2 + 4) + 2).ec ==
+            sgl::error::buffer_too_small);
+    auto retried = sgl::serialize_delta(menu, blob, sizeof(blob), retry, sizeof(retry));
+    REQUIRE(retried.ec == sgl::error::no_error);
+    REQUIRE(retried.size == 4 + (2 + 4) + (2 + 1));
+    REQUIRE(sgl::serialize_delta(menu, blob, sizeof(blob), retry, sizeof(retry)).size == 0);
+    auto copy = make_menu();
+    REQUIRE(sgl::deserialize_delta(copy, retry, retried.size) == sgl::error::no_error);
+    REQUIRE(copy[settings][NAME("count")].get_value() == 8);
+    REQUIRE_FALSE(copy[info][NAME("verbose")].get_value());
+
+    auto other = make_menu();
+    REQUIRE(sgl::deserialize_delta(other, delta, 0) == sgl::error::no_error);
+    REQUIRE(sgl::deserialize_delta(other, delta, res.size) == sgl::error::no_error);
+    REQUIRE(other[settings][NAME("count")].get_value() == 7);
+    REQUIRE(other[info][NAME("verbose")].get_value());
+    REQUIRE(other[settings][NAME("gain")].get_value() == 1.0);
+
+    REQUIRE(sgl::deserialize_delta(other, delta, res.size - 1) == sgl::error::invalid_value);
+    delta[4] = 5; // id of a page link
+    REQUIRE(sgl::deserialize_delta(other, delta, res.size) == sgl::error::invalid_value);
+  }
+}
@@ -0,0 +1,161 @@
+#include "fixture.hpp"
+#include "sgl.hpp"
+#include "sgl/file_block_device.hpp"
+#include "sgl/settings_journal.hpp"
+
+#include <catch2/catch.hpp>
+#include <filesystem>
+#include <string>
+
+namespace {
+  constexpr auto make_menu() noexcept {
+    return fixture::make_menu(
+        fixture::settings_page(NAME("count") <<= sgl::numeric<12, char>(0, 1)),
+        fixture::info_page(NAME("gain") <<= sgl::numeric<16, char>(1.0f, 1.0f)));
+  }
+
+  constexpr auto make_other_menu() noexcept {
+    return sgl::Menu(NAME("settings") <<= sgl::Page(NAME("count") <<= sgl::numeric<12, char>(0, 1)));
+  }
+
+  using fixture::info;
+  using fixture::settings;
+  constexpr auto count = NAME("count");
+
+  constexpr const char* file_name = "sgl_settings_journal_test.bin";
+} // namespace
+
+TEST_CASE("sgl::SettingsJournal") {
+  using Menu = decltype(make_menu());
+  using Journal = sgl::SettingsJournal<Menu, sgl::FileBlockDevice>;
+  const auto        file = std::filesystem::temp_directory_path() / file_name;
+  const std::string path_string = file.string();
+  const char*       path = path_string.c_str();
+  std::filesystem::remove(file);
+  constexpr size_t block_size = 64;
+  static_assert(Journal::min_block_size <= block_size);
+  constexpr size_t empty_size = Journal::block_header_size + sgl::snapshot_size_v<Menu>;
+
+  {
+    sgl::FileBlockDevice device(path, block_size, 3);
+    REQUIRE(device.is_open());
+    auto    menu = make_menu();
+    Journal journal(menu, device);
+
+    SECTION("restore and record") {
+      // empty device is formatted
+      REQUIRE(journal.restore(menu) == sgl::error::no_error);
+      REQUIRE(journal.current_block() == 0);
+      REQUIRE(journal.bytes_used() == empty_size);
+
+      // nothing changed, nothing written
+      REQUIRE(journal.record(menu) == sgl::error::no_error);
+      REQUIRE(journal.bytes_used() == empty_size);
+
+      REQUIRE(menu[settings][count].set_value(42) == sgl::error::no_error);
+      REQUIRE(journal.record(menu) == sgl::error::no_error);
+      REQUIRE(journal.bytes_used() == empty_size + Journal::entry_header_size + 2 + 4);
+
+      REQUIRE(menu[settings][NAME("enabled")].set_value(false) == sgl::error::no_error);
+      REQUIRE(menu[info][NAME("gain")].set_value(2.0f) == sgl::error::no_error);
+      REQUIRE(journal.record(menu) == sgl::error::no_error);
+
+      auto    restored = make_menu();
+      Journal other(restored, device);
+      REQUIRE(other.restore(restored) == sgl::error::no_error);
+      REQUIRE(other.bytes_used() == journal.bytes_used());
+      REQUIRE(restored[settings][count].get_value() == 42);
+      REQUIRE_FALSE(restored[settings][NAME("enabled")].get_value());
+      REQUIRE(restored[info][NAME("gain")].get_value() == 2.0f);
+    }
+
+    SECTION("compaction") {
+      REQUIRE(journal.restore(menu) == sgl::error::no_error);
+      for (int i = 1; i <= 40; ++i) {
+        REQUIRE(menu[settings][count].set_value(i) == sgl::error::no_error);
+        REQUIRE(journal.record(menu) == sgl::error::no_error);
+        REQUIRE(journal.bytes_used() <= block_size);
+      }
+      // the blocks are used round robin
+      REQUIRE(device.erase_count(0) > 1);
+      REQUIRE(device.erase_count(1) > 1);
+      REQUIRE(device.erase_count(2) > 1);
+
+      auto    restored = make_menu();
+      Journal other(restored, device);
+      REQUIRE(other.restore(restored) == sgl::error::no_error);
+      REQUIRE(other.current_block() == journal.current_block());
+      REQUIRE(restored[settings][count].get_value() == 40);
+    }
+
+    SECTION("torn write") {
+      REQUIRE(journal.restore(menu) == sgl::error::no_error);
+      REQUIRE(menu[settings][count].set_value(1) == sgl::error::no_error);
+      REQUIRE(journal.record(menu) == sgl::error::no_error);
+      const size_t last = journal.bytes_used();
+      REQUIRE(menu[settings][count].set_value(2) == sgl::error::no_error);
+      REQUIRE(journal.record(menu) == sgl::error::no_error);
+
+      // clear the low byte of the value in the last entry, as if power was lost while writing it.
+      const uint8_t zero = 0;
+      REQUIRE(device.write(journal.current_block(), journal.bytes_used() - 4, &zero, 1) ==
+              sgl::error::no_error);
+
+      auto    restored = make_menu();
+      Journal other(restored, device);
+      REQUIRE(other.restore(restored) == sgl::error::no_error);
+      REQUIRE(restored[settings][count].get_value() == 1);
+      REQUIRE(other.bytes_used() == last);
+
+      // the next record starts a fresh block
+      REQUIRE(other.record(restored) == sgl::error::no_error);
+      REQUIRE(other.current_block() != journal.current_block());
+      REQUIRE(other.bytes_used() == empty_size);
+    }
+
+    SECTION("corrupted entry") {
+      REQUIRE(journal.restore(menu) == sgl::error::no_error);
+      REQUIRE(menu[settings][count].set_value(1) == sgl::error::no_error);
+      REQUIRE(journal.record(menu) == sgl::error::no_error);
+      const size_t last = journal.bytes_used();
+      REQUIRE(menu[settings][count].set_value(0x0201) == sgl::error::no_error);
+      REQUIRE(journal.record(menu) == sgl::error::no_error);
+
+      // clear bit 0 of the low byte and bit 1 of the next byte of the value, the two flips cancel
+      // out in a rotate-xor checksum.
+      const uint8_t masks[2] = {0xFE, 0xFD};
+      REQUIRE(device.write(journal.current_block(), journal.bytes_used() - 4, masks, 2) ==
+              sgl::error::no_error);
+
+      auto    restored = make_menu();
+      Journal other(restored, device);
+      REQUIRE(other.restore(restored) == sgl::error::no_error);
+      REQUIRE(restored[settings][count].get_value() == 1);
+      REQUIRE(other.bytes_used() == last);
+    }
+
+    SECTION("schema mismatch") {
+      REQUIRE(menu[settings][count].set_value(5) == sgl::error::no_error);
+      REQUIRE(journal.restore(menu) == sgl::error::no_error);
+      REQUIRE(menu[settings][count].get_value() == 5);
+
+      auto other_menu = make_other_menu();
+      sgl::SettingsJournal<decltype(other_menu), sgl::FileBlockDevice> other(other_menu, device);
+      REQUIRE(other.restore(other_menu) == sgl::error::no_error);
+      REQUIRE(other_menu[settings][count].get_value() == 0);
+      REQUIRE(other.bytes_used() ==
+              Journal::block_header_size + sgl::snapshot_size_v<decltype(other_menu)>);
+    }
+
+    SECTION("invalid device") {
+      sgl::FileBlockDevice small(path, Journal::min_block_size - 1, 2);
+      Journal              small_journal(menu, small);
+      REQUIRE(small_journal.restore(menu) == sgl::error::buffer_too_small);
+
+      sgl::FileBlockDevice single(path, block_size, 1);
+      Journal              single_journal(menu, single);
+      REQUIRE(single_journal.restore(menu) == sgl::error::invalid_input);
+    }
+  }
+  std::filesystem::remove(file);
+}
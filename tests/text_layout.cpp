@@ -0,0 +1,168 @@
+#include "sgl.hpp"
+#include "sgl/raster.hpp"
+#include "sgl/text_layout.hpp"
+
+#include <catch2/catch.hpp>
+
+namespace {
+  template <typename CharT>
+  constexpr char32_t decode_at(sgl::string_view<CharT> text, size_t pos, size_t end) {
+    const char32_t c = sgl::decode(text, pos);
+    return pos == end ? c : 0;
+  }
+
+  // "a中é" followed by a combining acute accent
+  constexpr const char*     utf8 = "a\xE4\xB8\xAD\xC3\xA9\xCC\x81";
+  constexpr const char16_t* utf16 = u"a中é́";
+  constexpr const char32_t* utf32 = U"a中é́";
+} // namespace
+
+TEST_CASE("decode") {
+  SECTION("utf-8") {
+    using sv = sgl::string_view<char>;
+    STATIC_REQUIRE(decode_at(sv("a"), 0, 1) == U'a');
+    STATIC_REQUIRE(decode_at(sv(utf8), 1, 4) == U'中');
+    STATIC_REQUIRE(decode_at(sv(utf8), 4, 6) == U'é');
+    STATIC_REQUIRE(decode_at(sv("\xF0\x9F\x98\x80"), 0, 4) == U'\U0001F600');
+    // continuation byte, overlong encoding, surrogate and incomplete sequence
+    STATIC_REQUIRE(decode_at(sv("\x80"), 0, 1) == 0xFFFD);
+    STATIC_REQUIRE(decode_at(sv("\xC0\xAF"), 0, 1) == 0xFFFD);
+    STATIC_REQUIRE(decode_at(sv("\xED\xA0\x80"), 0, 1) == 0xFFFD);
+    STATIC_REQUIRE(decode_at(sv("\xE4\xB8"), 0, 1) == 0xFFFD);
+  }
+  SECTION("utf-16") {
+    using sv = sgl::string_view<char16_t>;
+    STATIC_REQUIRE(decode_at(sv(utf16), 1, 2) == U'中');
+    STATIC_REQUIRE(decode_at(sv(u"\U0001F600"), 0, 2) == U'\U0001F600');
+    constexpr char16_t lone_high[] = {0xD83D, u'a', 0};
+    constexpr char16_t lone_low[] = {0xDE00, 0};
+    STATIC_REQUIRE(decode_at(sv(lone_high), 0, 1) == 0xFFFD);
+    STATIC_REQUIRE(decode_at(sv(lone_low), 0, 1) == 0xFFFD);
+  }
+  SECTION("utf-32") {
+    using sv = sgl::string_view<char32_t>;
+    STATIC_REQUIRE(decode_at(sv(utf32), 1, 2) == U'中');
+  }
+}
+
+TEST_CASE("display_width") {
+  STATIC_REQUIRE(sgl::display_width(U'a') == 1);
+  STATIC_REQUIRE(sgl::display_width(U'é') == 1);
+  STATIC_REQUIRE(sgl::display_width(U'\u0301') == 0);
+  STATIC_REQUIRE(sgl::display_width(U'\u200B') == 0);
+  STATIC_REQUIRE(sgl::display_width(U'中') == 2);
+  STATIC_REQUIRE(sgl::display_width(U'가') == 2);
+  STATIC_REQUIRE(sgl::display_width(U'Ａ') == 2);
+  STATIC_REQUIRE(sgl::display_width(U'\U0001F600') == 2);
+  STATIC_REQUIRE(sgl::display_width(U'▁') == 1);
+
+  STATIC_REQUIRE(sgl::display_width(sgl::string_view<char>(utf8)) == 4);
+  STATIC_REQUIRE(sgl::display_width(sgl::string_view<char16_t>(utf16)) == 4);
+  STATIC_REQUIRE(sgl::display_width(sgl::string_view<char32_t>(utf32)) == 4);
+}
+
+TEMPLATE_TEST_CASE("layout_line", "[text_layout]", char, char16_t, char32_t) {
+  using sv = sgl::string_view<TestType>;
+  const auto text = [] {
+    if constexpr (std::is_same_v<TestType, char>) {
+      return sv(utf8);
+    } else if constexpr (std::is_same_v<TestType, char16_t>) {
+      return sv(utf16);
+    } else {
+      return sv(utf32);
+    }
+  }();
+  // code units of "a" and "a中"
+  constexpr size_t a = 1;
+  constexpr size_t wide = 1 + (sizeof(TestType) == 1 ? 3 : 1);
+
+  SECTION("fits") {
+    const auto layout = sgl::layout_line(text, 4);
+    REQUIRE_FALSE(layout.truncated);
+    REQUIRE(layout.width == 4);
+    REQUIRE(layout.units == text.size());
+    REQUIRE(layout.scanned == text.size());
+  }
+  SECTION("a wide character is not split") {
+    // "a" + ellipsis, "中" would need two of the remaining two columns next to the ellipsis
+    auto layout = sgl::layout_line(text, 3);
+    REQUIRE(layout.truncated);
+    REQUIRE(layout.width == 1);
+    REQUIRE(layout.units == a);
+    // "a中" + ellipsis
+    layout = sgl::layout_line(text, 3, 0);
+    REQUIRE(layout.truncated);
+    REQUIRE(layout.width == 3);
+    REQUIRE(layout.units == wide);
+  }
+  SECTION("only the prefix is scanned") {
+    const auto layout = sgl::layout_line(text, 2);
+    REQUIRE(layout.truncated);
+    REQUIRE(layout.units == a);
+    REQUIRE(layout.scanned == wide);
+  }
+  SECTION("empty and zero columns") {
+    REQUIRE(sgl::layout_line(sv(), 0).units == 0);
+    REQUIRE_FALSE(sgl::layout_line(sv(), 0).truncated);
+    const auto layout = sgl::layout_line(text, 0);
+    REQUIRE(layout.truncated);
+    REQUIRE(layout.units == 0);
+  }
+}
+
+TEST_CASE("TextLayout") {
+  sgl::TextLayout<char, 8>     layout;
+  sgl::static_string<char, 16> text("temperature");
+  const auto                   view = [&text] { return sgl::string_view<char>(text); };
+
+  REQUIRE(layout.update(view(), 5));
+  REQUIRE(layout.layout().truncated);
+  REQUIRE(layout.layout().units == 4);
+  REQUIRE(layout.layout().scanned == 6);
+
+  SECTION("unchanged text is not laid out again") {
+    REQUIRE_FALSE(layout.update(view(), 5));
+    REQUIRE(layout.layout().units == 4);
+  }
+  SECTION("changes after the scanned prefix keep the layout") {
+    text.append('s');
+    REQUIRE_FALSE(layout.update(view(), 5));
+  }
+  SECTION("changes in the scanned prefix and of the columns invalidate it") {
+    text[5] = 'E';
+    REQUIRE(layout.update(view(), 5));
+    REQUIRE_FALSE(layout.update(view(), 5));
+    REQUIRE(layout.update(view(), 20));
+    REQUIRE_FALSE(layout.layout().truncated);
+    REQUIRE(layout.layout().width == 11);
+  }
+  SECTION("layouts longer than the capacity are not cached") {
+    REQUIRE(layout.update(view(), 20));
+    REQUIRE(layout.update(view(), 20));
+  }
+  SECTION("invalidate") {
+    layout.invalidate();
+    REQUIRE(layout.update(view(), 5));
+  }
+}
+
+TEST_CASE("TextRasterizer text layout") {
+  using sv = sgl::string_view<char32_t>;
+  auto menu = sgl::Menu(
+      NAME("page") <<= sgl::Page(NAME("label") <<= sgl::Button<16, char32_t>(sv(U"a中b́cd"))));
+  sgl::TextRasterizer<6, 1, char32_t> rasterizer;
+  rasterizer.update(menu);
+  // wide characters take two cells, combining marks none, and the text is truncated
+  REQUIRE(rasterizer.cell(1, 0).c == U'a');
+  REQUIRE(rasterizer.cell(2, 0).c == U'中');
+  REQUIRE(rasterizer.cell(3, 0).c == U' ');
+  REQUIRE(rasterizer.cell(4, 0).c == U'b');
+  REQUIRE(rasterizer.cell(5, 0).c == decltype(rasterizer)::ellipsis);
+
+  menu[NAME("page")][NAME("label")].set_text(sv(U"ＡＢ"));
+  rasterizer.update(menu);
+  REQUIRE(rasterizer.cell(1, 0).c == U'Ａ');
+  REQUIRE(rasterizer.cell(3, 0).c == U'Ｂ');
+  REQUIRE(rasterizer.cell(4, 0).c == U' ');
+  REQUIRE(rasterizer.cell(5, 0).c == U' ');
+}
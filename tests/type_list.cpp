@@ -2,10 +2,22 @@
 
 #include <catch2/catch.hpp>
 #include <limits>
+#include <utility>
 
 template <typename... Ts>
 struct apply_test {};
 
+template <size_t I>
+struct tag {};
+
+template <typename Indices>
+struct tag_list;
+
+template <size_t... I>
+struct tag_list<std::index_sequence<I...>> {
+  using type = sgl::type_list<tag<I>...>;
+};
+
 TEST_CASE("type_list") {
   SECTION("is_type_list"){
         using list = sgl::type_list<int, char, double, float, unsigned>;
@@ -91,6 +103,25 @@ TEST_CASE("type_list") {
   SECTION("all_unique") {
     STATIC_REQUIRE(sgl::all_unique_v<int, char, double, float, unsigned>);
     STATIC_REQUIRE_FALSE(sgl::all_unique_v<int, char, double, float, int, unsigned>);
+    STATIC_REQUIRE(sgl::all_unique_v<int>);
+    STATIC_REQUIRE(sgl::all_unique_v<sgl::type_list<int, char>>);
+    STATIC_REQUIRE_FALSE(sgl::all_unique_v<sgl::type_list<int, char, char>>);
+  }
+  SECTION("duplicates") {
+    using list = sgl::type_list<int, char, int, char>;
+    STATIC_REQUIRE(sgl::index_of_v<char, list> == 1);
+    STATIC_REQUIRE(std::is_same_v<int, sgl::type_at_t<2, list>>);
+    STATIC_REQUIRE(std::is_same_v<sgl::type_list<int, char, int>, sgl::pop_back_t<list>>);
+  }
+  SECTION("lists longer than the template instantiation depth") {
+    // the primitives must not recurse once per element
+    using list = typename tag_list<std::make_index_sequence<1000>>::type;
+    STATIC_REQUIRE(sgl::list_size_v<list> == 1000);
+    STATIC_REQUIRE(sgl::index_of_v<tag<999>, list> == 999);
+    STATIC_REQUIRE(std::is_same_v<tag<998>, sgl::type_at_t<998, list>>);
+    STATIC_REQUIRE(std::is_same_v<tag<999>, sgl::last_t<list>>);
+    STATIC_REQUIRE(sgl::all_unique_v<list>);
+    STATIC_REQUIRE(sgl::list_size_v<sgl::pop_back_t<list>> == 999);
   }
   // #TODO: for_each_t
 }
\ No newline at end of file